@@ -6,6 +6,7 @@
 #include "Operand.hpp"
 #include "Synthesizer.hpp"
 #include "InstructionSet.hpp"
+#include "Statistics.hpp"
 #include "String.hpp"
 
 #include <time.h>
@@ -151,12 +152,36 @@ namespace SoftWire
 	InstructionSet *Assembler::instructionSet = 0;
 	int Assembler::referenceCount = 0;
 	bool Assembler::listingEnabled = true;
+	bool Assembler::statisticsEnabled = false;
 
 	Assembler::Assembler(bool x64) : x64(x64)
 	{
 		echoFile = 0;
+		echo = 0;
+		echoLine = 0;
 		entryLabel = 0;
 
+		coldRegion = false;
+		coldBlocks = 0;
+
+		counters = 0;
+		instrumented = false;
+		branches = 0;
+		entry = 0;
+
+		profile = 0;
+		profileCold = false;
+		weight = -1;
+
+		literals = 0;
+		literalCount = 0;
+		literalsPlaced = false;
+
+		routines = 0;
+		routineNumber = 0;
+
+		statistics = statisticsEnabled ? new Statistics() : 0;
+
 		if(!instructionSet)
 		{
 			instructionSet = new InstructionSet();
@@ -166,6 +191,7 @@ namespace SoftWire
 
 		linker = new Linker();
 		loader = new Loader(*linker, x64);
+		loader->setStatistics(statistics);
 		synthesizer = new Synthesizer(x64);
 	}
 
@@ -190,14 +216,24 @@ namespace SoftWire
 			instructionSet = 0;
 		}
 
-		delete[] echoFile;
-		echoFile = 0;
+		closeEcho();
+
+		freeCounters();
+		freeLiterals();
+		freeRoutines();
+
+		delete statistics;
+		statistics = 0;
 	}
 
 	void (*Assembler::callable(const char *entryLabel))()
 	{
 		if(!loader) return 0;
 
+		placeLiterals();
+		locateSlots();
+		locateRoutines();
+
 		if(entryLabel)
 		{
 			return loader->callable(entryLabel);
@@ -212,14 +248,17 @@ namespace SoftWire
 	{
 		if(!loader) throw Error("Assembler could not be finalized (cannot re-finalize)");
 
+		placeLiterals();
+		locateSlots();
+		locateRoutines();
+
 		delete linker;
 		linker = 0;
 
 		delete synthesizer;
 		synthesizer = 0;
 
-		delete[] echoFile;
-		echoFile = 0;
+		closeEcho();
 
 		if(entryLabel)
 		{
@@ -251,24 +290,67 @@ namespace SoftWire
 		loader->clearListing();
 	}
 
+	void Assembler::streamListing(ListingCallback callback, void *data) const
+	{
+		loader->streamListing(callback, data);
+	}
+
+	void Assembler::writeListing(int fd) const
+	{
+		loader->writeListing(fd);
+	}
+
+	void Assembler::retainListing(bool retain)
+	{
+		loader->retainListing(retain);
+	}
+
 	void Assembler::setEchoFile(const char *echoFile, const char *mode)
 	{
 		if(!listingEnabled) return;
 
-		if(this->echoFile)
-		{
-			delete[] this->echoFile;
-			this->echoFile = 0;
-		}
+		closeEcho();
 
 		if(echoFile)
 		{
+			// Line numbers for debug information
+			echoLine = 0;
+
+			if(mode[0] == 'a')
+			{
+				FILE *file = fopen(echoFile, "rt");
+
+				if(file)
+				{
+					for(int c = fgetc(file); c != EOF; c = fgetc(file))
+					{
+						if(c == '\n') echoLine++;
+					}
+
+					fclose(file);
+				}
+			}
+
+			// Kept open and fully buffered until finalized, a new echo file is set, or destruction
+			echo = fopen(echoFile, mode);
+
+			if(!echo)
+			{
+				throw Error("Could not open echo file '%s'", echoFile);
+			}
+
+			setvbuf(echo, 0, _IOFBF, 1 << 16);
+
 			this->echoFile = strdup(echoFile);
 
-			FILE *file = fopen(echoFile, mode);
 			const time_t t = time(0);
-			fprintf(file, "\n;%s\n", ctime(&t));
-			fclose(file);
+			fprintf(echo, "\n;%s\n", ctime(&t));
+			echoLine += 3;
+		}
+
+		if(loader)
+		{
+			loader->setSourceFile(this->echoFile);
 		}
 	}
 
@@ -283,11 +365,28 @@ namespace SoftWire
 		vsnprintf(buffer, 256, format, argList);
 		va_end(argList);
 
-		FILE *file = fopen(echoFile, "at");
-		fprintf(file, "; ");
-		fprintf(file, buffer);
-		fprintf(file, "\n");
-		fclose(file);
+		fprintf(echo, "; ");
+		fprintf(echo, buffer);
+		fprintf(echo, "\n");
+
+		for(const char *c = buffer; *c; c++)
+		{
+			if(*c == '\n') echoLine++;
+		}
+
+		echoLine++;
+	}
+
+	void Assembler::closeEcho()
+	{
+		if(echo)
+		{
+			fclose(echo);
+			echo = 0;
+		}
+
+		delete[] echoFile;
+		echoFile = 0;
 	}
 
 	void Assembler::reset()
@@ -295,6 +394,21 @@ namespace SoftWire
 		if(!loader) return;
 
 		loader->reset();
+		coldRegion = false;
+
+		freeCounters();
+		branches = 0;
+		entry = 0;
+		profileCold = false;
+		weight = -1;
+
+		freeLiterals();
+		freeRoutines();
+
+		if(statistics)
+		{
+			statistics->reset();
+		}
 	}
 
 	int Assembler::instructionCount()
@@ -317,23 +431,107 @@ namespace SoftWire
 		listingEnabled = false;
 	}
 
+	void Assembler::enableDebugInfo()
+	{
+		Loader::enableDebugInfo(true);
+	}
+
+	void Assembler::disableDebugInfo()
+	{
+		Loader::enableDebugInfo(false);
+	}
+
+	void Assembler::enableHugePages()
+	{
+		Loader::enableHugePages(true);
+	}
+
+	void Assembler::disableHugePages()
+	{
+		Loader::enableHugePages(false);
+	}
+
+	void Assembler::enableDualMapping()
+	{
+		Loader::enableDualMapping(true);
+	}
+
+	void Assembler::disableDualMapping()
+	{
+		Loader::enableDualMapping(false);
+	}
+
+	void Assembler::coldRoutine(bool cold)
+	{
+		if(!loader) return;
+
+		loader->setColdRoutine(cold);
+	}
+
+	int Assembler::codeBytes()
+	{
+		return Loader::getCodeBytes();
+	}
+
+	int Assembler::codePages()
+	{
+		return Loader::getCodePages();
+	}
+
+	int Assembler::hugePages()
+	{
+		return Loader::getHugePages();
+	}
+
+	int Assembler::explicitHugePages()
+	{
+		return Loader::getExplicitHugePages();
+	}
+
+	void Assembler::enableStatistics()
+	{
+		statisticsEnabled = true;
+	}
+
+	void Assembler::disableStatistics()
+	{
+		statisticsEnabled = false;
+	}
+
+	const Statistics *Assembler::getStatistics() const
+	{
+		return statistics;
+	}
+
+	void Assembler::enablePerfMap(bool jitDump)
+	{
+		Loader::enablePerfMap(true);
+		Loader::enableJitDump(jitDump);
+	}
+
+	void Assembler::disablePerfMap()
+	{
+		Loader::enablePerfMap(false);
+		Loader::enableJitDump(false);
+	}
+
 	Encoding *Assembler::x86(int instructionID, const Operand &firstOperand, const Operand &secondOperand, const Operand &thirdOperand)
 	{
 		if(!loader || !synthesizer || !instructionSet) throw INTERNAL_ERROR;
 
+		Statistics::Scope scope(statistics, Statistics::PHASE_INTRINSICS);
+
 		const Instruction *instruction = instructionSet->instruction(instructionID);
 
 		if(echoFile)
 		{
-			FILE *file = fopen(echoFile, "at");
-
-			fprintf(file, "\t%s", instruction->getMnemonic());
-			if(!Operand::isVoid(firstOperand)) fprintf(file, "\t%s", firstOperand.string());
-			if(!Operand::isVoid(secondOperand)) fprintf(file, ",\t%s", secondOperand.string());
-			if(!Operand::isVoid(thirdOperand)) fprintf(file, ",\t%s", thirdOperand.string());
-			fprintf(file, "\n");
+			fprintf(echo, "\t%s", instruction->getMnemonic());
+			if(!Operand::isVoid(firstOperand)) fprintf(echo, "\t%s", firstOperand.string());
+			if(!Operand::isVoid(secondOperand)) fprintf(echo, ",\t%s", secondOperand.string());
+			if(!Operand::isVoid(thirdOperand)) fprintf(echo, ",\t%s", thirdOperand.string());
+			fprintf(echo, "\n");
 
-			fclose(file);
+			echoLine++;
 		}
 
 		synthesizer->reset();
@@ -343,18 +541,98 @@ namespace SoftWire
 		synthesizer->encodeThirdOperand(thirdOperand);
 		const Encoding &encoding = synthesizer->encodeInstruction(instruction);
 
-		return loader->appendEncoding(encoding);
+		Encoding *tail = loader->appendEncoding(encoding);
+
+		if(echoFile)
+		{
+			tail->setLine(echoLine);
+		}
+
+		if(tail->conditionalBranch())
+		{
+			if(instrumented)
+			{
+				increment(addCounter(0, branches));   // Not taken
+			}
+
+			branches++;
+		}
+
+		return tail;
+	}
+
+	void Assembler::emit(const Fixed::Code &code)
+	{
+		if(!loader || !instructionSet) throw INTERNAL_ERROR;
+
+		Statistics::Scope scope(statistics, Statistics::PHASE_INTRINSICS);
+
+		if(!x64 && (code.fields & Encoding::FIELD_REX))
+		{
+			throw Error("Fixed register operand or instruction requires x86-64 mode");
+		}
+
+		if(loader->isDirect() && !echoFile)
+		{
+			loader->appendCode(code.byte, code.length);
+			return;
+		}
+
+		Encoding encoding(instructionSet->instruction(code.instruction));
+		encoding.readCode(code.byte, code.fields);
+
+		if(echoFile)
+		{
+			char bytes[64];
+			encoding.printCode(bytes);
+
+			fprintf(echo, "\t%s\t; %s", encoding.getMnemonic(), bytes);   // Bytes end with newline
+
+			echoLine++;
+		}
+
+		if(loader->isDirect())
+		{
+			loader->appendCode(code.byte, code.length);
+		}
+		else
+		{
+			Encoding *tail = loader->appendEncoding(encoding);
+
+			if(echoFile)
+			{
+				tail->setLine(echoLine);
+			}
+		}
 	}
 
 	void Assembler::label(const char *label)
 	{
 		if(!loader || !synthesizer) return;
 
+		Statistics::Scope scope(statistics, Statistics::PHASE_INTRINSICS);
+
 		if(echoFile)
 		{
-			FILE *file = fopen(echoFile, "at");
-			fprintf(file, "%s:\n", label);
-			fclose(file);
+			fprintf(echo, "%s:\n", label);
+
+			echoLine++;
+		}
+
+		if(profile && strncmp(label, "__", 2) != 0)
+		{
+			weight = profile->blockCount(label);
+
+			if(weight == 0 && !coldRegion)
+			{
+				cold();
+				profileCold = true;
+			}
+			else if(weight != 0 && profileCold)
+			{
+				hot();
+				profileCold = false;
+			}
 		}
 
 		synthesizer->reset();
@@ -363,5 +641,419 @@ namespace SoftWire
 		const Encoding &encoding = synthesizer->encodeInstruction(0);
 
 		loader->appendEncoding(encoding);
+
+		if(instrumented)
+		{
+			increment(addCounter(label, -1));
+		}
+	}
+
+	void Assembler::cold()
+	{
+		if(!loader || coldRegion || loader->isDirect()) return;
+
+		char coldLabel[32];
+		snprintf(coldLabel, 32, "__cold%d", coldBlocks);
+
+		// Keeps fall-through into the cold block, removed by the loader when not needed
+		jmp(coldLabel);
+
+		loader->cold();
+		coldRegion = true;
+
+		label(coldLabel);
+	}
+
+	void Assembler::hot()
+	{
+		if(!loader || !coldRegion) return;
+
+		char hotLabel[32];
+		snprintf(hotLabel, 32, "__hot%d", coldBlocks);
+		coldBlocks++;
+
+		// Return to the hot code, removed by the loader when not needed
+		jmp(hotLabel);
+
+		loader->hot();
+		coldRegion = false;
+
+		label(hotLabel);
+	}
+
+	void Assembler::instrument(bool enable)
+	{
+		instrumented = enable;
+		entry = 0;
+	}
+
+	void Assembler::useProfile(const Assembler *profiled)
+	{
+		profile = profiled;
+		weight = -1;
+	}
+
+	int Assembler::blockCount(const char *label) const
+	{
+		int count = -1;
+
+		for(const Link<Counter> *counter = counters; counter; counter = counter->next())
+		{
+			if(counter->label && strcmp(counter->label, label) == 0)
+			{
+				count = (count == -1 ? 0 : count) + counter->count;
+			}
+		}
+
+		return count;
+	}
+
+	int Assembler::branchCount(int branch, bool taken) const
+	{
+		for(const Link<Counter> *counter = counters; counter; counter = counter->next())
+		{
+			if(!counter->label && counter->branch == branch)
+			{
+				if(!taken)
+				{
+					return counter->count;
+				}
+				else if(counter->entry)
+				{
+					return *counter->entry - counter->count;
+				}
+
+				return -1;
+			}
+		}
+
+		return -1;
+	}
+
+	int Assembler::profileWeight() const
+	{
+		return weight;
+	}
+
+	Assembler::Counter *Assembler::addCounter(const char *label, int branch)
+	{
+		Counter counter;
+
+		counter.label = strdup(label);
+		counter.branch = branch;
+		counter.count = 0;
+		counter.entry = label ? 0 : entry;
+
+		if(!counters) counters = new Link<Counter>();
+		Counter *tail = counters->append(counter);
+		Statistics::allocation(sizeof(Link<Counter>) + (label ? (int)strlen(label) + 1 : 0));
+
+		entry = &tail->count;   // Code up to the next counter runs as often
+
+		return tail;
+	}
+
+	void Assembler::increment(Counter *counter)
+	{
+		// Flags can be live across labels and branches, skip the red zone below the stack pointer to save them
+		if(x64) Assembler::lea(rsp, qword_ptr [rsp-128]);
+		Assembler::pushf();
+		Assembler::inc(dword_ptr [&counter->count]);
+		Assembler::popf();
+		if(x64) Assembler::lea(rsp, qword_ptr [rsp+128]);
+	}
+
+	void Assembler::freeCounters()
+	{
+		for(Link<Counter> *counter = counters; counter; counter = counter->next())
+		{
+			delete[] counter->label;
+			counter->label = 0;
+		}
+
+		delete counters;
+		counters = 0;
+	}
+
+	OperandREF Assembler::literal(const void *data, int size)
+	{
+		if(literalsPlaced) throw Error("Literal pool already placed after the code");
+		if(size <= 0) throw Error("Literal of %d bytes", size);
+
+		for(Link<Literal> *literal = literals; literal; literal = literal->next())
+		{
+			if(!literal->slot && literal->size == size && memcmp(literal->data, data, size) == 0)
+			{
+				return OperandREF(literal->label);
+			}
+		}
+
+		return OperandREF(addLiteral(data, size)->label);
+	}
+
+	Assembler::Literal *Assembler::addLiteral(const void *data, int size)
+	{
+		Literal literal;
+
+		char label[32];
+		snprintf(label, 32, "__literal%d", literalCount++);
+
+		literal.label = strdup(label);
+		literal.data = new unsigned char[size];
+		memcpy(literal.data, data, size);
+		literal.size = size;
+		literal.slot = 0;
+		literal.address = 0;
+
+		if(!literals) literals = new Link<Literal>();
+		Statistics::allocation(sizeof(Link<Literal>) + (int)strlen(label) + 1 + size);
+
+		return literals->append(literal);
+	}
+
+	OperandREF Assembler::literal(__int64 constant)
+	{
+		return literal(&constant, 8);
+	}
+
+	OperandREF Assembler::slot(const char *name, const void *target)
+	{
+		for(Link<Literal> *literal = literals; literal; literal = literal->next())
+		{
+			if(literal->slot && strcmp(literal->slot, name) == 0)
+			{
+				redirect(name, target);
+
+				return OperandREF(literal->label);
+			}
+		}
+
+		if(literalsPlaced) throw Error("Literal pool already placed after the code");
+
+		__int64 pointer = (__int64)target;
+		Literal *slot = addLiteral(&pointer, x64 ? 8 : 4);
+		slot->slot = strdup(name);
+		Statistics::allocation((int)strlen(name) + 1);
+
+		return OperandREF(slot->label);
+	}
+
+	void Assembler::redirect(const char *name, const void *target)
+	{
+		for(Link<Literal> *literal = literals; literal; literal = literal->next())
+		{
+			if(literal->slot && strcmp(literal->slot, name) == 0)
+			{
+				__int64 pointer = (__int64)target;
+				memcpy(literal->data, &pointer, literal->size);
+
+				if(literal->address)   // Aligned, so the store is atomic
+				{
+					unsigned char *address = Loader::writable(literal->address);
+
+					if(literal->size == 8) *(volatile __int64*)address = pointer;
+					else *(volatile int*)address = (int)pointer;
+				}
+
+				return;
+			}
+		}
+
+		throw Error("Slot '%s' not found", name);
+	}
+
+	void Assembler::placeLiterals()
+	{
+		if(literalsPlaced || !synthesizer) return;
+
+		literalsPlaced = true;
+
+		bool counting = instrumented;   // Data is not a block
+		instrumented = false;
+
+		for(Link<Literal> *literal = literals; literal; literal = literal->next())
+		{
+			align(literal->size >= 16 ? 16 : literal->size >= 8 ? 8 : 4);
+			label(literal->label);
+
+			int i = 0;
+
+			for(; i + 4 <= literal->size; i += 4)
+			{
+				dd(*(unsigned int*)&literal->data[i]);
+			}
+
+			for(; i < literal->size; i++)
+			{
+				db(literal->data[i]);
+			}
+		}
+
+		instrumented = counting;
+	}
+
+	void Assembler::locateSlots()
+	{
+		if(!loader) return;
+
+		for(Link<Literal> *literal = literals; literal; literal = literal->next())
+		{
+			if(literal->slot && !literal->address)
+			{
+				literal->address = (void*)loader->callable(literal->label);
+			}
+		}
+	}
+
+	void Assembler::freeLiterals()
+	{
+		for(Link<Literal> *literal = literals; literal; literal = literal->next())
+		{
+			delete[] literal->label;
+			delete[] literal->data;
+			delete[] literal->slot;
+			literal->label = 0;
+			literal->data = 0;
+			literal->slot = 0;
+		}
+
+		delete literals;
+		literals = 0;
+		literalCount = 0;
+		literalsPlaced = false;
+	}
+
+	void Assembler::routine(const char *name)
+	{
+		if(literalsPlaced) throw Error("Routine '%s' defined after loading", name);
+
+		for(Link<Routine> *routine = routines; routine; routine = routine->next())
+		{
+			if(strcmp(routine->name, name) == 0)
+			{
+				throw Error("Routine '%s' already defined", name);
+			}
+		}
+
+		Routine routine;
+		routine.name = strdup(name);
+		routine.entry = 0;
+
+		if(!routines) routines = new Link<Routine>();
+		routines->append(routine);
+		Statistics::allocation(sizeof(Link<Routine>) + (int)strlen(name) + 1);
+		routineNumber++;
+
+		if(routineNumber > 1)
+		{
+			align(16);
+		}
+
+		label(name);
+	}
+
+	int Assembler::routineCount() const
+	{
+		return routineNumber;
+	}
+
+	void (*Assembler::entryPoint(const char *name) const)()
+	{
+		for(Link<Routine> *routine = routines; routine; routine = routine->next())
+		{
+			if(strcmp(routine->name, name) == 0)
+			{
+				return routine->entry;
+			}
+		}
+
+		throw Error("Routine '%s' not found", name);
+	}
+
+	void (*Assembler::entryPoint(int index) const)()
+	{
+		Link<Routine> *routine = routines;
+
+		for(int i = 0; routine && i < index; i++)
+		{
+			routine = routine->next();
+		}
+
+		if(index < 0 || !routine)
+		{
+			throw Error("Routine %d not found", index);
+		}
+
+		return routine->entry;
+	}
+
+	void Assembler::locateRoutines()
+	{
+		if(!loader) return;
+
+		for(Link<Routine> *routine = routines; routine; routine = routine->next())
+		{
+			if(!routine->entry)
+			{
+				routine->entry = loader->callable(routine->name);
+			}
+		}
+	}
+
+	void Assembler::freeRoutines()
+	{
+		for(Link<Routine> *routine = routines; routine; routine = routine->next())
+		{
+			delete[] routine->name;
+			routine->name = 0;
+		}
+
+		delete routines;
+		routines = 0;
+		routineNumber = 0;
+	}
+
+	void Assembler::emitDirect(int capacity)
+	{
+		if(!loader) return;
+
+		loader->setDirect(capacity);
+	}
+
+	void Assembler::alignLoops(int alignment, bool crossingOnly)
+	{
+		if(!loader) return;
+
+		loader->setLoopAlignment(alignment, crossingOnly);
+	}
+
+	int Assembler::paddingBytes() const
+	{
+		if(!loader)
+		{
+			return 0;
+		}
+
+		return loader->getPaddingBytes();
+	}
+
+	int Assembler::alignedLoops() const
+	{
+		if(!loader)
+		{
+			return 0;
+		}
+
+		return loader->getAlignedLoops();
+	}
+
+	int Assembler::veneerCalls() const
+	{
+		if(!loader)
+		{
+			return 0;
+		}
+
+		return loader->getVeneerCalls();
 	}
 };
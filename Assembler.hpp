@@ -2,6 +2,11 @@
 #define SoftWire_Assembler_hpp
 
 #include "Operand.hpp"
+#include "Fixed.hpp"
+#include "Link.hpp"
+#include "Loader.hpp"
+
+#include <stdio.h>
 
 namespace SoftWire
 {
@@ -11,9 +16,12 @@ namespace SoftWire
 	class Loader;
 	class Error;
 	class InstructionSet;
+	class Statistics;
 
 	class Assembler
 	{
+		friend class CodeCache;
+
 	public:
 		Assembler(bool x64);
 
@@ -23,6 +31,48 @@ namespace SoftWire
 		void label(const char *label);
 		#include "Intrinsics.hpp"
 
+		// Compile-time encoded instruction, like emit(Fixed::add(Fixed::eax, Fixed::ebx)), copied as is
+		void emit(const Fixed::Code &code);
+
+		// Constant pool placed after the code of this routine, addressed RIP-relative in x86-64 mode
+		OperandREF literal(const void *data, int size);   // Copied, identical constants are shared
+		OperandREF literal(__int64 constant);   // Also far addresses, like mov(rax, qword_ptr [literal((__int64)pointer)])
+
+		// Patchable call and jump target, an aligned pointer in the literal pool shared by all uses of the name,
+		// like call(qword_ptr [slot("shade", shade)]). Redirecting is a single atomic store, safe while other
+		// threads execute the code.
+		OperandREF slot(const char *name, const void *target);
+		void redirect(const char *name, const void *target);   // Before or after loading
+
+		// Module of several routines in one code buffer, sharing the literal pool. Calls between routines by
+		// name, like call("blend"), are direct. Entry points are retrieved after loading, also once finalized.
+		void routine(const char *name);   // Starts the next routine, aligned
+		int routineCount() const;
+		void (*entryPoint(const char *name) const)();   // 0 before loading
+		void (*entryPoint(int index) const)();          // In order of definition
+
+		// Code placement, cold code is moved after all hot code
+		void cold();   // Following code is rarely executed
+		void hot();    // Default
+
+		// Encode each instruction straight into a code buffer of fixed capacity, for small stubs. There is no
+		// layout pass: cold code and loop alignment don't apply, optimizations can't remove emitted
+		// instructions, and there is no listing. Emitted instructions can't be patched afterwards, so register
+		// allocation and code generation reject it.
+		virtual void emitDirect(int capacity = 4096);   // Bytes, before the first instruction, 0 to disable
+
+		// Loop header alignment, padding with NOPs
+		void alignLoops(int alignment = 16, bool crossingOnly = false);   // Alignment 0 disables
+		int paddingBytes() const;
+		int alignedLoops() const;
+		int veneerCalls() const;   // Far calls and jumps through a stub in x86-64 mode
+
+		// Profiling, instrumented code counts block entries and branches not taken
+		void instrument(bool enable = true);   // Counters at labels and after branches keep flags intact
+		void useProfile(const Assembler *profiled);   // Blocks never entered are placed in cold code
+		int blockCount(const char *label) const;   // -1 if not counted
+		int branchCount(int branch, bool taken) const;   // Of n-th conditional branch, -1 if not counted
+
 		// Retrieve binary code
 		void (*callable(const char *entryLabel = 0))();
 		void (*finalize(const char *entryLable = 0))();
@@ -31,6 +81,9 @@ namespace SoftWire
 		// Error and debugging methods
 		const char *getListing() const;
 		void clearListing() const;
+		void streamListing(ListingCallback callback, void *data = 0) const;   // No listing buffer
+		void writeListing(int fd) const;
+		void retainListing(bool retain = true);   // Listing stays available after finalize
 		void setEchoFile(const char *echoFile, const char *mode = "wt");
 		void annotate(const char *format, ...);
 		void reset();
@@ -39,6 +92,36 @@ namespace SoftWire
 		static void enableListing();   // Default on
 		static void disableListing();
 
+		// Linux perf symbols for generated code, using label names
+		static void enablePerfMap(bool jitDump = false);   // Default off
+		static void disablePerfMap();
+
+		// Executable memory from 2 MB pages for routines loaded afterwards, packed densely and never freed, so
+		// acquired code must not be deleted. Explicit huge pages when reserved, else transparent huge pages.
+		static void enableHugePages();   // Default off
+		static void disableHugePages();
+		void coldRoutine(bool cold = true);   // Kept apart from hot routines in huge pages
+
+		// Code mapped twice from a Linux memfd for routines loaded afterwards, a writable view for emission and an
+		// executable one for running, so no page is writable and executable. Acquired code must not be deleted.
+		static void enableDualMapping();   // Default off
+		static void disableDualMapping();
+
+		// Executable memory of all routines loaded so far, to compare i-TLB coverage
+		static int codeBytes();
+		static int codePages();   // 4 KB pages spanned, counted per routine outside huge pages
+		static int hugePages();   // Of the arena
+		static int explicitHugePages();
+
+		// GDB JIT interface registration of finalized code, with echo file line table
+		static void enableDebugInfo();   // Default off
+		static void disableDebugInfo();
+
+		// Per-phase compilation time, calls and heap allocations, for Assemblers constructed afterwards
+		static void enableStatistics();   // Default off
+		static void disableStatistics();
+		const Statistics *getStatistics() const;   // 0 if not collected, kept after finalize
+
 		static const OperandAL al;
 		static const OperandCL cl;
 		static const OperandREG8 dl;
@@ -181,8 +264,12 @@ namespace SoftWire
 		                      const Operand &secondOperand = Operand::OPERAND_VOID,
 		                      const Operand &thirdOperand = Operand::OPERAND_VOID);   // Assemble run-time intrinsic
 
+		int profileWeight() const;   // Profiled entries of the current block, -1 if unknown
+
 		const bool x64;
 
+		Statistics *statistics;   // 0 unless enabled
+
 	private:
 		char *entryLabel;
 
@@ -194,8 +281,68 @@ namespace SoftWire
 		Loader *loader;
 
 		char *echoFile;
+		FILE *echo;
+		int echoLine;
+
+		void closeEcho();
+
+		bool coldRegion;
+		int coldBlocks;
+
+		struct Counter
+		{
+			char *label;   // Block entry, or 0 for branch
+			int branch;
+			int count;
+			const int *entry;   // Executions of the block containing the branch
+		};
+
+		Link<Counter> *counters;
+		bool instrumented;
+		int branches;
+		const int *entry;   // Last counter emitted
+
+		const Assembler *profile;
+		bool profileCold;   // Cold region entered because of profile
+		int weight;
+
+		Counter *addCounter(const char *label, int branch);
+		void increment(Counter *counter);
+		void freeCounters();
+
+		struct Literal
+		{
+			char *label;
+			unsigned char *data;
+			int size;
+
+			char *slot;       // Name of patchable slot, not shared with constants
+			void *address;   // Of slot once loaded
+		};
+
+		struct Routine
+		{
+			char *name;
+			void (*entry)();
+		};
+
+		Link<Routine> *routines;
+		int routineNumber;
+
+		Link<Literal> *literals;
+		int literalCount;
+		bool literalsPlaced;
+
+		Literal *addLiteral(const void *data, int size);
+		void placeLiterals();   // Before loading
+		void locateSlots();
+		void freeLiterals();
+
+		void locateRoutines();
+		void freeRoutines();
 
 		static bool listingEnabled;
+		static bool statisticsEnabled;
 	};
 }
 
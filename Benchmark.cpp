@@ -0,0 +1,856 @@
+#include "CodeGenerator.hpp"
+#include "Static.hpp"
+#include "Statistics.hpp"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef WIN32
+	#include <windows.h>
+#else
+	#include <time.h>
+#endif
+
+#ifdef __linux__
+	#include <linux/perf_event.h>
+	#include <sys/ioctl.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+#endif
+
+// Non-interactive measurements of JIT latency and generated code quality, written as JSON to stdout
+
+const bool x64 = sizeof(void*) == 8;
+
+double seconds()
+{
+	#ifdef WIN32
+		LARGE_INTEGER counter;
+		LARGE_INTEGER frequency;
+		QueryPerformanceCounter(&counter);
+		QueryPerformanceFrequency(&frequency);
+
+		return (double)counter.QuadPart / (double)frequency.QuadPart;
+	#else
+		timespec t;
+		clock_gettime(CLOCK_MONOTONIC, &t);
+
+		return t.tv_sec + t.tv_nsec * 1e-9;
+	#endif
+}
+
+// Kernel arguments, passed by pointer so generated code makes no absolute references
+struct Parameters
+{
+	void *source;
+	void *mask;
+	void *destination;
+	float a;
+	int bytes;
+};
+
+static Parameters parameters;
+
+template<class Assembler>
+void emitRoutine(Assembler &x86, int instructions)
+{
+	for(int i = 0; i < instructions; i++)
+	{
+		switch(i % 8)
+		{
+		case 0: x86.mov(x86.eax, x86.dword_ptr [x86.esi+x86.ecx*4+16]); break;
+		case 1: x86.add(x86.eax, x86.edx);                              break;
+		case 2: x86.imul(x86.edx, x86.eax, 12);                         break;
+		case 3: x86.mov(x86.dword_ptr [x86.edi+x86.ecx*4], x86.edx);    break;
+		case 4: x86.movaps(x86.xmm0, x86.xword_ptr [x86.esi+x86.edx]);  break;
+		case 5: x86.mulps(x86.xmm0, x86.xmm1);                          break;
+		case 6: x86.cmp(x86.ecx, 1000);                                 break;
+		case 7: x86.jne("next");                                        break;
+		}
+	}
+
+	x86.label("next");
+	x86.ret();
+}
+
+// Register operands only, through the run-time intrinsics or encoded at compile time
+void emitRegisters(SoftWire::Assembler &x86, int instructions)
+{
+	for(int i = 0; i < instructions; i++)
+	{
+		switch(i % 8)
+		{
+		case 0: x86.mov(x86.eax, x86.edx);     break;
+		case 1: x86.add(x86.eax, x86.ecx);     break;
+		case 2: x86.imul(x86.edx, x86.eax);    break;
+		case 3: x86.sub(x86.edx, 12);          break;
+		case 4: x86.shl(x86.eax, 2);           break;
+		case 5: x86.mulps(x86.xmm0, x86.xmm1); break;
+		case 6: x86.addps(x86.xmm0, x86.xmm2); break;
+		case 7: x86.xor(x86.ecx, x86.eax);     break;
+		}
+	}
+
+	x86.ret();
+}
+
+void emitFixed(SoftWire::Assembler &x86, int instructions)
+{
+	using namespace SoftWire::Fixed;
+
+	for(int i = 0; i < instructions; i++)
+	{
+		switch(i % 8)
+		{
+		case 0: x86.emit(mov(eax, edx));     break;
+		case 1: x86.emit(add(eax, ecx));     break;
+		case 2: x86.emit(imul(edx, eax));    break;
+		case 3: x86.emit(sub(edx, 12));      break;
+		case 4: x86.emit(shl(eax, 2));       break;
+		case 5: x86.emit(mulps(xmm0, xmm1)); break;
+		case 6: x86.emit(addps(xmm0, xmm2)); break;
+		case 7: x86.emit(xor(ecx, eax));     break;
+		}
+	}
+
+	x86.emit(ret());
+}
+
+void benchmarkIntrinsics()
+{
+	const int instructions = 1 << 18;
+
+	SoftWire::Assembler x86(x64);
+
+	double start = seconds();
+	emitRoutine(x86, instructions);
+	double time = seconds() - start;
+
+	printf("\t\"intrinsics\": {\"instructions\": %d, \"seconds\": %.6f, \"instructionsPerSecond\": %.0f},\n", instructions, time, instructions / time);
+}
+
+void benchmarkLoading()
+{
+	printf("\t\"loading\": [\n");
+
+	for(int instructions = 16; instructions <= 16384; instructions *= 4)
+	{
+		SoftWire::Assembler x86(x64);
+		emitRoutine(x86, instructions);
+
+		double start = seconds();
+		x86.callable();
+		double callableTime = seconds() - start;
+
+		SoftWire::Assembler y86(x64);
+		emitRoutine(y86, instructions);
+
+		start = seconds();
+		y86.finalize();
+		double finalizeTime = seconds() - start;
+
+		printf("\t\t{\"instructions\": %d, \"callableSeconds\": %.6f, \"finalizeSeconds\": %.6f}%s\n",
+		       instructions, callableTime, finalizeTime, instructions < 16384 ? "," : "");
+	}
+
+	printf("\t],\n");
+}
+
+// Small stubs, emitted into the Encoding list and laid out, or encoded straight into the code buffer
+void benchmarkDirect()
+{
+	const int routines = 1000;
+
+	SoftWire::Assembler keep(x64);   // Keeps the shared instruction set
+
+	printf("\t\"direct\": [\n");
+
+	for(int instructions = 8; instructions <= 512; instructions *= 4)
+	{
+		double start = seconds();
+
+		for(int i = 0; i < routines; i++)
+		{
+			SoftWire::Assembler x86(x64);
+			emitRoutine(x86, instructions);
+			x86.finalize();
+		}
+
+		double listTime = (seconds() - start) / routines;
+
+		start = seconds();
+
+		for(int i = 0; i < routines; i++)
+		{
+			SoftWire::Assembler x86(x64);
+			x86.emitDirect(instructions * 16 + 16);
+			emitRoutine(x86, instructions);
+			x86.finalize();
+		}
+
+		double directTime = (seconds() - start) / routines;
+
+		printf("\t\t{\"instructions\": %d, \"listSeconds\": %.9f, \"directSeconds\": %.9f, \"ratio\": %.3f}%s\n",
+		       instructions, listTime, directTime, directTime / listTime, instructions < 512 ? "," : "");
+	}
+
+	printf("\t],\n");
+}
+
+// Run-time intrinsics against compile-time encoded ones, appended to the Encoding list or the code buffer
+void benchmarkFixed()
+{
+	const int instructions = 1 << 16;
+
+	printf("\t\"fixed\": [\n");
+
+	for(int direct = 0; direct < 2; direct++)
+	{
+		double time[2];
+
+		for(int fixed = 0; fixed < 2; fixed++)
+		{
+			SoftWire::Assembler x86(x64);
+			if(direct) x86.emitDirect(instructions * 8 + 16);
+
+			double start = seconds();
+			if(fixed) emitFixed(x86, instructions);
+			else emitRegisters(x86, instructions);
+			time[fixed] = seconds() - start;
+		}
+
+		printf("\t\t{\"direct\": %s, \"instructions\": %d, \"intrinsicSeconds\": %.6f, \"fixedSeconds\": %.6f, \"ratio\": %.3f}%s\n",
+		       direct ? "true" : "false", instructions, time[0], time[1], time[1] / time[0], direct ? "" : ",");
+	}
+
+	printf("\t],\n");
+}
+
+// Virtually dispatched intrinsics against statically composed ones
+void benchmarkStatic()
+{
+	const int instructions = 1 << 18;
+
+	double time[2];
+
+	{
+		SoftWire::Assembler x86(x64);
+
+		double start = seconds();
+		emitRoutine(x86, instructions);
+		time[0] = seconds() - start;
+	}
+
+	{
+		SoftWire::Static<SoftWire::Assembler> x86(x64);
+
+		double start = seconds();
+		emitRoutine(x86, instructions);
+		time[1] = seconds() - start;
+	}
+
+	printf("\t\"static\": {\"instructions\": %d, \"virtualSeconds\": %.6f, \"staticSeconds\": %.6f, \"ratio\": %.3f},\n", instructions, time[0], time[1], time[1] / time[0]);
+}
+
+// Random copies, additions and spills of sixteen variables, like the interactive optimization stress test
+class StressWorkload : public SoftWire::CodeGenerator
+{
+public:
+	StressWorkload(int tests, int seed) : CodeGenerator(::x64)   // void f(int *x)
+	{
+		// Allocation uses callee-saved registers, variables are addressed through EBP
+		if(x64)
+		{
+			push(rbp);
+			push(rsi);
+			push(rdi);
+			push(rbx);
+
+			#ifdef WIN32
+				mov(rbp, rcx);
+			#else
+				mov(rbp, rdi);
+			#endif
+		}
+		else
+		{
+			push(ebp);
+			push(esi);
+			push(edi);
+			push(ebx);
+
+			mov(ebp, dword_ptr [esp+20]);
+		}
+
+		srand(seed);
+
+		for(int i = 0; i < tests; i++)
+		{
+			mov(r(), r());
+			if(i % 3 == 0 && rand() < RAND_MAX / 2) add(r(), r());
+
+			add(r(), r());
+			if(i % 3 == 0 && rand() < RAND_MAX / 2) spill(r());
+
+			if(q() < q() / 2) add(r(), r());
+			if(q() < q() / 2) mov(r(), r());
+			if(q() < q() / 2) spill(r());
+		}
+
+		spillAll();
+
+		if(x64)
+		{
+			pop(rbx);
+			pop(rdi);
+			pop(rsi);
+			pop(rbp);
+		}
+		else
+		{
+			pop(ebx);
+			pop(edi);
+			pop(esi);
+			pop(ebp);
+		}
+
+		ret();
+	}
+
+	const SoftWire::OperandREG32 r()
+	{
+		return r32(ebp + 4 * q());
+	}
+
+	int q()
+	{
+		return rand() % 16;
+	}
+
+	static int x[16];
+};
+
+int StressWorkload::x[16];
+
+void configure(bool copyPropagation, bool loadElimination, bool spillElimination, bool minimalRestore, bool dropUnmodified)
+{
+	if(copyPropagation) SoftWire::RegisterAllocator::enableCopyPropagation(); else SoftWire::RegisterAllocator::disableCopyPropagation();
+	if(loadElimination) SoftWire::RegisterAllocator::enableLoadElimination(); else SoftWire::RegisterAllocator::disableLoadElimination();
+	if(spillElimination) SoftWire::RegisterAllocator::enableSpillElimination(); else SoftWire::RegisterAllocator::disableSpillElimination();
+	if(minimalRestore) SoftWire::RegisterAllocator::enableMinimalRestore(); else SoftWire::RegisterAllocator::disableMinimalRestore();
+	if(dropUnmodified) SoftWire::RegisterAllocator::enableDropUnmodified(); else SoftWire::RegisterAllocator::disableDropUnmodified();
+}
+
+void benchmarkAllocator()
+{
+	struct Configuration
+	{
+		const char *name;
+		bool flags[5];
+	};
+
+	const Configuration configurations[] =
+	{
+		{"optimized",                {true, true, true, true, true}},
+		{"noCopyPropagation",        {false, true, true, true, true}},
+		{"noLoadElimination",        {true, false, true, true, true}},
+		{"noSpillElimination",       {true, true, false, true, true}},
+		{"noDropUnmodified",         {true, true, true, true, false}},
+		{"unoptimized",              {false, false, false, false, false}}
+	};
+
+	const int count = sizeof(configurations) / sizeof(Configuration);
+
+	printf("\t\"allocator\": [\n");
+
+	SoftWire::Assembler::enableStatistics();
+
+	for(int i = 0; i < count; i++)
+	{
+		const bool *flags = configurations[i].flags;
+		configure(flags[0], flags[1], flags[2], flags[3], flags[4]);
+
+		StressWorkload workload(1024, 0);
+		workload.callable();
+
+		const SoftWire::Statistics *statistics = workload.getStatistics();
+
+		printf("\t\t{\"configuration\": \"%s\", \"instructions\": %d, \"eliminated\": %d, \"bytes\": %d, \"spills\": %d, \"reloads\": %d, \"allocationSeconds\": %.6f}%s\n",
+		       configurations[i].name, statistics->getInstructions(), statistics->getEliminated(), statistics->getBytes(),
+		       statistics->getSpills(), statistics->getReloads(), statistics->getTime(SoftWire::Statistics::PHASE_ALLOCATION), i < count - 1 ? "," : "");
+	}
+
+	SoftWire::Assembler::disableStatistics();
+	configure(true, true, true, true, true);
+
+	printf("\t],\n");
+}
+
+// Loads a pointer member of the kernel arguments in EDX, full register width
+void loadPointer(SoftWire::Assembler &x86, const SoftWire::OperandREG32 &r32, int offset)
+{
+	if(x64) x86.mov(SoftWire::OperandREG64(r32.reg), x86.qword_ptr [x86.edx+offset]);
+	else    x86.mov(r32, x86.dword_ptr [x86.edx+offset]);
+}
+
+// Saves callee-saved registers used by kernels, leaves the Parameters pointer in EDX
+void enterKernel(SoftWire::Assembler &x86)
+{
+	if(x64)
+	{
+		#ifdef WIN32
+			x86.mov(x86.rdx, x86.rcx);
+		#else
+			x86.mov(x86.rdx, x86.rdi);
+		#endif
+
+		x86.push(x86.rsi);
+		x86.push(x86.rdi);
+		x86.push(x86.rbx);
+	}
+	else
+	{
+		x86.mov(x86.edx, x86.dword_ptr [x86.esp+4]);
+
+		x86.push(x86.esi);
+		x86.push(x86.edi);
+		x86.push(x86.ebx);
+	}
+
+	loadPointer(x86, x86.esi, (int)offsetof(Parameters, source));
+	loadPointer(x86, x86.ebx, (int)offsetof(Parameters, mask));
+	loadPointer(x86, x86.edi, (int)offsetof(Parameters, destination));
+	x86.mov(x86.ecx, x86.dword_ptr [x86.edx+(int)offsetof(Parameters, bytes)]);
+}
+
+void leaveKernel(SoftWire::Assembler &x86)
+{
+	if(x64)
+	{
+		x86.pop(x86.rbx);
+		x86.pop(x86.rdi);
+		x86.pop(x86.rsi);
+	}
+	else
+	{
+		x86.pop(x86.ebx);
+		x86.pop(x86.edi);
+		x86.pop(x86.esi);
+	}
+
+	x86.ret();
+}
+
+typedef void (*Kernel)(const Parameters *parameters);
+
+// y = a * x + y, four floats per iteration
+Kernel saxpyKernel(SoftWire::Assembler &x86)
+{
+	enterKernel(x86);
+
+	x86.movss(x86.xmm0, x86.dword_ptr [x86.edx+(int)offsetof(Parameters, a)]);
+	x86.shufps(x86.xmm0, x86.xmm0, 0x00);
+	x86.xor(x86.edx, x86.edx);
+
+	x86.label("loop");
+	x86.movaps(x86.xmm1, x86.xword_ptr [x86.esi+x86.edx]);
+	x86.mulps(x86.xmm1, x86.xmm0);
+	x86.addps(x86.xmm1, x86.xword_ptr [x86.edi+x86.edx]);
+	x86.movaps(x86.xword_ptr [x86.edi+x86.edx], x86.xmm1);
+	x86.add(x86.edx, 16);
+	x86.cmp(x86.edx, x86.ecx);
+	x86.jb("loop");
+
+	leaveKernel(x86);
+
+	return (Kernel)x86.callable();
+}
+
+void saxpyNative(float a, const float *x, float *y, int n)
+{
+	for(int i = 0; i < n; i++)
+	{
+		y[i] = a * x[i] + y[i];
+	}
+}
+
+// y = (x & m) | (y & ~m), one dword per iteration
+Kernel blendKernel(SoftWire::Assembler &x86)
+{
+	enterKernel(x86);
+	x86.xor(x86.edx, x86.edx);
+
+	x86.label("loop");
+	x86.mov(x86.eax, x86.dword_ptr [x86.esi+x86.edx]);
+	x86.xor(x86.eax, x86.dword_ptr [x86.edi+x86.edx]);
+	x86.and(x86.eax, x86.dword_ptr [x86.ebx+x86.edx]);
+	x86.xor(x86.dword_ptr [x86.edi+x86.edx], x86.eax);
+	x86.add(x86.edx, 4);
+	x86.cmp(x86.edx, x86.ecx);
+	x86.jb("loop");
+
+	leaveKernel(x86);
+
+	return (Kernel)x86.callable();
+}
+
+void blendNative(const int *x, const int *m, int *y, int n)
+{
+	for(int i = 0; i < n; i++)
+	{
+		y[i] = (x[i] & m[i]) | (y[i] & ~m[i]);
+	}
+}
+
+// Copy 32 bytes per iteration
+Kernel copyKernel(SoftWire::Assembler &x86)
+{
+	enterKernel(x86);
+	x86.xor(x86.edx, x86.edx);
+
+	x86.label("loop");
+	x86.movaps(x86.xmm0, x86.xword_ptr [x86.esi+x86.edx]);
+	x86.movaps(x86.xmm1, x86.xword_ptr [x86.esi+x86.edx+16]);
+	x86.movaps(x86.xword_ptr [x86.edi+x86.edx], x86.xmm0);
+	x86.movaps(x86.xword_ptr [x86.edi+x86.edx+16], x86.xmm1);
+	x86.add(x86.edx, 32);
+	x86.cmp(x86.edx, x86.ecx);
+	x86.jb("loop");
+
+	leaveKernel(x86);
+
+	return (Kernel)x86.callable();
+}
+
+void copyNative(const char *source, char *destination, int bytes)
+{
+	for(int i = 0; i < bytes; i++)
+	{
+		destination[i] = source[i];
+	}
+}
+
+// Best of several runs, each repeating the routine
+double bestTime(Kernel routine, int repetitions)
+{
+	double best = 1e30;
+
+	for(int run = 0; run < 8; run++)
+	{
+		double start = seconds();
+
+		for(int i = 0; i < repetitions; i++)
+		{
+			routine(&parameters);
+		}
+
+		double time = (seconds() - start) / repetitions;
+
+		if(time < best) best = time;
+	}
+
+	return best;
+}
+
+const int elements = 4096;
+static float *x;
+static float *y;
+static int *m;
+static int *z;
+
+void saxpy(const Parameters *parameters) {saxpyNative(parameters->a, (float*)parameters->source, (float*)parameters->destination, elements);}
+void blend(const Parameters *parameters) {blendNative((int*)parameters->source, (int*)parameters->mask, (int*)parameters->destination, elements);}
+void copy(const Parameters *parameters) {copyNative((char*)parameters->source, (char*)parameters->destination, parameters->bytes);}
+
+void initialize()
+{
+	for(int i = 0; i < elements; i++)
+	{
+		x[i] = (float)i;
+		y[i] = (float)(elements - i);
+		m[i] = (i & 1) ? 0xFFFFFFFF : 0x00000000;
+		z[i] = i;
+	}
+}
+
+void benchmarkKernel(const char *name, Kernel generated, Kernel native, bool last)
+{
+	const int repetitions = 1000;
+
+	// Same results from a single run
+	static int result[elements];
+
+	initialize();
+	generated(&parameters);
+	memcpy(result, parameters.destination, sizeof(result));
+
+	initialize();
+	native(&parameters);
+	bool correct = memcmp(result, parameters.destination, sizeof(result)) == 0;
+
+	double generatedTime = bestTime(generated, repetitions);
+	double nativeTime = bestTime(native, repetitions);
+
+	printf("\t\t{\"kernel\": \"%s\", \"elements\": %d, \"correct\": %s, \"generatedSeconds\": %.9f, \"nativeSeconds\": %.9f, \"ratio\": %.3f}%s\n",
+	       name, elements, correct ? "true" : "false", generatedTime, nativeTime, generatedTime / nativeTime, last ? "" : ",");
+}
+
+void benchmarkKernels()
+{
+	// 16-byte aligned arrays
+	char *memory = new char[4 * elements * 4 + 16];
+	x = (float*)(((size_t)memory + 15) & ~(size_t)15);
+	y = x + elements;
+	m = (int*)(y + elements);
+	z = m + elements;
+
+	parameters.a = 0.5f;
+	parameters.bytes = elements * 4;
+
+	SoftWire::Assembler saxpyAssembler(x64);
+	SoftWire::Assembler blendAssembler(x64);
+	SoftWire::Assembler copyAssembler(x64);
+
+	Kernel saxpyGenerated = saxpyKernel(saxpyAssembler);
+	Kernel blendGenerated = blendKernel(blendAssembler);
+	Kernel copyGenerated = copyKernel(copyAssembler);
+
+	printf("\t\"kernels\": [\n");
+
+	parameters.source = x;
+	parameters.destination = y;
+	benchmarkKernel("saxpy", saxpyGenerated, saxpy, false);
+
+	parameters.source = x;
+	parameters.mask = m;
+	parameters.destination = z;
+	benchmarkKernel("blend", blendGenerated, blend, false);
+
+	parameters.source = x;
+	parameters.destination = y;
+	benchmarkKernel("copy", copyGenerated, copy, true);
+
+	printf("\t],\n");
+
+	delete[] memory;
+}
+
+// Per-call hardware counters through perf_event_open, unavailable counters are reported as null
+class Counters
+{
+public:
+	enum
+	{
+		CYCLES,
+		INSTRUCTIONS,
+		BRANCH_MISSES,
+		CACHE_MISSES,
+		TASK_CLOCK,   // Nanoseconds, software counter
+
+		COUNT
+	};
+
+	Counters()
+	{
+		for(int i = 0; i < COUNT; i++)
+		{
+			fd[i] = -1;
+			overhead[i] = 0;
+		}
+
+		#ifdef __linux__
+			const unsigned int type[COUNT] = {PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_SOFTWARE};
+			const unsigned long long config[COUNT] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_SW_TASK_CLOCK};
+
+			for(int i = 0; i < COUNT; i++)
+			{
+				perf_event_attr attribute;
+				memset(&attribute, 0, sizeof(attribute));
+				attribute.type = type[i];
+				attribute.size = sizeof(attribute);
+				attribute.config = config[i];
+				attribute.disabled = 1;
+				attribute.exclude_kernel = 1;
+				attribute.exclude_hv = 1;
+
+				fd[i] = (int)syscall(SYS_perf_event_open, &attribute, 0, -1, -1, 0);
+			}
+		#endif
+
+		// Cost of enabling and disabling around a call
+		measure(empty, 0, 16, 256);
+
+		for(int i = 0; i < COUNT; i++)
+		{
+			overhead[i] = minimum[i];
+		}
+	}
+
+	~Counters()
+	{
+		#ifdef __linux__
+			for(int i = 0; i < COUNT; i++)
+			{
+				if(fd[i] != -1) close(fd[i]);
+			}
+		#endif
+	}
+
+	bool available(int counter) const
+	{
+		return fd[counter] != -1;
+	}
+
+	bool anyAvailable() const
+	{
+		for(int i = 0; i < COUNT; i++)
+		{
+			if(available(i)) return true;
+		}
+
+		return false;
+	}
+
+	// Counts each call separately, after warm-up calls which are not counted
+	void measure(void (*routine)(void*), void *data, int warmUp, int repetitions)
+	{
+		for(int i = 0; i < COUNT; i++)
+		{
+			mean[i] = 0;
+			minimum[i] = 1e30;
+		}
+
+		for(int i = 0; i < warmUp; i++)
+		{
+			routine(data);
+		}
+
+		#ifdef __linux__
+			for(int r = 0; r < repetitions; r++)
+			{
+				for(int i = 0; i < COUNT; i++)
+				{
+					if(fd[i] != -1) ioctl(fd[i], PERF_EVENT_IOC_RESET, 0);
+				}
+
+				for(int i = 0; i < COUNT; i++)
+				{
+					if(fd[i] != -1) ioctl(fd[i], PERF_EVENT_IOC_ENABLE, 0);
+				}
+
+				routine(data);
+
+				for(int i = COUNT - 1; i >= 0; i--)
+				{
+					if(fd[i] != -1) ioctl(fd[i], PERF_EVENT_IOC_DISABLE, 0);
+				}
+
+				for(int i = 0; i < COUNT; i++)
+				{
+					unsigned long long value = 0;
+
+					if(fd[i] != -1 && read(fd[i], &value, sizeof(value)) == sizeof(value))
+					{
+						double count = (double)value - overhead[i];
+
+						mean[i] += count / repetitions;
+						if(count < minimum[i]) minimum[i] = count;
+					}
+				}
+			}
+		#endif
+	}
+
+	void print(int counter, bool last) const
+	{
+		if(available(counter))
+		{
+			printf("\"%s\": {\"mean\": %.1f, \"min\": %.1f}%s", name(counter), mean[counter], minimum[counter], last ? "" : ", ");
+		}
+		else
+		{
+			printf("\"%s\": null%s", name(counter), last ? "" : ", ");
+		}
+	}
+
+	static const char *name(int counter)
+	{
+		switch(counter)
+		{
+		case CYCLES:		return "cycles";
+		case INSTRUCTIONS:	return "instructions";
+		case BRANCH_MISSES:	return "branchMisses";
+		case CACHE_MISSES:	return "cacheMisses";
+		case TASK_CLOCK:	return "taskClockNanoseconds";
+		}
+
+		return "";
+	}
+
+private:
+	static void empty(void*)
+	{
+	}
+
+	int fd[COUNT];
+	double overhead[COUNT];
+	double mean[COUNT];
+	double minimum[COUNT];
+};
+
+void benchmarkCounters()
+{
+	const int warmUp = 16;
+	const int repetitions = 256;
+
+	Counters counters;
+
+	printf("\t\"counters\": {\"available\": %s, \"warmUp\": %d, \"repetitions\": %d, \"configurations\": [\n",
+	       counters.anyAvailable() ? "true" : "false", warmUp, repetitions);
+
+	// Same workload with and without allocator optimizations
+	for(int optimized = 1; optimized >= 0; optimized--)
+	{
+		configure(optimized, optimized, optimized, optimized, optimized);
+
+		StressWorkload workload(1024, 0);
+		void (*routine)(void*) = (void(*)(void*))workload.callable();
+		int instructions = workload.instructionCount();
+
+		counters.measure(routine, StressWorkload::x, warmUp, repetitions);
+
+		printf("\t\t{\"configuration\": \"%s\", \"generatedInstructions\": %d, ", optimized ? "optimized" : "unoptimized", instructions);
+
+		for(int i = 0; i < Counters::COUNT; i++)
+		{
+			counters.print(i, i == Counters::COUNT - 1);
+		}
+
+		printf("}%s\n", optimized ? "," : "");
+	}
+
+	configure(true, true, true, true, true);
+
+	printf("\t]}\n");
+}
+
+int main()
+{
+	printf("{\n");
+	printf("\t\"platform\": \"%s\",\n", x64 ? "x86-64" : "x86");
+
+	benchmarkIntrinsics();
+	benchmarkLoading();
+	benchmarkDirect();
+	benchmarkFixed();
+	benchmarkStatic();
+	benchmarkAllocator();
+	benchmarkKernels();
+	benchmarkCounters();
+
+	printf("}\n");
+
+	return 0;
+}
@@ -0,0 +1,374 @@
+#include "CodeCache.hpp"
+
+#include "Assembler.hpp"
+#include "Loader.hpp"
+#include "Linker.hpp"
+#include "Error.hpp"
+
+#include <string.h>
+
+#ifdef __linux__
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+	#include <pthread.h>
+#endif
+
+namespace SoftWire
+{
+	static const int magic = 0x43435753;   // "SWCC"
+
+	// Routines mapped in this process, looked up and published from any thread
+	#ifdef __linux__
+		static pthread_mutex_t routineLock = PTHREAD_MUTEX_INITIALIZER;
+
+		static void lockRoutines() {pthread_mutex_lock(&routineLock);}
+		static void unlockRoutines() {pthread_mutex_unlock(&routineLock);}
+	#else
+		static void lockRoutines() {}
+		static void unlockRoutines() {}
+	#endif
+
+	CodeCache::CodeCache(int capacity, int routines)
+	{
+		descriptor = -1;
+		region = 0;
+		this->routines = 0;
+
+		int used = (sizeof(Header) + routines * sizeof(Slot) + 15) & ~15;
+
+		if(routines <= 0 || capacity <= used)
+		{
+			throw Error("Code cache of %d bytes too small for %d routines", capacity, routines);
+		}
+
+		#ifdef __linux__
+			descriptor = memfd_create("SoftWire", MFD_CLOEXEC);
+
+			if(descriptor < 0 || ftruncate(descriptor, capacity) != 0)
+			{
+				throw Error("Could not create shared code cache");
+			}
+		#else
+			throw Error("Shared code cache requires Linux");
+		#endif
+
+		attach();
+
+		// Pages of a new memfd are zero, so the index starts out empty
+		header->capacity = capacity;
+		header->slots = routines;
+		header->used = used;
+		header->magic = magic;
+	}
+
+	CodeCache::CodeCache(int descriptor)
+	{
+		this->descriptor = descriptor;
+		region = 0;
+		routines = 0;
+
+		attach();
+
+		if(header->magic != magic)
+		{
+			throw Error("Descriptor %d is not a code cache", descriptor);
+		}
+	}
+
+	CodeCache::~CodeCache()
+	{
+		#ifdef __linux__
+			for(Link<Routine> *routine = routines; routine; routine = routine->next())
+			{
+				munmap(routine->mapping, routine->length);
+			}
+
+			if(region)
+			{
+				munmap(region, header->capacity);
+			}
+		#endif
+
+		delete routines;
+		routines = 0;
+	}
+
+	void CodeCache::attach()
+	{
+		#ifdef __linux__
+			struct stat status;
+
+			if(fstat(descriptor, &status) != 0)
+			{
+				throw Error("Could not attach to code cache %d", descriptor);
+			}
+
+			void *view = mmap(0, status.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+
+			if(view == MAP_FAILED)
+			{
+				throw Error("Could not attach to code cache %d", descriptor);
+			}
+
+			region = (unsigned char*)view;
+			header = (Header*)region;
+			slots = (Slot*)(header + 1);
+		#else
+			throw Error("Shared code cache requires Linux");
+		#endif
+	}
+
+	int CodeCache::getDescriptor() const
+	{
+		return descriptor;
+	}
+
+	void (*CodeCache::lookup(const void *key, int size))()
+	{
+		unsigned __int64 hash = CodeCache::hash(key, size);
+
+		for(int i = 0; i < header->slots; i++)
+		{
+			const Slot &slot = slots[(hash + i) % header->slots];
+
+			if(slot.hash == 0)
+			{
+				return 0;
+			}
+
+			if(slot.hash == hash)
+			{
+				int offset = slot.offset;
+
+				if(!offset)
+				{
+					continue;   // Being published, possibly with another key
+				}
+
+				__sync_synchronize();
+
+				if(matches(offset, key, size))
+				{
+					return map(offset);
+				}
+			}
+		}
+
+		return 0;
+	}
+
+	void (*CodeCache::publish(const void *key, int size, Assembler &assembler, const char *entryLabel))()
+	{
+		const unsigned char *entryPoint = (const unsigned char*)assembler.callable(entryLabel);
+		const Loader &loader = *assembler.loader;
+
+		if(!loader.isPositionIndependent())
+		{
+			throw Error("Code referencing itself absolutely can't be cached");
+		}
+
+		int length = loader.getCodeLength();
+		int fixups = loader.getRelocationCount();
+		int names = 0;
+
+		for(int i = 0; i < fixups; i++)
+		{
+			const char *reference;
+			const unsigned char *target;
+			loader.getRelocation(i, &reference, &target);
+
+			if(!reference)
+			{
+				throw Error("Branch to an absolute target can't be cached, reference it by name");
+			}
+
+			names += strlen(reference) + 1;
+		}
+
+		int code = (sizeof(Entry) + size + fixups * sizeof(Fixup) + names + 15) & ~15;
+		int total = (code + length + fixups * 16 + 15) & ~15;
+		int offset = __sync_fetch_and_add(&header->used, total);
+
+		if(offset + total > header->capacity)
+		{
+			return 0;
+		}
+
+		Entry *entry = (Entry*)(region + offset);
+		entry->size = size;
+		entry->length = length;
+		entry->entry = (int)(entryPoint - loader.getCode());
+		entry->fixups = fixups;
+		entry->code = code;
+
+		memcpy(entry + 1, key, size);
+
+		Fixup *fixup = (Fixup*)((unsigned char*)(entry + 1) + size);
+		char *name = (char*)(fixup + fixups);
+
+		for(int i = 0; i < fixups; i++)
+		{
+			const char *reference;
+			const unsigned char *target;
+			fixup[i].offset = loader.getRelocation(i, &reference, &target);
+			fixup[i].reference = (int)(name - (char*)entry);
+
+			strcpy(name, reference);
+			name += strlen(reference) + 1;
+		}
+
+		memcpy((unsigned char*)entry + code, loader.getCode(), length);
+
+		__sync_synchronize();   // Entry complete before it can be found
+
+		unsigned __int64 hash = CodeCache::hash(key, size);
+
+		for(int i = 0; i < header->slots; i++)
+		{
+			Slot &slot = slots[(hash + i) % header->slots];
+
+			if(slot.hash == 0 && __sync_bool_compare_and_swap(&slot.hash, 0, hash))
+			{
+				slot.offset = offset;
+
+				return map(offset);
+			}
+
+			if(slot.hash == hash && (!slot.offset || matches(slot.offset, key, size)))
+			{
+				return map(offset);   // Published concurrently, use our own copy
+			}
+		}
+
+		return 0;   // Index full
+	}
+
+	void (*CodeCache::mapped(int offset) const)()
+	{
+		for(Link<Routine> *routine = routines; routine; routine = routine->next())
+		{
+			if(routine->offset == offset)
+			{
+				return routine->entry;
+			}
+		}
+
+		return 0;
+	}
+
+	void (*CodeCache::map(int offset))()
+	{
+		lockRoutines();
+		void (*entryPoint)() = mapped(offset);
+		unlockRoutines();
+
+		if(entryPoint)
+		{
+			return entryPoint;
+		}
+
+		#ifdef __linux__
+			const Entry *entry = (const Entry*)(region + offset);
+			const Fixup *fixup = (const Fixup*)((const unsigned char*)(entry + 1) + entry->size);
+
+			int page = (int)sysconf(_SC_PAGESIZE);
+			int start = offset & ~(page - 1);
+			int length = offset + entry->code + entry->length + entry->fixups * 16 - start;
+
+			// Patched routines get private copies of the pages they touch
+			int protection = entry->fixups ? PROT_READ | PROT_WRITE : PROT_READ | PROT_EXEC;
+			void *view = mmap(0, length, protection, entry->fixups ? MAP_PRIVATE : MAP_SHARED, descriptor, start);
+
+			if(view == MAP_FAILED)
+			{
+				throw Error("Could not map cached routine");
+			}
+
+			unsigned char *code = (unsigned char*)view + (offset - start) + entry->code;
+			unsigned char *stubs = code + entry->length;
+
+			for(int i = 0; i < entry->fixups; i++)
+			{
+				const char *name = (const char*)entry + fixup[i].reference;
+				const unsigned char *target = (const unsigned char*)Linker::resolveExternal(name);
+
+				if(!target)
+				{
+					munmap(view, length);
+					throw Error("Unresolved identifier '%s'", name);
+				}
+
+				unsigned char *next = code + fixup[i].offset + 4;
+				__int64 displacement = target - next;
+
+				if(displacement != (int)displacement)   // Through a stub, like a veneer
+				{
+					static const unsigned char jump[8] = {0xFF, 0x25, 0x02, 0x00, 0x00, 0x00, 0xCC, 0xCC};   // JMP [RIP+2]
+
+					unsigned char *stub = stubs + 16 * i;
+					memcpy(stub, jump, 8);
+					memcpy(stub + 8, &target, 8);
+					displacement = stub - next;
+				}
+
+				int offset32 = (int)displacement;
+				memcpy(code + fixup[i].offset, &offset32, 4);
+			}
+
+			if(entry->fixups)
+			{
+				mprotect(view, length, PROT_READ | PROT_EXEC);
+			}
+
+			Routine routine;
+			routine.offset = offset;
+			routine.entry = (void(*)())(code + entry->entry);
+			routine.mapping = view;
+			routine.length = length;
+
+			lockRoutines();
+
+			entryPoint = mapped(offset);
+
+			if(!entryPoint)
+			{
+				if(!routines) routines = new Link<Routine>();
+				routines->append(routine);
+
+				entryPoint = routine.entry;
+			}
+
+			unlockRoutines();
+
+			if(entryPoint != routine.entry)   // Mapped concurrently by another thread
+			{
+				munmap(view, length);
+			}
+
+			return entryPoint;
+		#else
+			throw Error("Shared code cache requires Linux");
+		#endif
+	}
+
+	bool CodeCache::matches(int offset, const void *key, int size) const
+	{
+		const Entry *entry = (const Entry*)(region + offset);
+
+		return entry->size == size && memcmp(entry + 1, key, size) == 0;
+	}
+
+	unsigned __int64 CodeCache::hash(const void *key, int size)
+	{
+		unsigned __int64 hash = 0xCBF29CE484222325ULL;   // FNV-1a
+
+		for(int i = 0; i < size; i++)
+		{
+			hash ^= ((const unsigned char*)key)[i];
+			hash *= 0x100000001B3ULL;
+		}
+
+		return hash ? hash : 1;
+	}
+}
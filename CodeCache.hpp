@@ -0,0 +1,85 @@
+#ifndef SoftWire_CodeCache_hpp
+#define SoftWire_CodeCache_hpp
+
+#include "Link.hpp"
+
+namespace SoftWire
+{
+	class Assembler;
+
+	// Routines shared between processes through a Linux memfd region, keyed by a description of their content
+	// provided by the caller. Other processes attach to the region, inherited through fork or passed as a
+	// descriptor, and map its routines read+exec. Branches to externals are resolved by name and patched per
+	// process on copy-on-write pages, routines without them share physical memory.
+	class CodeCache
+	{
+	public:
+		CodeCache(int capacity, int routines);   // Bytes, creates a new region
+		explicit CodeCache(int descriptor);     // Attaches to an existing region
+
+		virtual ~CodeCache();
+
+		void (*lookup(const void *key, int size))();   // 0 if not published (yet)
+
+		// Loads the assembler before finalize, code must be position independent and branch to externals by
+		// name, as absolute targets aren't valid in other processes. Concurrent publishers of the same key each
+		// get a working routine. Returns 0 if the region or its index is full.
+		void (*publish(const void *key, int size, Assembler &assembler, const char *entryLabel = 0))();
+
+		int getDescriptor() const;
+
+	private:
+		struct Header
+		{
+			int magic;
+			int capacity;
+			int slots;
+			volatile int used;   // Bytes, allocated by atomic increment
+		};
+
+		struct Slot   // Open addressing, claimed by compare-and-swap of the hash
+		{
+			volatile unsigned __int64 hash;
+			volatile int offset;   // Of entry, 0 while being published
+			int padding;
+		};
+
+		struct Entry   // Followed by key, fixups and reference names, then code aligned to 16 bytes and stubs
+		{
+			int size;     // Of key
+			int length;   // Of code
+			int entry;    // Offset of entry point in code
+			int fixups;
+			int code;     // Offset of code from entry
+		};
+
+		struct Fixup
+		{
+			int offset;      // Of rel32 field in code
+			int reference;   // Offset of external name from entry
+		};
+
+		struct Routine   // Mapped in this process
+		{
+			int offset;
+			void (*entry)();
+			void *mapping;
+			int length;
+		};
+
+		int descriptor;
+		unsigned char *region;   // Shared read/write view
+		Header *header;
+		Slot *slots;
+		Link<Routine> *routines;
+
+		void attach();
+		void (*map(int offset))();
+		void (*mapped(int offset) const)();   // 0 if not mapped in this process yet
+		bool matches(int offset, const void *key, int size) const;
+
+		static unsigned __int64 hash(const void *key, int size);   // Never 0
+	};
+}
+
+#endif   // SoftWire_CodeCache_hpp
@@ -1,6 +1,7 @@
 #include "CodeGenerator.hpp"
 
 #include "Error.hpp"
+#include "String.hpp"
 
 #include <stdio.h>
 
@@ -25,14 +26,7 @@ namespace SoftWire
 			{
 				stackTop += 16;
 
-				if(!cg->x64)
-				{
-					stackUpdate->setImmediate(stackTop);
-				}
-				else
-				{
-					stackUpdate->setImmediate(32+stackTop+128);
-				}
+				stackUpdate->setImmediate(stackTop);
 			}
 			else if(stackTop != -128)   // Skip arg
 			{
@@ -1103,6 +1097,39 @@ namespace SoftWire
 		return temp;
 	}
 
+	CodeGenerator::Pointer::Pointer() : Variable(cg->x64 ? 8 : 4)
+	{
+	}
+
+	CodeGenerator::Pointer::Pointer(const Pointer &p) : Variable(cg->x64 ? 8 : 4)
+	{
+		*this = p;
+	}
+
+	CodeGenerator::Pointer::operator OperandREG32() const
+	{
+		return cg->r32(ebp + ref(), true, size == 8 ? 8 : 0);
+	}
+
+	CodeGenerator::Pointer &CodeGenerator::Pointer::operator=(const Pointer &p)
+	{
+		OperandREG32 source = p;
+		OperandREG32 destination = cg->r32(ebp + ref(), false, size == 8 ? 8 : 0);
+
+		if(size == 8) cg->mov(OperandREG64(destination.reg), OperandREG64(source.reg));
+		else          cg->mov(destination, source);
+
+		return *this;
+	}
+
+	CodeGenerator::Pointer &CodeGenerator::Pointer::operator+=(int offset)
+	{
+		if(size == 8) cg->add(OperandREG64(OperandREG32(*this).reg), offset);
+		else          cg->add(*this, offset);
+
+		return *this;
+	}
+
 	CodeGenerator::Qword::Qword() : Variable(8)
 	{
 	}
@@ -1535,7 +1562,7 @@ namespace SoftWire
 
 	CodeGenerator::Float &CodeGenerator::Float::operator+=(const Float &f)
 	{
-		cg->movss(*this, cg->mSS(ebp + f.ref()));
+		cg->addss(*this, cg->mSS(ebp + f.ref()));
 		return *this;
 	}
 
@@ -1613,6 +1640,13 @@ namespace SoftWire
 		cg->shufps(*this, *this, 0x00);
 	}
 
+	CodeGenerator::Float4::Float4(float x, float y, float z, float w)
+	{
+		float constant[4] = {x, y, z, w};
+
+		cg->movaps(cg->r128(ebp + ref(), false), xmmword_ptr [cg->literal(constant, 16)]);
+	}
+
 	CodeGenerator::Float4 &CodeGenerator::Float4::operator=(const Float4 &float4)
 	{
 		cg->movaps(*this, cg->m128(ebp + float4.ref()));
@@ -1720,6 +1754,15 @@ namespace SoftWire
 	CodeGenerator::CodeGenerator(bool x64) : Emulator(x64)
 	{
 		cg = this;
+
+		intArguments = 0;
+		floatArguments = 0;
+
+		usedRegisters = 0;
+		calleeSaved = 0;
+		exempt = 0;
+		saves = 0;
+		uses = 0;
 	}
 
 	CodeGenerator::~CodeGenerator()
@@ -1728,38 +1771,77 @@ namespace SoftWire
 		stack = -128;
 		stackTop = -128;
 		stackUpdate = 0;
+
+		delete saves;
+		saves = 0;
+		delete uses;
+		uses = 0;
 	}
 
 	void CodeGenerator::prologue(int functionArguments)
 	{
 		cg = this;
 
+		intArguments = 0;
+		floatArguments = 0;
+
+		usedRegisters = 0;
+		calleeSaved = 0;
+		delete saves;
+		saves = 0;
+		delete uses;
+		uses = 0;
+
+		// Saves and frame are emitted reserved, the epilogue retains what the routine uses
+		exempt = ~0;
+
 		if(!x64)
 		{
 			mov(arg, esp);
 
-			push(edi);
-			push(esi);
-			push(ebx);
+			save(Encoding::EDI);
+			save(Encoding::ESI);
+			save(Encoding::EBX);
 
-			push(ebp);
-			mov(ebp, esp);
+			save(Encoding::EBP);
+			pad(sub(esp, 12));
+			record(Encoding::EBP, mov(ebp, esp));
 			stackUpdate =
 			sub(ebp, stackTop);
-			lea(esp, dword_ptr [ebp-128-12]);
-			and(ebp, 0xFFFFFFF0);
+			record(Encoding::EBP, stackUpdate);
+			record(Encoding::EBP, lea(esp, dword_ptr [ebp-128-12]));
+			record(Encoding::EBP, and(ebp, 0xFFFFFFF0));
 		}
 		else
 		{
-			push(rbp);
-			push(rbx);
-			push(r12);
-			push(r13);
-			push(r14);
-			push(r15);
+			save(Encoding::RBP);
+			save(Encoding::RBX);
+			#ifdef WIN32
+				save(Encoding::RDI);
+				save(Encoding::RSI);
+			#endif
+			save(Encoding::R12);
+			save(Encoding::R13);
+			save(Encoding::R14);
+			save(Encoding::R15);
+			#ifdef WIN32
+				for(int xmm = 6; xmm < 16; xmm++)   // Callee-saved on Win64
+				{
+					record(16 + xmm, sub(rsp, 16));
+					record(16 + xmm, movups(xword_ptr [rsp], OperandXMMREG(xmm)));
+				}
+			#endif
+			pad(sub(rsp, 8));
+
+			record(Encoding::RBP, mov(rbp, rsp));
 			stackUpdate =
-			sub(rsp, 32+stackTop+128);
+			sub(rbp, stackTop);
+			record(Encoding::RBP, stackUpdate);
+			record(Encoding::RBP, lea(rsp, qword_ptr [rbp-128-8-32]));   // Shadow space for calls
+			record(Encoding::RBP, and(rbp, 0xFFFFFFF0));
 		}
+
+		exempt = 0;
 	};
 
 	OperandMEM32 CodeGenerator::argument(int i)
@@ -1767,33 +1849,375 @@ namespace SoftWire
 		return dword_ptr [arg + 4 * i + 4];
 	}
 
+	void CodeGenerator::argument(Int &i)
+	{
+		cg = this;
+
+		if(!x64)
+		{
+			mov(i, argument(intArguments++));
+		}
+		else
+		{
+			int reg = integerArgument();
+
+			if(reg < 8) assign(OperandREG32(reg), ebp + i.ref());
+			else        mov(r32(ebp + i.ref(), false), OperandREG32(reg));   // R8 and R9 aren't allocated, copy to a register that is
+		}
+	}
+
+	void CodeGenerator::argument(Pointer &p)
+	{
+		cg = this;
+
+		if(!x64)
+		{
+			mov(p, argument(intArguments++));
+		}
+		else
+		{
+			int reg = integerArgument();
+
+			if(reg < 8) assign(OperandREG32(reg), ebp + p.ref(), 8);
+			else        mov(OperandREG64(r32(ebp + p.ref(), false, 8).reg), OperandREG64(reg));
+		}
+	}
+
+	void CodeGenerator::argument(Float &f)
+	{
+		cg = this;
+
+		if(!x64)
+		{
+			movss(f, argument(intArguments++));
+		}
+		else
+		{
+			assign(OperandXMMREG(floatArgument()), ebp + f.ref(), true);
+		}
+	}
+
+	void CodeGenerator::argument(Float4 &f)
+	{
+		cg = this;
+
+		if(!x64)
+		{
+			throw Error("Float4 arguments require x86-64 mode");
+		}
+
+		#ifdef WIN32
+			movaps(f, xword_ptr [OperandREG64(integerArgument())]);   // Passed by reference
+		#else
+			assign(OperandXMMREG(floatArgument()), ebp + f.ref());
+		#endif
+	}
+
+	void CodeGenerator::result(const Int &i)
+	{
+		cg = this;
+
+		OperandREG32 value = i;
+
+		if(value.reg != Encoding::EAX)
+		{
+			free(eax);   // Only the epilogue follows, whatever EAX holds is dead
+			mov(eax, value);
+		}
+	}
+
+	void CodeGenerator::result(const Pointer &p)
+	{
+		cg = this;
+
+		OperandREG32 value = p;
+
+		if(value.reg != Encoding::EAX)
+		{
+			free(eax);
+
+			if(x64) mov(rax, OperandREG64(value.reg));
+			else    mov(eax, value);
+		}
+	}
+
+	void CodeGenerator::result(const Float &f)
+	{
+		cg = this;
+
+		if(!x64)
+		{
+			spill((OperandREF)(ebp + f.ref()));
+			fld(dword_ptr [ebp + f.ref()]);
+		}
+		else
+		{
+			OperandXMMREG value = f;
+
+			if(value.reg != Encoding::XMM0)
+			{
+				free(xmm0);
+				movss(xmm0, value);
+			}
+		}
+	}
+
+	void CodeGenerator::result(const Float4 &f)
+	{
+		cg = this;
+
+		OperandXMMREG value = f;
+
+		if(value.reg != Encoding::XMM0)
+		{
+			free(xmm0);
+			movaps(xmm0, value);
+		}
+	}
+
 	void CodeGenerator::epilogue()
 	{
 		cg = this;
 
+		exempt = ~0;
+
 		if(!x64)
 		{
-			add(esp, stackTop+128+12);
-			pop(ebp);
+			record(Encoding::EBP, add(esp, stackTop+128+12));
+			pad(add(esp, 12));
+			restore(Encoding::EBP);
 
-			pop(ebx);
-			pop(esi);
-			pop(edi);
+			restore(Encoding::EBX);
+			restore(Encoding::ESI);
+			restore(Encoding::EDI);
 		}
 		else
 		{
-			add(rsp, 32+stackTop+128);
-			pop(r15);
-			pop(r14);
-			pop(r13);
-			pop(r12);
-			pop(rbx);
-			pop(rbp);
+			record(Encoding::RBP, add(rsp, stackTop+128+8+32));
+			pad(add(rsp, 8));
+			#ifdef WIN32
+				for(int xmm = 15; xmm >= 6; xmm--)
+				{
+					record(16 + xmm, movups(OperandXMMREG(xmm), xword_ptr [rsp]));
+					record(16 + xmm, add(rsp, 16));
+				}
+			#endif
+			restore(Encoding::R15);
+			restore(Encoding::R14);
+			restore(Encoding::R13);
+			restore(Encoding::R12);
+			#ifdef WIN32
+				restore(Encoding::RSI);
+				restore(Encoding::RDI);
+			#endif
+			restore(Encoding::RBX);
+			restore(Encoding::RBP);
 		}
 
+		exempt = 0;
+
+		retain();
+
 		ret();
 	}
 
+	Encoding *CodeGenerator::x86(int instructionID, const Operand &firstOperand, const Operand &secondOperand, const Operand &thirdOperand)
+	{
+		int used = registers(firstOperand) | registers(secondOperand) | registers(thirdOperand);
+
+		Encoding *encoding = Emulator::x86(instructionID, firstOperand, secondOperand, thirdOperand);
+
+		if(encoding && encoding->isCall())
+		{
+			used |= 1 << Encoding::EBP;   // Aligned frame with shadow space
+		}
+
+		// Implicit operands of string instructions, CPUID and POPA
+		if(Operand::isVoid(firstOperand) && encoding && encoding->getMnemonic())
+		{
+			char mnemonic[16] = {0};
+			strncpy(mnemonic, encoding->getMnemonic(), 15);
+			strlwr(mnemonic);
+
+			if(strcmp(mnemonic, "cpuid") == 0)
+			{
+				used |= 1 << Encoding::EBX;
+			}
+			else if(strncmp(mnemonic, "popa", 4) == 0)
+			{
+				used |= 0xFF;
+			}
+			else if(strncmp(mnemonic, "rep", 3) == 0 ||
+			        strncmp(mnemonic, "movs", 4) == 0 ||
+			        strncmp(mnemonic, "stos", 4) == 0 ||
+			        strncmp(mnemonic, "lods", 4) == 0 ||
+			        strncmp(mnemonic, "cmps", 4) == 0 ||
+			        strncmp(mnemonic, "scas", 4) == 0 ||
+			        strncmp(mnemonic, "ins", 3) == 0 ||
+			        strncmp(mnemonic, "outs", 4) == 0)
+			{
+				used |= (1 << Encoding::ESI) | (1 << Encoding::EDI);
+			}
+		}
+
+		used &= ~exempt;
+
+		if(used)
+		{
+			Use use = {used, encoding};
+			if(!uses) uses = new Link<Use>();
+			uses->append(use);
+		}
+
+		return encoding;
+	}
+
+	int CodeGenerator::integerArgument()
+	{
+		#ifdef WIN32
+			static const int reg[] = {Encoding::RCX, Encoding::RDX, Encoding::R8, Encoding::R9};
+			int i = intArguments + floatArguments;   // Position shared with floating-point arguments
+		#else
+			static const int reg[] = {Encoding::RDI, Encoding::RSI, Encoding::RDX, Encoding::RCX, Encoding::R8, Encoding::R9};
+			int i = intArguments;
+		#endif
+
+		if(i >= (int)(sizeof(reg) / sizeof(int)))
+		{
+			throw Error("Argument %d not passed in a register", intArguments + floatArguments);
+		}
+
+		intArguments++;
+
+		return reg[i];
+	}
+
+	int CodeGenerator::floatArgument()
+	{
+		#ifdef WIN32
+			int i = intArguments + floatArguments;
+			const int count = 4;
+		#else
+			int i = floatArguments;
+			const int count = 8;
+		#endif
+
+		if(i >= count)
+		{
+			throw Error("Argument %d not passed in a register", intArguments + floatArguments);
+		}
+
+		floatArguments++;
+
+		return i;
+	}
+
+	void CodeGenerator::save(int reg)
+	{
+		calleeSaved |= 1 << reg;
+
+		record(reg, x64 ? push(OperandREG64(reg)) : push(OperandREG32(reg)));
+	}
+
+	void CodeGenerator::restore(int reg)
+	{
+		record(reg, x64 ? pop(OperandREG64(reg)) : pop(OperandREG32(reg)));
+	}
+
+	void CodeGenerator::record(int reg, Encoding *encoding)
+	{
+		Save save = {reg, encoding};
+		if(!saves) saves = new Link<Save>();
+		saves->append(save);
+
+		encoding->reserve();
+	}
+
+	void CodeGenerator::retain()
+	{
+		// Spills and loads can still be eliminated after emission, only count what remains
+		usedRegisters = 0;
+
+		for(Link<Use> *use = uses; use; use = use->next())
+		{
+			if(!use->encoding || use->encoding->isEmitting())
+			{
+				usedRegisters |= use->registers;
+			}
+		}
+
+		for(Link<Save> *link = saves; link; link = link->next())
+		{
+			if(link->reg == Encoding::ESP) continue;
+
+			if(usedRegisters & (1 << link->reg)) link->encoding->retain();
+			else link->encoding->reserve();
+		}
+
+		align();
+	}
+
+	void CodeGenerator::pad(Encoding *encoding)
+	{
+		Save save = {Encoding::ESP, encoding};
+		if(!saves) saves = new Link<Save>();
+		saves->append(save);
+
+		align();
+	}
+
+	void CodeGenerator::align()
+	{
+		int pushes = 0;
+
+		for(int reg = 0; reg < 16; reg++)
+		{
+			if(usedRegisters & calleeSaved & (1 << reg)) pushes++;
+		}
+
+		// Calls expect a 16-byte aligned stack, pad what the kept pushes leave misaligned
+		int padding = (-pushes * (x64 ? 8 : 4)) & 15;
+		bool frame = (usedRegisters & (1 << Encoding::EBP)) != 0;
+
+		for(Link<Save> *link = saves; link; link = link->next())
+		{
+			if(link->reg == Encoding::ESP)
+			{
+				link->encoding->setImmediate(padding);
+
+				if(frame && padding) link->encoding->retain();
+				else link->encoding->reserve();
+			}
+		}
+	}
+
+	int CodeGenerator::registers(const Operand &op)
+	{
+		const int generalPurpose = Operand::OPERAND_REG8 | Operand::OPERAND_REG16 | Operand::OPERAND_REG32 | Operand::OPERAND_REG64;
+
+		if(Operand::isMem(op))
+		{
+			return (op.baseReg == Encoding::EBP || op.indexReg == Encoding::EBP) ? 1 << Encoding::EBP : 0;   // Stack variables need the frame
+		}
+
+		if(op.type == Operand::OPERAND_XMMREG && op.reg >= 0)
+		{
+			return 1 << (16 + op.reg);
+		}
+
+		if(op.type == Operand::OPERAND_VOID || (op.type & generalPurpose) != op.type || op.reg < 0)
+		{
+			return 0;
+		}
+
+		if(op.type == Operand::OPERAND_REG8 && op.reg >= 4 && op.reg < 8)
+		{
+			return (1 << op.reg) | (1 << (op.reg - 4));   // AH to BH without REX
+		}
+
+		return 1 << op.reg;
+	}
+
 	void CodeGenerator::free(Variable &var1)
 	{
 		var1.free();
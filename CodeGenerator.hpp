@@ -9,6 +9,8 @@ namespace SoftWire
 	{
 		class Variable
 		{
+			friend class CodeGenerator;
+
 		public:
 			virtual ~Variable();
 
@@ -213,6 +215,19 @@ namespace SoftWire
 			Int operator|(unsigned int i);
 		};
 
+		class Pointer : public Variable   // Native width, 64-bit on x86-64
+		{
+		public:
+			Pointer();
+			Pointer(const Pointer &p);
+
+			operator OperandREG32() const;   // Full width register, for addressing
+
+			Pointer &operator=(const Pointer &p);
+
+			Pointer &operator+=(int offset);
+		};
+
 		class Word4;
 		class Dword2;
 
@@ -358,6 +373,7 @@ namespace SoftWire
 			Float4();
 			Float4(const Float4 &float4);
 			Float4(const Float &f);
+			Float4(float x, float y, float z, float w);   // Literal, like sign mask Float4(-0.0f, -0.0f, -0.0f, -0.0f)
 
 			Float4 &operator=(const Float4 &float4);
 
@@ -386,6 +402,18 @@ namespace SoftWire
 		void epilogue();
 		OperandMEM32 argument(int i);
 
+		// Bind arguments in declaration order, directly after the prologue, as passed by the native calling convention
+		void argument(Int &i);
+		void argument(Pointer &p);
+		void argument(Float &f);
+		void argument(Float4 &f);
+
+		// Return value in EAX/RAX, ST0 or XMM0, directly before the epilogue
+		void result(const Int &i);
+		void result(const Pointer &p);
+		void result(const Float &f);
+		void result(const Float4 &f);
+
 		using Emulator::free;
 		void free(Variable &var1);
 		void free(Variable &var1, Variable &var2);
@@ -393,9 +421,45 @@ namespace SoftWire
 		void free(Variable &var1, Variable &var2, Variable &var3, Variable &var4);
 		void free(Variable &var1, Variable &var2, Variable &var3, Variable &var4, Variable &var5);
 
+	protected:
+		Encoding *x86(int instructionID, const Operand &firstOperand, const Operand &secondOperand, const Operand &thirdOperand);
+
 	private:
+		struct Save
+		{
+			int reg;   // XMM registers from 16
+			Encoding *encoding;   // Save, restore or frame setup, only emitted when the routine uses the register
+		};
+
+		struct Use
+		{
+			int registers;
+			Encoding *encoding;
+		};
+
+		int integerArgument();
+		int floatArgument();
+
+		void save(int reg);
+		void restore(int reg);
+		void record(int reg, Encoding *encoding);
+		void retain();   // Keeps the saves of registers the emitted code uses, once the routine is complete
+		void pad(Encoding *encoding);   // Stack adjustment recorded as ESP
+		void align();   // Pads the saves so calls from the frame get an aligned stack
+
+		static int registers(const Operand &op);   // Bit per register, XMM from bit 16, EBP for stack memory
+
 		Dword arg;
 
+		int intArguments;
+		int floatArguments;
+
+		int usedRegisters;
+		int calleeSaved;
+		int exempt;   // Registers not counted as used
+		Link<Save> *saves;
+		Link<Use> *uses;   // Registers per instruction
+
 		static int stack;
 		static int stackTop;
 		static Encoding *stackUpdate;
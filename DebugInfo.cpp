@@ -0,0 +1,593 @@
+#include "DebugInfo.hpp"
+
+#include "Error.hpp"
+#include "String.hpp"
+
+#include <stddef.h>
+
+#ifdef WIN32
+	#include <windows.h>
+#else
+	#include <pthread.h>
+#endif
+
+#ifdef __GNUC__
+	#define NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+	#define NOINLINE __declspec(noinline)
+#else
+	#define NOINLINE
+#endif
+
+extern "C"
+{
+	// GDB JIT compilation interface, GDB sets a breakpoint in __jit_debug_register_code
+	enum
+	{
+		JIT_NOACTION = 0,
+		JIT_REGISTER_FN,
+		JIT_UNREGISTER_FN
+	};
+
+	struct jit_code_entry
+	{
+		jit_code_entry *next_entry;
+		jit_code_entry *prev_entry;
+		const char *symfile_addr;
+		unsigned __int64 symfile_size;
+	};
+
+	struct jit_descriptor
+	{
+		unsigned int version;
+		unsigned int action_flag;
+		jit_code_entry *relevant_entry;
+		jit_code_entry *first_entry;
+	};
+
+	NOINLINE void __jit_debug_register_code()
+	{
+		#ifdef __GNUC__
+			__asm__ __volatile__("" ::: "memory");
+		#endif
+	}
+
+	jit_descriptor __jit_debug_descriptor = {1, JIT_NOACTION, 0, 0};
+}
+
+namespace SoftWire
+{
+	// Registration with the debugger has to be serialized
+	#ifdef WIN32
+		static SRWLOCK descriptorLock = SRWLOCK_INIT;
+
+		static void lockDescriptor() {AcquireSRWLockExclusive(&descriptorLock);}
+		static void unlockDescriptor() {ReleaseSRWLockExclusive(&descriptorLock);}
+	#else
+		static pthread_mutex_t descriptorLock = PTHREAD_MUTEX_INITIALIZER;
+
+		static void lockDescriptor() {pthread_mutex_lock(&descriptorLock);}
+		static void unlockDescriptor() {pthread_mutex_unlock(&descriptorLock);}
+	#endif
+
+	DebugInfo::Buffer::Buffer()
+	{
+		buffer = 0;
+		length = 0;
+		capacity = 0;
+	}
+
+	DebugInfo::Buffer::~Buffer()
+	{
+		delete[] buffer;
+		buffer = 0;
+	}
+
+	void DebugInfo::Buffer::put(const void *data, int size)
+	{
+		if(length + size > capacity)
+		{
+			capacity = (length + size) * 2 + 256;
+			unsigned char *grown = new unsigned char[capacity];
+
+			if(buffer) memcpy(grown, buffer, length);
+
+			delete[] buffer;
+			buffer = grown;
+		}
+
+		memcpy(buffer + length, data, size);
+		length += size;
+	}
+
+	void DebugInfo::Buffer::byte(int value)
+	{
+		unsigned char b = (unsigned char)value;
+		put(&b, 1);
+	}
+
+	void DebugInfo::Buffer::half(int value)
+	{
+		byte(value);
+		byte(value >> 8);
+	}
+
+	void DebugInfo::Buffer::word(unsigned int value)
+	{
+		half(value);
+		half(value >> 16);
+	}
+
+	void DebugInfo::Buffer::quad(unsigned __int64 value)
+	{
+		word((unsigned int)value);
+		word((unsigned int)(value >> 32));
+	}
+
+	void DebugInfo::Buffer::uleb(unsigned int value)
+	{
+		do
+		{
+			unsigned char b = value & 0x7F;
+			value >>= 7;
+			byte(value ? b | 0x80 : b);
+		}
+		while(value);
+	}
+
+	void DebugInfo::Buffer::sleb(int value)
+	{
+		bool more = true;
+
+		while(more)
+		{
+			unsigned char b = value & 0x7F;
+			value >>= 7;   // Arithmetic shift
+
+			if((value == 0 && !(b & 0x40)) || (value == -1 && (b & 0x40)))
+			{
+				more = false;
+			}
+
+			byte(more ? b | 0x80 : b);
+		}
+	}
+
+	void DebugInfo::Buffer::string(const char *string)
+	{
+		put(string, (int)strlen(string) + 1);
+	}
+
+	void DebugInfo::Buffer::patch(int offset, unsigned int value)
+	{
+		for(int i = 0; i < 4; i++)
+		{
+			buffer[offset + i] = (unsigned char)(value >> (8 * i));
+		}
+	}
+
+	int DebugInfo::Buffer::size() const
+	{
+		return length;
+	}
+
+	const unsigned char *DebugInfo::Buffer::data() const
+	{
+		return buffer;
+	}
+
+	DebugInfo::DebugInfo(bool x64) : x64(x64)
+	{
+		symbols = 0;
+		lines = 0;
+		frames = 0;
+
+		entry = 0;
+		object = 0;
+	}
+
+	DebugInfo::~DebugInfo()
+	{
+		jit_code_entry *codeEntry = (jit_code_entry*)entry;
+
+		if(codeEntry)
+		{
+			lockDescriptor();
+
+			if(codeEntry->prev_entry) codeEntry->prev_entry->next_entry = codeEntry->next_entry;
+			else __jit_debug_descriptor.first_entry = codeEntry->next_entry;
+
+			if(codeEntry->next_entry) codeEntry->next_entry->prev_entry = codeEntry->prev_entry;
+
+			__jit_debug_descriptor.action_flag = JIT_UNREGISTER_FN;
+			__jit_debug_descriptor.relevant_entry = codeEntry;
+			__jit_debug_register_code();
+
+			unlockDescriptor();
+
+			delete codeEntry;
+			entry = 0;
+		}
+
+		delete[] object;
+		object = 0;
+
+		for(Link<Symbol> *symbol = symbols; symbol; symbol = symbol->next())
+		{
+			delete[] symbol->name;
+			symbol->name = 0;
+		}
+
+		delete symbols;
+		symbols = 0;
+
+		delete lines;
+		lines = 0;
+
+		delete frames;
+		frames = 0;
+	}
+
+	void DebugInfo::addSymbol(const char *name, const unsigned char *start, const unsigned char *end)
+	{
+		Symbol symbol;
+
+		symbol.name = strdup(name);
+		symbol.start = start;
+		symbol.end = end;
+
+		if(!symbols) symbols = new Link<Symbol>();
+		symbols->append(symbol);
+	}
+
+	void DebugInfo::addLine(const unsigned char *address, int line)
+	{
+		Row row;
+
+		row.address = address;
+		row.value = line;
+		row.reg = -1;
+
+		if(!lines) lines = new Link<Row>();
+		lines->append(row);
+	}
+
+	void DebugInfo::addFrame(const unsigned char *address, int stack)
+	{
+		Row row;
+
+		row.address = address;
+		row.value = stack;
+		row.reg = -1;
+
+		if(!frames) frames = new Link<Row>();
+		frames->append(row);
+	}
+
+	void DebugInfo::addSavedRegister(const unsigned char *address, int reg, int stack)
+	{
+		Row row;
+
+		row.address = address;
+		row.value = stack;
+		row.reg = reg;
+
+		if(!frames) frames = new Link<Row>();
+		frames->append(row);
+	}
+
+	void DebugInfo::registerCode(const unsigned char *start, const unsigned char *end, const char *sourceFile)
+	{
+		if(entry) throw INTERNAL_ERROR;   // Already registered
+
+		if(!sourceFile) sourceFile = "SoftWire";
+
+		// Section names
+		Buffer shstrtab;
+		shstrtab.byte(0);
+		int textName = shstrtab.size();		shstrtab.string(".text");
+		int symtabName = shstrtab.size();	shstrtab.string(".symtab");
+		int strtabName = shstrtab.size();	shstrtab.string(".strtab");
+		int shstrtabName = shstrtab.size();	shstrtab.string(".shstrtab");
+		int infoName = shstrtab.size();		shstrtab.string(".debug_info");
+		int abbrevName = shstrtab.size();	shstrtab.string(".debug_abbrev");
+		int lineName = shstrtab.size();		shstrtab.string(".debug_line");
+		int frameName = shstrtab.size();	shstrtab.string(".debug_frame");
+
+		// Symbols, all global functions in .text
+		Buffer strtab;
+		Buffer symtab;
+		strtab.byte(0);
+
+		for(int i = 0; i < (x64 ? 24 : 16); i++)
+		{
+			symtab.byte(0);
+		}
+
+		for(const Link<Symbol> *symbol = symbols; symbol; symbol = symbol->next())
+		{
+			int name = strtab.size();
+			strtab.string(symbol->name);
+
+			if(!x64)
+			{
+				symtab.word(name);
+				address(symtab, symbol->start);
+				symtab.word((unsigned int)(symbol->end - symbol->start));
+				symtab.byte(0x12);   // STB_GLOBAL, STT_FUNC
+				symtab.byte(0);
+				symtab.half(1);      // .text
+			}
+			else
+			{
+				symtab.word(name);
+				symtab.byte(0x12);
+				symtab.byte(0);
+				symtab.half(1);
+				address(symtab, symbol->start);
+				symtab.quad(symbol->end - symbol->start);
+			}
+		}
+
+		Buffer info;
+		Buffer abbrev;
+		Buffer line;
+		Buffer frame;
+
+		writeInfo(info, abbrev, start, end, sourceFile);
+		writeLines(line, start, end, sourceFile);
+		writeFrames(frame, start, end);
+
+		const Buffer *sections[] = {&symtab, &strtab, &shstrtab, &info, &abbrev, &line, &frame};
+		const int sectionCount = sizeof(sections) / sizeof(sections[0]);
+		int offsets[sectionCount];
+
+		const int headerSize = x64 ? 64 : 52;
+		int offset = headerSize;
+
+		for(int i = 0; i < sectionCount; i++)
+		{
+			offset = (offset + 7) & ~7;
+			offsets[i] = offset;
+			offset += sections[i]->size();
+		}
+
+		const int sectionTable = (offset + 7) & ~7;
+
+		Buffer elf;
+
+		// ELF header
+		unsigned char identification[16] = {0x7F, 'E', 'L', 'F', 1, 1, 1};
+		identification[4] = x64 ? 2 : 1;   // ELFCLASS64 or ELFCLASS32
+		elf.put(identification, 16);
+		elf.half(2);                // ET_EXEC, addresses are final
+		elf.half(x64 ? 62 : 3);     // EM_X86_64 or EM_386
+		elf.word(1);
+		address(elf, 0);            // Entry
+		address(elf, 0);            // Program headers
+		address(elf, (const unsigned char*)0 + sectionTable);
+		elf.word(0);
+		elf.half(headerSize);
+		elf.half(0);
+		elf.half(0);
+		elf.half(x64 ? 64 : 40);
+		elf.half(sectionCount + 2);
+		elf.half(4);                // .shstrtab
+
+		for(int i = 0; i < sectionCount; i++)
+		{
+			while(elf.size() < offsets[i]) elf.byte(0);
+
+			elf.put(sections[i]->data(), sections[i]->size());
+		}
+
+		while(elf.size() < sectionTable) elf.byte(0);
+
+		section(elf, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+		section(elf, textName, 8, 6, start, 0, (int)(end - start), 0, 0, 0);   // SHT_NOBITS, SHF_ALLOC | SHF_EXECINSTR
+		section(elf, symtabName, 2, 0, 0, offsets[0], symtab.size(), 3, 1, x64 ? 24 : 16);
+		section(elf, strtabName, 3, 0, 0, offsets[1], strtab.size(), 0, 0, 0);
+		section(elf, shstrtabName, 3, 0, 0, offsets[2], shstrtab.size(), 0, 0, 0);
+		section(elf, infoName, 1, 0, 0, offsets[3], info.size(), 0, 0, 0);
+		section(elf, abbrevName, 1, 0, 0, offsets[4], abbrev.size(), 0, 0, 0);
+		section(elf, lineName, 1, 0, 0, offsets[5], line.size(), 0, 0, 0);
+		section(elf, frameName, 1, 0, 0, offsets[6], frame.size(), 0, 0, 0);
+
+		object = new unsigned char[elf.size()];
+		memcpy(object, elf.data(), elf.size());
+
+		jit_code_entry *codeEntry = new jit_code_entry;
+		codeEntry->symfile_addr = (const char*)object;
+		codeEntry->symfile_size = elf.size();
+		codeEntry->prev_entry = 0;
+
+		lockDescriptor();
+
+		codeEntry->next_entry = __jit_debug_descriptor.first_entry;
+
+		if(codeEntry->next_entry) codeEntry->next_entry->prev_entry = codeEntry;
+		__jit_debug_descriptor.first_entry = codeEntry;
+
+		__jit_debug_descriptor.action_flag = JIT_REGISTER_FN;
+		__jit_debug_descriptor.relevant_entry = codeEntry;
+		__jit_debug_register_code();
+
+		unlockDescriptor();
+
+		entry = codeEntry;
+	}
+
+	void DebugInfo::address(Buffer &buffer, const unsigned char *address) const
+	{
+		if(x64)
+		{
+			buffer.quad((unsigned __int64)(size_t)address);
+		}
+		else
+		{
+			buffer.word((unsigned int)(size_t)address);
+		}
+	}
+
+	void DebugInfo::section(Buffer &buffer, int name, int type, int flags, const unsigned char *address, int offset, int size, int link, int info, int entrySize) const
+	{
+		const unsigned char *zero = 0;
+
+		buffer.word(name);
+		buffer.word(type);
+		this->address(buffer, zero + flags);
+		this->address(buffer, address);
+		this->address(buffer, zero + offset);
+		this->address(buffer, zero + size);
+		buffer.word(link);
+		buffer.word(info);
+		this->address(buffer, zero + (type == 2 ? (x64 ? 8 : 4) : 1));   // Alignment
+		this->address(buffer, zero + entrySize);
+	}
+
+	void DebugInfo::writeInfo(Buffer &buffer, Buffer &abbreviations, const unsigned char *start, const unsigned char *end, const char *sourceFile) const
+	{
+		// Single compilation unit without children
+		abbreviations.uleb(1);
+		abbreviations.uleb(0x11);   // DW_TAG_compile_unit
+		abbreviations.byte(0);
+		abbreviations.uleb(0x03); abbreviations.uleb(0x08);   // DW_AT_name, DW_FORM_string
+		abbreviations.uleb(0x11); abbreviations.uleb(0x01);   // DW_AT_low_pc, DW_FORM_addr
+		abbreviations.uleb(0x12); abbreviations.uleb(0x01);   // DW_AT_high_pc, DW_FORM_addr
+		abbreviations.uleb(0x10); abbreviations.uleb(0x06);   // DW_AT_stmt_list, DW_FORM_data4
+		abbreviations.uleb(0); abbreviations.uleb(0);
+		abbreviations.uleb(0);
+
+		buffer.word(0);   // Length
+		buffer.half(2);
+		buffer.word(0);   // Abbreviations offset
+		buffer.byte(x64 ? 8 : 4);
+		buffer.uleb(1);
+		buffer.string(sourceFile);
+		address(buffer, start);
+		address(buffer, end);
+		buffer.word(0);   // Line table offset
+
+		buffer.patch(0, buffer.size() - 4);
+	}
+
+	void DebugInfo::writeLines(Buffer &buffer, const unsigned char *start, const unsigned char *end, const char *sourceFile) const
+	{
+		const unsigned char opcodeLengths[12] = {0, 1, 1, 1, 1, 0, 0, 0, 1, 0, 0, 1};
+
+		buffer.word(0);   // Length
+		buffer.half(2);
+		buffer.word(0);   // Header length
+		int header = buffer.size();
+		buffer.byte(1);     // Minimum instruction length
+		buffer.byte(1);     // Default is statement
+		buffer.byte(-5);    // Line base
+		buffer.byte(14);    // Line range
+		buffer.byte(13);    // Opcode base
+		buffer.put(opcodeLengths, 12);
+		buffer.byte(0);     // No include directories
+		buffer.string(sourceFile);
+		buffer.uleb(0);
+		buffer.uleb(0);
+		buffer.uleb(0);
+		buffer.byte(0);
+		buffer.patch(6, buffer.size() - header);
+
+		buffer.byte(0);   // DW_LNE_set_address
+		buffer.uleb(1 + (x64 ? 8 : 4));
+		buffer.byte(2);
+		address(buffer, start);
+
+		const unsigned char *current = start;
+		int currentLine = 1;
+
+		for(const Link<Row> *row = lines; row; row = row->next())
+		{
+			if(row->address > current)
+			{
+				buffer.byte(2);   // DW_LNS_advance_pc
+				buffer.uleb((unsigned int)(row->address - current));
+				current = row->address;
+			}
+
+			if(row->value != currentLine)
+			{
+				buffer.byte(3);   // DW_LNS_advance_line
+				buffer.sleb(row->value - currentLine);
+				currentLine = row->value;
+			}
+
+			buffer.byte(1);   // DW_LNS_copy
+		}
+
+		if(end > current)
+		{
+			buffer.byte(2);
+			buffer.uleb((unsigned int)(end - current));
+		}
+
+		buffer.byte(0);   // DW_LNE_end_sequence
+		buffer.uleb(1);
+		buffer.byte(1);
+
+		buffer.patch(0, buffer.size() - 4);
+	}
+
+	void DebugInfo::writeFrames(Buffer &buffer, const unsigned char *start, const unsigned char *end) const
+	{
+		const int wordSize = x64 ? 8 : 4;
+		const int returnAddress = x64 ? 16 : 8;
+		const int stackPointer = x64 ? 7 : 4;
+		const int dwarfRegister[16] = {0, 2, 1, 3, 7, 6, 4, 5, 8, 9, 10, 11, 12, 13, 14, 15};   // x86-64 numbering
+
+		// Common information entry, CFA is stack pointer plus return address at function entry
+		buffer.word(0);
+		buffer.word(0xFFFFFFFF);
+		buffer.byte(1);
+		buffer.byte(0);   // No augmentation
+		buffer.uleb(1);
+		buffer.sleb(-wordSize);
+		buffer.byte(returnAddress);
+		buffer.byte(0x0C);   // DW_CFA_def_cfa
+		buffer.uleb(stackPointer);
+		buffer.uleb(wordSize);
+		buffer.byte(0x80 | returnAddress);   // DW_CFA_offset
+		buffer.uleb(1);
+
+		while(buffer.size() % wordSize) buffer.byte(0);   // DW_CFA_nop
+		buffer.patch(0, buffer.size() - 4);
+
+		// Frame description entry covering all code
+		int fde = buffer.size();
+		buffer.word(0);
+		buffer.word(0);   // CIE offset
+		address(buffer, start);
+		address(buffer, (const unsigned char*)0 + (end - start));
+
+		const unsigned char *current = start;
+
+		for(const Link<Row> *row = frames; row; row = row->next())
+		{
+			if(row->address > current)
+			{
+				buffer.byte(0x04);   // DW_CFA_advance_loc4
+				buffer.word((unsigned int)(row->address - current));
+				current = row->address;
+			}
+
+			if(row->reg == -1)
+			{
+				buffer.byte(0x0E);   // DW_CFA_def_cfa_offset
+				buffer.uleb(row->value + wordSize);
+			}
+			else
+			{
+				buffer.byte(0x80 | (x64 ? dwarfRegister[row->reg] : row->reg));
+				buffer.uleb((row->value + wordSize) / wordSize);
+			}
+		}
+
+		while((buffer.size() - fde) % wordSize) buffer.byte(0);
+		buffer.patch(fde, buffer.size() - fde - 4);
+	}
+}
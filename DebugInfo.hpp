@@ -0,0 +1,82 @@
+#ifndef SoftWire_DebugInfo_hpp
+#define SoftWire_DebugInfo_hpp
+
+#include "Link.hpp"
+
+namespace SoftWire
+{
+	// In-memory ELF object describing generated code, registered through the GDB JIT interface
+	class DebugInfo
+	{
+	public:
+		DebugInfo(bool x64);
+
+		virtual ~DebugInfo();   // Unregisters
+
+		void addSymbol(const char *name, const unsigned char *start, const unsigned char *end);
+		void addLine(const unsigned char *address, int line);
+		void addFrame(const unsigned char *address, int stack);   // Bytes pushed below return address
+		void addSavedRegister(const unsigned char *address, int reg, int stack);   // Encoding register number
+
+		void registerCode(const unsigned char *start, const unsigned char *end, const char *sourceFile);
+
+	private:
+		class Buffer
+		{
+		public:
+			Buffer();
+
+			~Buffer();
+
+			void put(const void *data, int size);
+			void byte(int value);
+			void half(int value);
+			void word(unsigned int value);
+			void quad(unsigned __int64 value);
+			void uleb(unsigned int value);
+			void sleb(int value);
+			void string(const char *string);
+			void patch(int offset, unsigned int value);
+
+			int size() const;
+			const unsigned char *data() const;
+
+		private:
+			unsigned char *buffer;
+			int length;
+			int capacity;
+		};
+
+		struct Symbol
+		{
+			char *name;
+			const unsigned char *start;
+			const unsigned char *end;
+		};
+
+		struct Row
+		{
+			const unsigned char *address;
+			int value;   // Line, or stack size
+			int reg;     // Saved register, -1 for stack size
+		};
+
+		const bool x64;
+
+		Link<Symbol> *symbols;
+		Link<Row> *lines;
+		Link<Row> *frames;
+
+		void *entry;   // Registered jit_code_entry
+		unsigned char *object;
+
+		void address(Buffer &buffer, const unsigned char *address) const;   // Word sized
+		void section(Buffer &buffer, int name, int type, int flags, const unsigned char *address, int offset, int size, int link, int info, int entrySize) const;
+
+		void writeLines(Buffer &buffer, const unsigned char *start, const unsigned char *end, const char *sourceFile) const;
+		void writeInfo(Buffer &buffer, Buffer &abbreviations, const unsigned char *start, const unsigned char *end, const char *sourceFile) const;
+		void writeFrames(Buffer &buffer, const unsigned char *start, const unsigned char *end) const;
+	};
+}
+
+#endif   // SoftWire_DebugInfo_hpp
@@ -0,0 +1,712 @@
+#include "Disassembler.hpp"
+
+#include "InstructionSet.hpp"
+#include "Instruction.hpp"
+#include "Error.hpp"
+#include "String.hpp"
+
+#ifdef WIN32
+	#include <windows.h>
+#else
+	#include <pthread.h>
+#endif
+
+namespace SoftWire
+{
+	InstructionSet *Disassembler::instructionSet = 0;
+	Disassembler::Form *Disassembler::forms = 0;
+	int Disassembler::bucket[257];
+
+	#ifdef WIN32
+		static SRWLOCK formLock = SRWLOCK_INIT;
+
+		static void lockForms() {AcquireSRWLockExclusive(&formLock);}
+		static void unlockForms() {ReleaseSRWLockExclusive(&formLock);}
+	#else
+		static pthread_mutex_t formLock = PTHREAD_MUTEX_INITIALIZER;
+
+		static void lockForms() {pthread_mutex_lock(&formLock);}
+		static void unlockForms() {pthread_mutex_unlock(&formLock);}
+	#endif
+
+	Disassembler::Disassembler(bool x64) : x64(x64)
+	{
+		lockForms();
+
+		if(!forms)
+		{
+			buildForms();   // Kept for the lifetime of the process
+		}
+
+		unlockForms();
+
+		form = 0;
+		rex = 0;
+		ripRelative = false;
+	}
+
+	Disassembler::~Disassembler()
+	{
+	}
+
+	void Disassembler::buildForms()
+	{
+		instructionSet = new InstructionSet();
+
+		int count = instructionSet->instructionCount();
+		Form *parsed = new Form[count];
+		int size[256] = {0};
+		int n = 0;
+
+		for(int i = 0; i < count; i++)
+		{
+			if(parseForm(parsed[n], instructionSet->instruction(i)))
+			{
+				for(int b = 0; b < span(parsed[n]); b++)
+				{
+					size[parsed[n].opcode[0] + b]++;
+				}
+
+				n++;
+			}
+		}
+
+		// Stable sort on first opcode byte, earlier forms take precedence over later ones and sized memory forms over untyped ones
+		int position[256];
+		bucket[0] = 0;
+
+		for(int b = 0; b < 256; b++)
+		{
+			position[b] = bucket[b];
+			bucket[b + 1] = bucket[b] + size[b];
+		}
+
+		forms = new Form[bucket[256]];
+
+		for(int last = 0; last < 2; last++)
+		{
+			for(int i = 0; i < n; i++)
+			{
+				if(untyped(parsed[i]) != (last == 1)) continue;
+
+				for(int b = 0; b < span(parsed[i]); b++)
+				{
+					forms[position[parsed[i].opcode[0] + b]++] = parsed[i];
+				}
+			}
+		}
+
+		delete[] parsed;
+	}
+
+	const Instruction *Disassembler::getInstruction() const
+	{
+		return form ? form->instruction : 0;
+	}
+
+	const Operand &Disassembler::getOperand(int i) const
+	{
+		if(i < 0 || i > 2)
+		{
+			throw INTERNAL_ERROR;
+		}
+
+		return operand[i];
+	}
+
+	bool Disassembler::parseForm(Form &form, const Instruction *instruction)
+	{
+		form.instruction = instruction;
+		form.prefixes = 0;
+		form.opcodes = 0;
+		form.addReg = false;
+		form.modRM = -1;
+		form.suffix = -1;
+		form.immediate = 0;
+		form.relative = false;
+
+		const char *format = instruction->getEncoding();
+
+		if(!format || instruction->isCyrix()) return false;   // Cyrix extended MMX reuses SSE opcodes
+
+		// Same interpretation as Synthesizer::encodeInstruction
+		while(*format)
+		{
+			switch((format[0] << 8) | format[1])
+			{
+			case LOCK_PRE:
+				form.prefixes |= PREFIX_LOCK;
+				break;
+			case CONST_PRE:
+				return false;   // Special 'instruction', not machine code
+			case REPNE_PRE:
+				form.prefixes |= PREFIX_REPNE;
+				break;
+			case REP_PRE:
+				form.prefixes |= PREFIX_REP;
+				break;
+			case OFF_PRE:
+				if(!instruction->is32Bit())
+				{
+					form.prefixes |= PREFIX_OFFSET;
+				}
+				break;
+			case ADDR_PRE:
+				if(!instruction->is32Bit())
+				{
+					form.prefixes |= PREFIX_ADDRESS;
+				}
+				break;
+			case ADD_REG:
+				form.addReg = true;
+				break;
+			case EFF_ADDR:
+				form.modRM = 8;
+				break;
+			case MOD_RM_0:
+			case MOD_RM_1:
+			case MOD_RM_2:
+			case MOD_RM_3:
+			case MOD_RM_4:
+			case MOD_RM_5:
+			case MOD_RM_6:
+			case MOD_RM_7:
+				form.modRM = format[1] - '0';
+				break;
+			case QWORD_IMM:
+				form.immediate = 8;
+				break;
+			case DWORD_IMM:
+				form.immediate = 4;
+				break;
+			case WORD_IMM:
+				form.immediate = 2;
+				break;
+			case BYTE_IMM:
+				form.immediate = 1;
+				break;
+			case BYTE_REL:
+				form.immediate = 1;
+				form.relative = true;
+				break;
+			case DWORD_REL:
+				form.immediate = 4;
+				form.relative = true;
+				break;
+			default:
+				unsigned char opcode = (unsigned char)strtoul(format, 0, 16);
+
+				if(form.opcodes == 0)
+				{
+					form.opcode[0] = opcode;
+					form.opcodes = 1;
+				}
+				else if(form.opcodes == 1 && (form.opcode[0] == 0x0F || (form.opcode[0] & 0xF8) == 0xD8))
+				{
+					form.opcode[1] = opcode;
+					form.opcodes = 2;
+				}
+				else if(form.opcodes == 1 && form.opcode[0] == 0x66)   // Operand size prefix for SSE2
+				{
+					form.prefixes |= PREFIX_OFFSET;
+					form.opcode[0] = opcode;
+				}
+				else if(form.opcodes == 1 && form.opcode[0] == 0x9B)   // FWAIT
+				{
+					form.prefixes |= PREFIX_WAIT;
+					form.opcode[0] = opcode;
+				}
+				else   // 3DNow!, SSE or SSE2 instruction, opcode as immediate
+				{
+					form.suffix = opcode;
+				}
+			}
+
+			format += 2;
+
+			if(*format == ' ')
+			{
+				format++;
+			}
+		}
+
+		return form.opcodes != 0;
+	}
+
+	int Disassembler::span(const Form &form)
+	{
+		return form.addReg && form.opcodes == 1 ? 8 : 1;   // Register in first opcode byte
+	}
+
+	bool Disassembler::untyped(const Form &form)
+	{
+		const Instruction *instruction = form.instruction;
+
+		return instruction->getFirstOperand() == Operand::OPERAND_MEM ||
+		       instruction->getSecondOperand() == Operand::OPERAND_MEM ||
+		       instruction->getThirdOperand() == Operand::OPERAND_MEM;
+	}
+
+	int Disassembler::prefix(unsigned char byte)
+	{
+		switch(byte)
+		{
+		case 0xF0: return PREFIX_LOCK;
+		case 0xF2: return PREFIX_REPNE;
+		case 0xF3: return PREFIX_REP;
+		case 0x66: return PREFIX_OFFSET;
+		case 0x67: return PREFIX_ADDRESS;
+		case 0x9B: return PREFIX_WAIT;
+		}
+
+		return 0;
+	}
+
+	int Disassembler::disassemble(const unsigned char *code, int length, char *text, int size)
+	{
+		form = 0;
+
+		int prefixes = 0;
+		int n = 0;   // Prefix bytes
+
+		while(n < length && n < 4 && prefix(code[n]) && !(prefixes & prefix(code[n])))
+		{
+			prefixes |= prefix(code[n]);
+			n++;
+		}
+
+		int count = decode(code, n, prefixes, length);
+
+		if(!count && n)   // Prefix byte as instruction by itself, like FWAIT
+		{
+			count = decode(code, 0, 0, length);
+		}
+
+		if(text && size > 0)
+		{
+			if(count)
+			{
+				print(text, size, code + count);
+			}
+			else
+			{
+				text[0] = '\0';
+			}
+		}
+
+		return count;
+	}
+
+	int Disassembler::decode(const unsigned char *code, int start, int prefixes, int length)
+	{
+		const unsigned char *opcode = code + start;
+		const unsigned char *end = code + length;
+
+		rex = 0;
+
+		if(x64 && opcode < end && (*opcode & 0xF0) == 0x40)
+		{
+			rex = *opcode++;
+		}
+
+		if(opcode >= end)
+		{
+			return 0;
+		}
+
+		for(int i = bucket[*opcode]; i < bucket[*opcode + 1]; i++)
+		{
+			if(forms[i].prefixes != prefixes)
+			{
+				continue;
+			}
+
+			int count = match(forms[i], code, opcode, end);
+
+			if(count)
+			{
+				form = &forms[i];
+
+				return count;
+			}
+		}
+
+		return 0;
+	}
+
+	int Disassembler::match(const Form &form, const unsigned char *code, const unsigned char *opcode, const unsigned char *end)
+	{
+		const Instruction *instruction = form.instruction;
+
+		if(x64 ? instruction->isInvalid64() : instruction->is64Bit())
+		{
+			return 0;
+		}
+
+		if(((rex & 0x08) != 0) != instruction->is64Bit())
+		{
+			return 0;
+		}
+
+		const unsigned char *p = opcode;
+		unsigned char last = 0;
+
+		for(int i = 0; i < form.opcodes; i++)
+		{
+			if(p >= end) return 0;
+
+			last = *p++;
+
+			unsigned char byte = last;
+
+			if(form.addReg && i == form.opcodes - 1)
+			{
+				byte &= 0xF8;
+			}
+
+			if(byte != form.opcode[i])
+			{
+				return 0;
+			}
+		}
+
+		Operand::Type type[3];
+		type[0] = instruction->getFirstOperand();
+		type[1] = instruction->getSecondOperand();
+		type[2] = instruction->getThirdOperand();
+
+		Operand decoded[3];
+
+		for(int i = 0; i < 3; i++)
+		{
+			decoded[i].type = type[i];
+			decoded[i].reference = 0;
+			decoded[i].value = 0;
+			decoded[i].indexReg = Encoding::REG_UNKNOWN;
+			decoded[i].scale = 0;
+			decoded[i].displacement = 0;
+
+			switch(type[i])
+			{
+			case Operand::OPERAND_CL:
+			case Operand::OPERAND_CX:
+			case Operand::OPERAND_ECX:
+				decoded[i].reg = Encoding::ECX;
+				break;
+			case Operand::OPERAND_DX:
+				decoded[i].reg = Encoding::EDX;
+				break;
+			case Operand::OPERAND_ONE:
+				decoded[i].value = 1;
+				break;
+			default:
+				break;
+			}
+		}
+
+		bool rip = false;
+
+		if(form.modRM != -1)
+		{
+			// Operand roles as in Synthesizer::encodeR_MField and encodeRegField
+			int r_m = 0;
+			int reg = 0;
+
+			if(Operand::isReg(type[0]) && Operand::isR_M(type[1]))
+			{
+				r_m = 1;
+				reg = 0;
+			}
+			else if(Operand::isR_M(type[0]) && Operand::isReg(type[1]))
+			{
+				r_m = 0;
+				reg = 1;
+			}
+
+			if(p >= end) return 0;
+
+			int mod = *p >> 6;
+			int field = (*p >> 3) & 0x07;
+			int rm = *p & 0x07;
+			p++;
+
+			if(form.modRM != 8 && field != form.modRM)
+			{
+				return 0;
+			}
+
+			Operand &m = decoded[r_m];
+
+			if(mod == Encoding::MOD_REG)
+			{
+				if(!(type[r_m] & Operand::OPERAND_REG)) return 0;
+
+				m.type = (Operand::Type)(type[r_m] & Operand::OPERAND_REG);
+				m.reg = rm | (rex & 0x01) << 3;
+			}
+			else
+			{
+				if(!(type[r_m] & Operand::OPERAND_MEM)) return 0;
+
+				m.type = (Operand::Type)(type[r_m] & Operand::OPERAND_MEM);
+				m.baseReg = Encoding::REG_UNKNOWN;
+
+				int displacement = mod == Encoding::MOD_BYTE_DISP ? 1 : (mod == Encoding::MOD_DWORD_DISP ? 4 : 0);
+
+				if(rm == Encoding::ESP)   // SIB byte
+				{
+					if(p >= end) return 0;
+
+					int base = *p & 0x07;
+					int index = ((*p >> 3) & 0x07) | (rex & 0x02) << 2;
+					int scale = *p >> 6;
+					p++;
+
+					if(index != Encoding::ESP)
+					{
+						m.indexReg = index;
+						m.scale = 1 << scale;
+					}
+
+					if(base == Encoding::EBP && mod == Encoding::MOD_NO_DISP)
+					{
+						displacement = 4;   // No base
+					}
+					else
+					{
+						m.baseReg = base | (rex & 0x01) << 3;
+					}
+				}
+				else if(rm == Encoding::EBP && mod == Encoding::MOD_NO_DISP)
+				{
+					displacement = 4;   // Static address
+					rip = x64;
+				}
+				else
+				{
+					m.baseReg = rm | (rex & 0x01) << 3;
+				}
+
+				if(p + displacement > end) return 0;
+
+				if(displacement == 1)
+				{
+					m.displacement = (char)p[0];
+				}
+				else if(displacement == 4)
+				{
+					m.displacement = p[0] | p[1] << 8 | p[2] << 16 | p[3] << 24;
+				}
+
+				p += displacement;
+			}
+
+			if(form.modRM == 8)
+			{
+				int value = field | (rex & 0x04) << 1;
+
+				if(reg == r_m)   // Register used twice, like IMUL reg,imm
+				{
+					if(mod != Encoding::MOD_REG || value != m.reg) return 0;
+				}
+				else
+				{
+					if(!(type[reg] & Operand::OPERAND_REG)) return 0;
+
+					decoded[reg].type = (Operand::Type)(type[reg] & Operand::OPERAND_REG);
+					decoded[reg].reg = value;
+				}
+			}
+		}
+
+		if(form.addReg)
+		{
+			int add = Operand::isImplicit(type[0]) && Operand::isReg(type[1]) ? 1 : 0;   // As Synthesizer
+
+			decoded[add].reg = (last & 0x07) | (rex & 0x01) << 3;
+		}
+
+		if(form.suffix != -1)
+		{
+			if(p >= end || *p != form.suffix) return 0;
+
+			p++;
+		}
+
+		if(form.immediate)
+		{
+			if(p + form.immediate > end) return 0;
+
+			__int64 value = 0;
+
+			for(int i = 0; i < form.immediate; i++)
+			{
+				value |= (__int64)p[i] << (8 * i);
+			}
+
+			if(form.immediate == 4)
+			{
+				value = (int)value;
+			}
+
+			if(form.relative && form.immediate == 1)
+			{
+				value = (char)value;
+			}
+
+			p += form.immediate;
+
+			for(int i = 0; i < 3; i++)
+			{
+				if(type[i] == Operand::OPERAND_IMM64)
+				{
+					decoded[i].quad = value;
+					break;
+				}
+				else if(Operand::isImm(type[i]) && type[i] != Operand::OPERAND_ONE)
+				{
+					decoded[i].value = (int)value;
+					break;
+				}
+			}
+		}
+
+		for(int i = 0; i < 3; i++)
+		{
+			operand[i] = decoded[i];
+		}
+
+		ripRelative = rip;
+
+		return (int)(p - code);
+	}
+
+	int Disassembler::print(char *text, int size, const unsigned char *next) const
+	{
+		char mnemonic[32];
+		strncpy(mnemonic, form->instruction->getMnemonic(), 31);
+		mnemonic[31] = '\0';
+
+		int n = snprintf(text, size, "%s", strlwr(mnemonic));
+
+		for(int i = 0; i < 3 && n < size; i++)
+		{
+			if(Operand::isVoid(operand[i]))
+			{
+				break;
+			}
+
+			n += snprintf(text + n, size - n, i == 0 ? "\t" : ", ");
+
+			if(n < size)
+			{
+				n += printOperand(text + n, size - n, operand[i], next);
+			}
+		}
+
+		return n < size ? n : size - 1;
+	}
+
+	int Disassembler::printOperand(char *text, int size, const Operand &operand, const unsigned char *next) const
+	{
+		if(Operand::isReg(operand))
+		{
+			return snprintf(text, size, "%s", registerName(operand.type, operand.reg));
+		}
+		else if(Operand::isMem(operand))
+		{
+			const char *specifier = "";
+
+			switch(operand.type)
+			{
+			case Operand::OPERAND_MEM8:   specifier = "byte ptr ";    break;
+			case Operand::OPERAND_MEM16:  specifier = "word ptr ";    break;
+			case Operand::OPERAND_MEM32:  specifier = "dword ptr ";   break;
+			case Operand::OPERAND_MEM64:  specifier = "qword ptr ";   break;
+			case Operand::OPERAND_MEM128: specifier = "xmmword ptr "; break;
+			default:                      break;
+			}
+
+			if(ripRelative)
+			{
+				return snprintf(text, size, "%s[%p]", specifier, next + operand.displacement);
+			}
+
+			const Operand::Type address = x64 ? Operand::OPERAND_REG64 : Operand::OPERAND_REG32;
+			char string[64] = "";
+			int n = 0;
+
+			if(operand.baseReg != Encoding::REG_UNKNOWN)
+			{
+				n += snprintf(string + n, 64 - n, "%s", registerName(address, operand.baseReg));
+			}
+
+			if(operand.indexReg != Encoding::REG_UNKNOWN)
+			{
+				n += snprintf(string + n, 64 - n, n ? "+%s" : "%s", registerName(address, operand.indexReg));
+
+				if(operand.scale > 1)
+				{
+					n += snprintf(string + n, 64 - n, "*%d", operand.scale);
+				}
+			}
+
+			if(!n)
+			{
+				snprintf(string, 64, "0x%.8X", (int)operand.displacement);
+			}
+			else if(operand.displacement < 0)
+			{
+				snprintf(string + n, 64 - n, "-0x%X", -(int)operand.displacement);
+			}
+			else if(operand.displacement > 0)
+			{
+				snprintf(string + n, 64 - n, "+0x%X", (int)operand.displacement);
+			}
+
+			return snprintf(text, size, "%s[%s]", specifier, string);
+		}
+		else if(Operand::isImm(operand))
+		{
+			if(form->relative)
+			{
+				return snprintf(text, size, "%p", next + operand.value);
+			}
+
+			switch(form->immediate)
+			{
+			case 1:  return snprintf(text, size, "0x%.2X", operand.value & 0xFF);
+			case 2:  return snprintf(text, size, "0x%.4X", operand.value & 0xFFFF);
+			case 4:  return snprintf(text, size, "0x%.8X", operand.value);
+			case 8:  return snprintf(text, size, "0x%.8X%.8X", (unsigned int)(operand.quad >> 32), (unsigned int)operand.quad);
+			default: return snprintf(text, size, "%d", operand.value);
+			}
+		}
+
+		throw INTERNAL_ERROR;
+	}
+
+	const char *Disassembler::registerName(Operand::Type type, int reg) const
+	{
+		static const char *const reg8[] = {"al", "cl", "dl", "bl", "ah", "ch", "dh", "bh", "r8b", "r9b", "r10b", "r11b", "r12b", "r13b", "r14b", "r15b"};
+		static const char *const rex8[] = {"al", "cl", "dl", "bl", "spl", "bpl", "sil", "dil"};
+		static const char *const reg16[] = {"ax", "cx", "dx", "bx", "sp", "bp", "si", "di", "r8w", "r9w", "r10w", "r11w", "r12w", "r13w", "r14w", "r15w"};
+		static const char *const reg32[] = {"eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi", "r8d", "r9d", "r10d", "r11d", "r12d", "r13d", "r14d", "r15d"};
+		static const char *const reg64[] = {"rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi", "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15"};
+		static const char *const fpureg[] = {"st0", "st1", "st2", "st3", "st4", "st5", "st6", "st7"};
+		static const char *const mmreg[] = {"mm0", "mm1", "mm2", "mm3", "mm4", "mm5", "mm6", "mm7"};
+		static const char *const xmmreg[] = {"xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7", "xmm8", "xmm9", "xmm10", "xmm11", "xmm12", "xmm13", "xmm14", "xmm15"};
+
+		reg &= 0x0F;
+
+		if(Operand::isSubtypeOf(type, Operand::OPERAND_XMMREG))		return xmmreg[reg];
+		else if(Operand::isSubtypeOf(type, Operand::OPERAND_MMREG))	return mmreg[reg & 0x07];
+		else if(Operand::isSubtypeOf(type, Operand::OPERAND_FPUREG))	return fpureg[reg & 0x07];
+		else if(Operand::isSubtypeOf(type, Operand::OPERAND_REG64))	return reg64[reg];
+		else if(Operand::isSubtypeOf(type, Operand::OPERAND_REG32))	return reg32[reg];
+		else if(Operand::isSubtypeOf(type, Operand::OPERAND_REG16))	return reg16[reg];
+		else if(Operand::isSubtypeOf(type, Operand::OPERAND_REG8))		return rex && reg < 8 ? rex8[reg] : reg8[reg];
+
+		throw INTERNAL_ERROR;
+	}
+}
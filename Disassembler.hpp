@@ -0,0 +1,78 @@
+#ifndef SoftWire_Disassembler_hpp
+#define SoftWire_Disassembler_hpp
+
+#include "Operand.hpp"
+
+namespace SoftWire
+{
+	class Instruction;
+	class InstructionSet;
+
+	// Decodes machine code by matching it against the encoding syntax of the instruction set
+	class Disassembler
+	{
+	public:
+		Disassembler(bool x64);
+
+		virtual ~Disassembler();
+
+		// Returns instruction length, 0 if no form matches within length bytes
+		int disassemble(const unsigned char *code, int length, char *text = 0, int size = 0);
+
+		// Last decoded instruction, with operands suitable for re-encoding
+		const Instruction *getInstruction() const;
+		const Operand &getOperand(int i) const;
+
+	private:
+		enum
+		{
+			PREFIX_LOCK		= 0x01,
+			PREFIX_REPNE	= 0x02,
+			PREFIX_REP		= 0x04,
+			PREFIX_OFFSET	= 0x08,
+			PREFIX_ADDRESS	= 0x10,
+			PREFIX_WAIT		= 0x20
+		};
+
+		struct Form
+		{
+			const Instruction *instruction;
+
+			int prefixes;
+			unsigned char opcode[2];
+			int opcodes;
+			bool addReg;     // '+r' on last opcode byte
+			int modRM;       // Register field value, 8 for '/r', -1 if absent
+			int suffix;      // Opcode byte in immediate position, -1 if absent
+			int immediate;   // Bytes
+			bool relative;
+		};
+
+		const bool x64;
+
+		// Decoder tables shared by all disassemblers, built on first use
+		static InstructionSet *instructionSet;
+		static Form *forms;
+		static int bucket[257];   // Forms sorted by first opcode byte, in table order
+
+		const Form *form;
+		Operand operand[3];
+		int rex;
+		bool ripRelative;
+
+		static void buildForms();
+		static bool parseForm(Form &form, const Instruction *instruction);
+		static int span(const Form &form);
+		static bool untyped(const Form &form);   // Memory operand without size, like JMP mem
+		static int prefix(unsigned char byte);
+
+		int decode(const unsigned char *code, int start, int prefixes, int length);
+		int match(const Form &form, const unsigned char *code, const unsigned char *opcode, const unsigned char *end);
+
+		int print(char *text, int size, const unsigned char *next) const;
+		int printOperand(char *text, int size, const Operand &operand, const unsigned char *next) const;
+		const char *registerName(Operand::Type type, int reg) const;
+	};
+}
+
+#endif   // SoftWire_Disassembler_hpp
@@ -1,5 +1,7 @@
 #include "Emulator.hpp"
 
+#include "Statistics.hpp"
+
 #include <stdio.h>
 
 namespace SoftWire
@@ -47,6 +49,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -77,6 +81,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 
@@ -112,6 +118,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -128,6 +136,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 			fld(dword_ptr [&sse[i][0]]);
@@ -149,6 +159,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
 
@@ -179,6 +191,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmm.reg;
 
 			mov(t32(0), (OperandMEM32)(mem128+0));
@@ -214,6 +228,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
 
@@ -240,6 +256,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmm.reg;
 
 			mov(t32(0), (OperandMEM32)(mem128+0));
@@ -271,6 +289,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -460,6 +480,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 			static float zero = 0;
@@ -774,6 +796,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -837,6 +861,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 			static float zero = 0;
@@ -1025,6 +1051,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -1044,6 +1072,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 			
@@ -1068,6 +1098,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			static int dword[2];
 			movq(qword_ptr [dword], mm);
 			const int i = xmm.reg;
@@ -1088,6 +1120,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 
@@ -1112,6 +1146,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			static int dword[2];
 
 			spillMMXcept(mm);
@@ -1142,6 +1178,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			static int dword[2];
 
 			spillMMXcept(mm);
@@ -1177,6 +1215,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			static int dword[2];
 			spillMMXcept(mm);
 			const int i = xmm.reg;
@@ -1206,6 +1246,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			static int dword[2];
 
 			spillMMXcept(mm);
@@ -1241,6 +1283,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 			static int dword;
@@ -1259,6 +1303,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 
@@ -1281,6 +1327,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 		//	short fpuCW1;
@@ -1308,6 +1356,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 		//	short fpuCW1;
 		//	short fpuCW2;
@@ -1340,6 +1390,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 			static short fpuCW1;
@@ -1367,6 +1419,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			static short fpuCW1;
 			static short fpuCW2;
@@ -1399,6 +1453,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -1424,6 +1480,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 			fld(dword_ptr [&sse[i][0]]);
@@ -1454,6 +1512,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -1470,6 +1530,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 			fld(dword_ptr [&sse[i][0]]);
@@ -1491,6 +1553,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			return 0;
 		}
 		
@@ -1501,6 +1565,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			static short qword1[4];
 			static short qword2[4];
 
@@ -1558,6 +1624,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -1600,6 +1668,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 
@@ -1647,6 +1717,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -1668,6 +1740,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 
@@ -1694,6 +1768,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -1736,6 +1812,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 
@@ -1783,6 +1861,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -1804,6 +1884,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 
@@ -1830,6 +1912,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
 
@@ -1856,6 +1940,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmm.reg;
 
 			mov(t32(0), (OperandMEM32)(m128+0));
@@ -1887,6 +1973,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmm.reg;
 
 			mov(t32(0), dword_ptr [&sse[i][0]]);
@@ -1918,6 +2006,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
 
@@ -1938,6 +2028,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmm.reg;
 
 			mov(t32(0), (OperandMEM32)(m64+0));
@@ -1957,6 +2049,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmm.reg;
 
 			mov(t32(0), dword_ptr [&sse[i][2]]);
@@ -1976,6 +2070,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
 
@@ -1996,6 +2092,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
 
@@ -2016,6 +2114,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmm.reg;
 
 			mov(t32(0), (OperandMEM32)(m64+0));
@@ -2035,6 +2135,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmm.reg;
 
 			mov(t32(0), dword_ptr [&sse[i][0]]);
@@ -2054,6 +2156,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmm.reg;
 
 			mov(t32(0), dword_ptr [&sse[i][0]]);
@@ -2086,6 +2190,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmm.reg;
 
 			mov(t32(0), dword_ptr [&sse[i][0]]);
@@ -2111,6 +2217,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmm.reg;
 
 			mov(t32(0), dword_ptr [&sse[i][0]]);
@@ -2130,6 +2238,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
 
@@ -2147,6 +2257,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmm.reg;
 
 			mov(t32(0), m32);
@@ -2173,6 +2285,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmm.reg;
 
 			mov(t32(0), dword_ptr [&sse[i][0]]);
@@ -2195,6 +2309,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
 
@@ -2221,6 +2337,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmm.reg;
 
 			mov(t32(0), (OperandMEM32)(m128+0));
@@ -2246,6 +2364,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			return movaps(xmm, r_m128);
 		}
 		else
@@ -2258,6 +2378,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			return movaps(m128, xmm);
 		}
 		else
@@ -2270,6 +2392,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			return movaps(r_m128, xmm);
 		}
 		else
@@ -2282,6 +2406,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -2307,6 +2433,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 			fld(dword_ptr [&sse[i][0]]);
@@ -2337,6 +2465,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -2353,6 +2483,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 			fld(dword_ptr [&sse[i][0]]);
@@ -2374,6 +2506,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
 
@@ -2400,6 +2534,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmm.reg;
 
 			mov(t32(0), (OperandMEM32)(mem128+0));
@@ -2431,6 +2567,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			static unsigned char byte1[8];
 			static unsigned char byte2[8];
 
@@ -2499,6 +2637,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			static unsigned char byte1[8];
 
 			movq(qword_ptr [byte1], mm);
@@ -2573,6 +2713,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			static unsigned short word1[4];
 			static unsigned short word2[4];
 
@@ -2617,6 +2759,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			static unsigned char word1[8];
 
 			movq(qword_ptr [word1], mm);
@@ -2665,6 +2809,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			static short word[4];
 
 			movq(qword_ptr [word], mm);
@@ -2681,6 +2827,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			static short word[4];
 
 			movq(qword_ptr [word], mm);
@@ -2697,6 +2845,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			static short word[4];
 
 			movq(qword_ptr [word], mm);
@@ -2721,6 +2871,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			throw Error("Unimplemented SSE instruction emulation");
 		}
 		
@@ -2731,6 +2883,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			throw Error("Unimplemented SSE instruction emulation");
 		}
 		
@@ -2741,6 +2895,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			throw Error("Unimplemented SSE instruction emulation");
 		}
 		
@@ -2751,6 +2907,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			throw Error("Unimplemented SSE instruction emulation");
 		}
 		
@@ -2761,6 +2919,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			throw Error("Unimplemented SSE instruction emulation");
 		}
 		
@@ -2771,6 +2931,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			throw Error("Unimplemented SSE instruction emulation");
 		}
 		
@@ -2781,6 +2943,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			throw Error("Unimplemented SSE instruction emulation");
 		}
 		
@@ -2791,6 +2955,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			throw Error("Unimplemented SSE instruction emulation");
 		}
 		
@@ -2801,6 +2967,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			throw Error("Unimplemented SSE instruction emulation");
 		}
 		
@@ -2811,6 +2979,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			throw Error("Unimplemented SSE instruction emulation");
 		}
 		
@@ -2821,6 +2991,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			throw Error("Unimplemented SSE instruction emulation");
 		}
 		
@@ -2831,6 +3003,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			throw Error("Unimplemented SSE instruction emulation");
 		}
 		
@@ -2841,6 +3015,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			static short word1[4];
 			static short word2[4];
 
@@ -2879,6 +3055,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			static short word1[4];
 			static short word2[4];
 
@@ -2924,6 +3102,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			return 0;
 		}
 		
@@ -2934,6 +3114,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			return 0;
 		}
 		
@@ -2944,6 +3126,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			return 0;
 		}
 		
@@ -2954,6 +3138,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			return 0;
 		}
 
@@ -2964,6 +3150,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			static short word1[4];
 			static short word2[4];
 
@@ -2994,6 +3182,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			static short word[4];
 
 			mov(t16(0), (OperandMEM16)(m64+((c>>0)&0x03)*2));
@@ -3027,6 +3217,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -3053,6 +3245,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 			static float one = 1.0f;
@@ -3084,6 +3278,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -3101,6 +3297,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 			static float one = 1.0f;
@@ -3123,6 +3321,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -3153,6 +3353,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 			static float one = 1.0f;
@@ -3188,6 +3390,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -3206,6 +3410,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 			static float one = 1.0f;
@@ -3229,6 +3435,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			return 0;
 		}
 		
@@ -3239,6 +3447,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
 
@@ -3265,6 +3475,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmm.reg;
 
 			mov(t32(0), dword_ptr [&sse[i][(c >> 0) & 0x03]]);
@@ -3296,6 +3508,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -3321,6 +3535,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 			fld((OperandMEM32)(mem128+0));
@@ -3351,6 +3567,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -3367,6 +3585,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 			static float one = 1.0f;
@@ -3389,6 +3609,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			return 0;
 		}
 		
@@ -3399,6 +3621,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -3424,6 +3648,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 			fld(dword_ptr [&sse[i][0]]);
@@ -3454,6 +3680,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -3470,6 +3698,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 			fld(dword_ptr [&sse[i][0]]);
@@ -3491,6 +3721,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
@@ -3510,6 +3742,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			spillMMX();
 			const int i = xmm.reg;
 			
@@ -3534,6 +3768,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
 
@@ -3560,6 +3796,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmm.reg;
 
 			mov(t32(0), dword_ptr [&sse[i][2]]);
@@ -3591,6 +3829,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
 
@@ -3617,6 +3857,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmm.reg;
 
 			mov(t32(0), dword_ptr [&sse[i][0]]);
@@ -3648,6 +3890,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmmi.reg;
 			const int j = xmmj.reg;
 
@@ -3674,6 +3918,8 @@ namespace SoftWire
 	{
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			const int i = xmm.reg;
 
 			mov(t32(0), (OperandMEM32)(mem128+0));
@@ -3711,6 +3957,11 @@ namespace SoftWire
 		emulateSSE = false;
 	}
 
+	bool Emulator::emulatingSSE()
+	{
+		return emulateSSE;
+	}
+
 	void Emulator::dumpSSE()
 	{
 		pushad();
@@ -3733,6 +3984,8 @@ namespace SoftWire
 
 		if(emulateSSE)
 		{
+			Statistics::Scope scope(statistics, Statistics::PHASE_EMULATION);
+
 			name = "dumpEmulate.txt";
 		}
 		else
@@ -11,6 +11,7 @@ namespace SoftWire
 		// Emulation flags
 		static void enableEmulateSSE();   // Default off
 		static void disableEmulateSSE();
+		static bool emulatingSSE();
 
 	protected:
 		Emulator(bool x64);
@@ -18,10 +18,19 @@ namespace SoftWire
 		format.O1 = true;
 
 		emit = true;
+		cold = false;
+
+		alignment = 0;
+		span = 0;
+
+		line = 0;
 	}
 
 	Encoding::Encoding(const Encoding &encoding)
 	{
+		label = 0;
+		reference = 0;
+
 		*this = encoding;
 	}
 
@@ -33,8 +42,16 @@ namespace SoftWire
 
 	Encoding &Encoding::operator=(const Encoding &encoding)
 	{
+		if(this == &encoding)
+		{
+			return *this;
+		}
+
 		instruction = encoding.instruction;
 
+		delete[] label;
+		delete[] reference;
+
 		if (encoding.label) label = strdup(encoding.label);
 		else label = 0;
 		
@@ -59,6 +76,12 @@ namespace SoftWire
 		displacement = encoding.displacement;
 
 		emit = encoding.emit;
+		cold = encoding.cold;
+
+		alignment = encoding.alignment;
+		span = encoding.span;
+
+		line = encoding.line;
 
 		return *this;
 	}
@@ -89,6 +112,10 @@ namespace SoftWire
 		format.I2 = false;
 		format.I3 = false;
 		format.I4 = false;
+		format.I5 = false;
+		format.I6 = false;
+		format.I7 = false;
+		format.I8 = false;
 
 		P1 = 0xCC;
 		P2 = 0xCC;
@@ -107,10 +134,20 @@ namespace SoftWire
 		I2 = 0xCC;
 		I3 = 0xCC;
 		I4 = 0xCC;
+		I5 = 0xCC;
+		I6 = 0xCC;
+		I7 = 0xCC;
+		I8 = 0xCC;
 
 		address = 0;
 
 		emit = true;
+		cold = false;
+
+		alignment = 0;
+		span = 0;
+
+		line = 0;
 	}
 
 	const char *Encoding::getLabel() const
@@ -118,6 +155,16 @@ namespace SoftWire
 		return label;
 	}
 
+	const char *Encoding::getMnemonic() const
+	{
+		return instruction ? instruction->getMnemonic() : 0;
+	}
+
+	const Instruction *Encoding::getInstruction() const
+	{
+		return instruction;
+	}
+
 	const char *Encoding::getReference() const
 	{
 		if(P1 != 0xF1)
@@ -142,7 +189,7 @@ namespace SoftWire
 		}
 	}
 
-	int Encoding::getImmediate() const
+	__int64 Encoding::getImmediate() const
 	{
 		return immediate;
 	}
@@ -185,7 +232,7 @@ namespace SoftWire
 		}
 	}
 
-	void Encoding::setImmediate(int immediate)
+	void Encoding::setImmediate(__int64 immediate)
 	{
 		this->immediate = immediate;
 	}
@@ -232,6 +279,7 @@ namespace SoftWire
 	{
 		if(label != 0)
 		{
+			delete[] reference;
 			reference = strdup(label);
 		}
 	}
@@ -256,11 +304,185 @@ namespace SoftWire
 		return format.I1 || format.I2 || format.I3 || format.I4;
 	}
 
+	bool Encoding::hasQuadImmediate() const
+	{
+		return format.I8;
+	}
+
+	bool Encoding::signExtendsImmediate() const
+	{
+		if(format.REX && REX.W)
+		{
+			return true;
+		}
+
+		return !format.O2 && O1 == 0x68;   // PUSH imm32
+	}
+
 	bool Encoding::isRipRelative() const
 	{
 		return modRM.mod == 0 && modRM.r_m == 5;
 	}
 
+	bool Encoding::conditionalBranch() const
+	{
+		if(!relative || format.P1)
+		{
+			return false;
+		}
+
+		if(format.O2 && O2 == 0x0F && (O1 & 0xF0) == 0x80)   // Jcc rel32
+		{
+			return true;
+		}
+		else if(!format.O2 && (O1 & 0xF0) == 0x70)   // Jcc rel8
+		{
+			return true;
+		}
+
+		return false;
+	}
+
+	void Encoding::trackStack(int &stack, int &frame, int wordSize) const
+	{
+		if(!emit || (format.P1 && P1 == 0xF1))
+		{
+			return;
+		}
+
+		int rm = modRM.r_m + (format.REX && REX.B ? 8 : 0);
+		int r = modRM.reg + (format.REX && REX.R ? 8 : 0);
+		bool registers = format.modRM && modRM.mod == MOD_REG;
+
+		if(format.O2)
+		{
+			return;
+		}
+
+		switch(O1)
+		{
+		case 0x50: case 0x51: case 0x52: case 0x53:   // PUSH r
+		case 0x54: case 0x55: case 0x56: case 0x57:
+		case 0x68: case 0x6A: case 0x9C:              // PUSH imm, PUSHF
+			stack += wordSize;
+			break;
+		case 0x58: case 0x59: case 0x5A: case 0x5B:   // POP r
+		case 0x5C: case 0x5D: case 0x5E: case 0x5F:
+		case 0x9D:                                    // POPF
+			stack -= wordSize;
+			break;
+		case 0x81:
+		case 0x83:
+			if(registers && rm == ESP && modRM.reg == 5) stack += immediate;   // SUB esp, imm
+			else if(registers && rm == ESP && modRM.reg == 0) stack -= immediate;   // ADD esp, imm
+			else if(registers && rm == EBP && modRM.reg == 5 && frame != -1) frame += immediate;
+			else if(registers && rm == EBP && modRM.reg == 0 && frame != -1) frame -= immediate;
+			else if(registers && rm == EBP) frame = -1;
+			break;
+		case 0x89:
+			if(registers && rm == EBP) frame = (r == ESP) ? stack : -1;   // MOV ebp, esp
+			break;
+		case 0x8B:
+			if(r == EBP) frame = (registers && rm == ESP) ? stack : -1;
+			break;
+		case 0x8D:
+			if(r == ESP && format.modRM && modRM.mod != MOD_REG && rm == EBP && !format.SIB && frame != -1) stack = frame - (int)displacement;   // LEA esp, [ebp+disp]
+			else if(r == EBP) frame = -1;
+			break;
+		case 0xFF:
+			if(format.modRM && modRM.reg == 6) stack += wordSize;   // PUSH r/m
+			break;
+		default:
+			if(format.modRM && (r == EBP || (registers && rm == EBP)) && (O1 & 0xFC) != 0x38 && (O1 & 0xFE) != 0x84) frame = -1;   // Possibly overwritten, CMP/TEST don't
+		}
+	}
+
+	int Encoding::pushedRegister() const
+	{
+		if(!emit || format.O2 || !format.O1 || (format.P1 && P1 == 0xF1) || O1 < 0x50 || O1 > 0x57)
+		{
+			return -1;
+		}
+
+		return (O1 - 0x50) + (format.REX && REX.B ? 8 : 0);
+	}
+
+	bool Encoding::invertBranch()
+	{
+		if(!conditionalBranch())
+		{
+			return false;
+		}
+
+		O1 ^= 0x01;
+
+		return true;
+	}
+
+	bool Encoding::fallsThrough() const
+	{
+		if(!emit || format.O2 || format.P1)
+		{
+			return true;
+		}
+
+		switch(O1)
+		{
+		case 0xC2:   // RET imm16
+		case 0xC3:   // RET
+		case 0xE9:   // JMP rel32
+		case 0xEB:   // JMP rel8
+			return false;
+		case 0xFF:   // JMP r/m
+			return !format.modRM || modRM.reg != 4;
+		default:
+			return true;
+		}
+	}
+
+	bool Encoding::isCall() const
+	{
+		if(format.O2 || format.P1)
+		{
+			return false;
+		}
+
+		return O1 == 0xE8 || (O1 == 0xFF && format.modRM && modRM.reg == 2);   // CALL rel32, CALL r/m
+	}
+
+	void Encoding::setCold(bool cold)
+	{
+		this->cold = cold;
+	}
+
+	bool Encoding::isCold() const
+	{
+		return cold;
+	}
+
+	void Encoding::setAlignment(int alignment, int span)
+	{
+		if(alignment > 64) throw Error("Alignment greater than 64");
+
+		this->alignment = alignment;
+		this->span = span;
+	}
+
+	int Encoding::getAlignment() const
+	{
+		return alignment;
+	}
+
+	void Encoding::setLine(int line)
+	{
+		this->line = line;
+	}
+
+	int Encoding::getLine() const
+	{
+		return line;
+	}
+
 	void Encoding::setAddress(const unsigned char *address)
 	{
 		this->address = address;
@@ -283,6 +505,11 @@ namespace SoftWire
 		emit = true;
 	}
 
+	bool Encoding::isPseudo() const
+	{
+		return format.P1 && P1 == 0xF1;
+	}
+
 	bool Encoding::isEmitting()
 	{
 		return emit;
@@ -295,6 +522,28 @@ namespace SoftWire
 
 		unsigned char *start = buffer;
 
+		if(alignment)
+		{
+			int padding = align(buffer, alignment, false);
+
+			if(span)
+			{
+				const int line = 64;
+				bool crossing = (__int64)buffer % line + span > line;
+				bool alignedCrossing = ((__int64)buffer + padding) % line + span > line;
+
+				if(!crossing || alignedCrossing)
+				{
+					padding = 0;
+				}
+			}
+
+			if(padding)
+			{
+				buffer += align(buffer, alignment, write);
+			}
+		}
+
 		#define OUTPUT_BYTE(x) if(write) {*buffer++ = (x);} else {buffer++;}
 
 		if(P1 == 0xF1)   // Special 'instructions', indicated by INT01 prefix byte
@@ -312,7 +561,7 @@ namespace SoftWire
 			{
 				if(immediate > 256)
 				{
-					throw Error("ALIGN value too big: %d bytes", immediate);
+					throw Error("ALIGN value too big: %d bytes", (int)immediate);
 				}
 
 				buffer += align(buffer, immediate, write);
@@ -351,6 +600,10 @@ namespace SoftWire
 			if(format.I2)		OUTPUT_BYTE(I2);
 			if(format.I3)		OUTPUT_BYTE(I3);
 			if(format.I4)		OUTPUT_BYTE(I4);
+			if(format.I5)		OUTPUT_BYTE(I5);
+			if(format.I6)		OUTPUT_BYTE(I6);
+			if(format.I7)		OUTPUT_BYTE(I7);
+			if(format.I8)		OUTPUT_BYTE(I8);
 		}
 
 		#undef OUTPUT_BYTE
@@ -371,35 +624,79 @@ namespace SoftWire
 
 		if(write)
 		{
-			int i = 0;
+			nop(buffer, padding);
+		}
 
-			while(i + 3 <= padding)
-			{
-				// 3-byte NOP
-				*buffer++ = 0x66;
-				*buffer++ = 0x66;
-				*buffer++ = 0x90;
+		return padding;
+	}
 
-				i += 3;
-			}
+	int Encoding::nop(unsigned char *buffer, int size)
+	{
+		// Recommended multi-byte NOPs, same encoding in 32- and 64-bit mode
+		static const unsigned char nops[11][11] =
+		{
+			{0x90},                                                         // nop
+			{0x66, 0x90},                                                   // xchg ax, ax
+			{0x0F, 0x1F, 0x00},                                             // nop [eax]
+			{0x0F, 0x1F, 0x40, 0x00},                                       // nop [eax+0]
+			{0x0F, 0x1F, 0x44, 0x00, 0x00},                                 // nop [eax+eax+0]
+			{0x66, 0x0F, 0x1F, 0x44, 0x00, 0x00},                           // nop word [eax+eax+0]
+			{0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00},                     // nop [eax+0x00000000]
+			{0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},               // nop [eax+eax+0x00000000]
+			{0x66, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},         // nop word [eax+eax+0x00000000]
+			{0x66, 0x2E, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},   // nop word cs:[eax+eax+0x00000000]
+			{0x66, 0x66, 0x2E, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00}
+		};
+
+		int count = 0;   // Instructions
+
+		while(size > 0)
+		{
+			// More prefixes decode slowly on some cores, longer padding takes several NOPs
+			int length = size < 11 ? size : 11;
 
-			if(i + 2 <= padding)
-			{
-				// 2-byte NOP
-				*buffer++ = 0x66;
-				*buffer++ = 0x90;
+			memcpy(buffer, nops[length - 1], length);
+			buffer += length;
+			size -= length;
 
-				i += 2;
-			}
+			count++;
+		}
 
-			if(i + 1 <= padding)
-			{
-				// 1-byte NOP
-				*buffer++ = 0x90;
-			}
+		return count;
+	}
+
+	int Encoding::readCode(const unsigned char *buffer, int fields)
+	{
+		const unsigned char *start = buffer;
+
+		format.P1 = (fields & FIELD_P1) != 0;		if(format.P1)		P1 = *buffer++;
+		format.P2 = (fields & FIELD_P2) != 0;		if(format.P2)		P2 = *buffer++;
+		format.P3 = (fields & FIELD_P3) != 0;		if(format.P3)		P3 = *buffer++;
+		format.P4 = (fields & FIELD_P4) != 0;		if(format.P4)		P4 = *buffer++;
+		format.REX = (fields & FIELD_REX) != 0;		if(format.REX)		REX.b = *buffer++;
+		format.O2 = (fields & FIELD_O2) != 0;		if(format.O2)		O2 = *buffer++;
+		format.O1 = (fields & FIELD_O1) != 0;		if(format.O1)		O1 = *buffer++;
+		format.modRM = (fields & FIELD_MODRM) != 0;	if(format.modRM)	modRM.b = *buffer++;
+		format.SIB = (fields & FIELD_SIB) != 0;		if(format.SIB)		SIB.b = *buffer++;
+		format.D1 = (fields & FIELD_D1) != 0;		if(format.D1)		D1 = *buffer++;
+		format.D2 = (fields & FIELD_D2) != 0;		if(format.D2)		D2 = *buffer++;
+		format.D3 = (fields & FIELD_D3) != 0;		if(format.D3)		D3 = *buffer++;
+		format.D4 = (fields & FIELD_D4) != 0;		if(format.D4)		D4 = *buffer++;
+		format.I1 = (fields & FIELD_I1) != 0;		if(format.I1)		I1 = *buffer++;
+		format.I2 = (fields & FIELD_I2) != 0;		if(format.I2)		I2 = *buffer++;
+		format.I3 = (fields & FIELD_I3) != 0;		if(format.I3)		I3 = *buffer++;
+		format.I4 = (fields & FIELD_I4) != 0;		if(format.I4)		I4 = *buffer++;
+		format.I5 = (fields & FIELD_I5) != 0;		if(format.I5)		I5 = *buffer++;
+		format.I6 = (fields & FIELD_I6) != 0;		if(format.I6)		I6 = *buffer++;
+		format.I7 = (fields & FIELD_I7) != 0;		if(format.I7)		I7 = *buffer++;
+		format.I8 = (fields & FIELD_I8) != 0;		if(format.I8)		I8 = *buffer++;
+
+		if(format.I4 && !format.I8)
+		{
+			immediate = (int)(I1 | I2 << 8 | I3 << 16 | I4 << 24);   // Sign extended
 		}
 
-		return padding;
+		return (int)(buffer - start);
 	}
 
 	int Encoding::printCode(char *buffer) const
@@ -426,6 +723,10 @@ namespace SoftWire
 		if(format.I2)		{sprintf(buffer, "%.2X ", I2);		buffer += 3;}
 		if(format.I3)		{sprintf(buffer, "%.2X ", I3);		buffer += 3;}
 		if(format.I4)		{sprintf(buffer, "%.2X ", I4);		buffer += 3;}
+		if(format.I5)		{sprintf(buffer, "%.2X ", I5);		buffer += 3;}
+		if(format.I6)		{sprintf(buffer, "%.2X ", I6);		buffer += 3;}
+		if(format.I7)		{sprintf(buffer, "%.2X ", I7);		buffer += 3;}
+		if(format.I8)		{sprintf(buffer, "%.2X ", I8);		buffer += 3;}
 
 		sprintf(buffer++, "\n");
 
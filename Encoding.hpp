@@ -50,6 +50,31 @@ namespace SoftWire
 			SCALE_8 = 3
 		};
 
+		enum Field   // In output order
+		{
+			FIELD_P1 = 0x00001,
+			FIELD_P2 = 0x00002,
+			FIELD_P3 = 0x00004,
+			FIELD_P4 = 0x00008,
+			FIELD_REX = 0x00010,
+			FIELD_O2 = 0x00020,
+			FIELD_O1 = 0x00040,
+			FIELD_MODRM = 0x00080,
+			FIELD_SIB = 0x00100,
+			FIELD_D1 = 0x00200,
+			FIELD_D2 = 0x00400,
+			FIELD_D3 = 0x00800,
+			FIELD_D4 = 0x01000,
+			FIELD_I1 = 0x02000,
+			FIELD_I2 = 0x04000,
+			FIELD_I3 = 0x08000,
+			FIELD_I4 = 0x10000,
+			FIELD_I5 = 0x20000,   // 64-bit immediate
+			FIELD_I6 = 0x40000,
+			FIELD_I7 = 0x80000,
+			FIELD_I8 = 0x100000
+		};
+
 		Encoding(const Instruction *instruction = 0);
 		Encoding(const Encoding &encoding);
 
@@ -60,17 +85,20 @@ namespace SoftWire
 		void reset();
 
 		const char *getLabel() const;
+		const char *getMnemonic() const;
+		const Instruction *getInstruction() const;
 		const char *getReference() const;
 		const char *getLiteral() const;
-		int getImmediate() const;
+		__int64 getImmediate() const;
 		__int64 getDisplacement() const;
 
 		void addPrefix(unsigned char p);
 
 		int length(const unsigned char *buffer) const;   // Length of encoded instruction in bytes
 		int writeCode(unsigned char *buffer, bool write = true) const;
+		int readCode(const unsigned char *buffer, int fields);   // Normal instruction with given fields, returns length
 
-		void setImmediate(int immediate);
+		void setImmediate(__int64 immediate);
 		void setDisplacement(__int64 displacement);
 		void addDisplacement(__int64 displacement);
 		void setJumpOffset(int offset);
@@ -82,11 +110,34 @@ namespace SoftWire
 		bool absoluteReference() const;
 		bool hasDisplacement() const;
 		bool hasImmediate() const;
+		bool hasQuadImmediate() const;   // MOV reg64,imm64
+		bool signExtendsImmediate() const;   // imm32 widened to 64-bit operand size in 64-bit mode
 		bool isRipRelative() const;
 
+		bool conditionalBranch() const;
+		void trackStack(int &stack, int &frame, int wordSize) const;   // Bytes pushed, and copied to EBP/RBP (-1 unknown)
+		int pushedRegister() const;   // -1 if not a register push
+		bool invertBranch();   // Negate condition of conditional jump
+		bool fallsThrough() const;
+		bool isCall() const;
+		bool isPseudo() const;   // ALIGN or data
+
+		void setCold(bool cold);
+		bool isCold() const;
+
+		// Pad label to boundary, when span is given only if it keeps that many bytes within a cache line
+		void setAlignment(int alignment, int span = 0);
+		int getAlignment() const;
+
+		// Fill with the fewest NOPs of at most 11 bytes, returns instruction count
+		static int nop(unsigned char *output, int size);
+
 		void setAddress(const unsigned char *address);
 		const unsigned char *getAddress() const;
 
+		void setLine(int line);   // In echo file
+		int getLine() const;
+
 		// Prevent or enable writing to output
 		Encoding *reserve();
 		void retain();
@@ -124,6 +175,10 @@ namespace SoftWire
 			bool I2 : 1;
 			bool I3 : 1;
 			bool I4 : 1;
+			bool I5 : 1;
+			bool I6 : 1;
+			bool I7 : 1;
+			bool I8 : 1;
 		} format;
 
 		unsigned char P1;   // Prefixes
@@ -190,7 +245,7 @@ namespace SoftWire
 		};
 		union
 		{
-			int immediate;
+			__int64 immediate;
 
 			struct
 			{
@@ -198,12 +253,22 @@ namespace SoftWire
 				unsigned char I2;
 				unsigned char I3;
 				unsigned char I4;
+				unsigned char I5;
+				unsigned char I6;
+				unsigned char I7;
+				unsigned char I8;
 			};
 		};
 
 		const unsigned char *address;
 
 		bool emit;  // false for eliminated instructions
+		bool cold;  // true for rarely executed code, placed after hot code
+
+		int alignment;   // Automatic label alignment
+		int span;
+
+		int line;
 
 		static int align(unsigned char *output, int alignment, bool write);
 	};
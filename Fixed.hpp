@@ -0,0 +1,225 @@
+#ifndef SoftWire_Fixed_hpp
+#define SoftWire_Fixed_hpp
+
+#include "Encoding.hpp"
+
+namespace SoftWire
+{
+	// Instructions on registers known at compile time, encoded by the C++ compiler instead of the Synthesizer.
+	// Append with Assembler::emit, which bypasses register allocation, SSE emulation and the optimizer.
+	namespace Fixed
+	{
+		template<int r> struct REG32 {REG32() {} enum {reg = r};};
+		template<int r> struct REG64 {REG64() {} enum {reg = r};};
+		template<int r> struct XMMREG {XMMREG() {} enum {reg = r};};
+
+		static const REG32<Encoding::EAX> eax;
+		static const REG32<Encoding::ECX> ecx;
+		static const REG32<Encoding::EDX> edx;
+		static const REG32<Encoding::EBX> ebx;
+		static const REG32<Encoding::ESP> esp;
+		static const REG32<Encoding::EBP> ebp;
+		static const REG32<Encoding::ESI> esi;
+		static const REG32<Encoding::EDI> edi;
+		static const REG32<Encoding::R8> r8d;
+		static const REG32<Encoding::R9> r9d;
+		static const REG32<Encoding::R10> r10d;
+		static const REG32<Encoding::R11> r11d;
+		static const REG32<Encoding::R12> r12d;
+		static const REG32<Encoding::R13> r13d;
+		static const REG32<Encoding::R14> r14d;
+		static const REG32<Encoding::R15> r15d;
+
+		static const REG64<Encoding::RAX> rax;
+		static const REG64<Encoding::RCX> rcx;
+		static const REG64<Encoding::RDX> rdx;
+		static const REG64<Encoding::RBX> rbx;
+		static const REG64<Encoding::RSP> rsp;
+		static const REG64<Encoding::RBP> rbp;
+		static const REG64<Encoding::RSI> rsi;
+		static const REG64<Encoding::RDI> rdi;
+		static const REG64<Encoding::R8> r8;
+		static const REG64<Encoding::R9> r9;
+		static const REG64<Encoding::R10> r10;
+		static const REG64<Encoding::R11> r11;
+		static const REG64<Encoding::R12> r12;
+		static const REG64<Encoding::R13> r13;
+		static const REG64<Encoding::R14> r14;
+		static const REG64<Encoding::R15> r15;
+
+		static const XMMREG<0> xmm0;
+		static const XMMREG<1> xmm1;
+		static const XMMREG<2> xmm2;
+		static const XMMREG<3> xmm3;
+		static const XMMREG<4> xmm4;
+		static const XMMREG<5> xmm5;
+		static const XMMREG<6> xmm6;
+		static const XMMREG<7> xmm7;
+		static const XMMREG<8> xmm8;
+		static const XMMREG<9> xmm9;
+		static const XMMREG<10> xmm10;
+		static const XMMREG<11> xmm11;
+		static const XMMREG<12> xmm12;
+		static const XMMREG<13> xmm13;
+		static const XMMREG<14> xmm14;
+		static const XMMREG<15> xmm15;
+
+		struct Code
+		{
+			int instruction;   // Instruction set index, as in Intrinsics.hpp
+			int fields;        // Encoding::Field bits
+			int length;
+			int immediate;     // Trailing bytes
+			unsigned char byte[15];
+		};
+
+		// Value of the n-th byte that is present, absent bytes are -1
+		template<int n, int b0, int b1, int b2, int b3, int b4>
+		struct Pick
+		{
+			enum {value = b0 < 0 ? Pick<n, b1, b2, b3, b4, -1>::value : n == 0 ? b0 : Pick<n - 1, b1, b2, b3, b4, -1>::value};
+		};
+
+		template<int n>
+		struct Pick<n, -1, -1, -1, -1, -1>
+		{
+			enum {value = 0};
+		};
+
+		template<int instruction, int prefix, int rex, int escape, int opcode, int modRM, int immediate>
+		struct Form
+		{
+			enum
+			{
+				fields = (prefix >= 0 ? Encoding::FIELD_P1 : 0) |
+				         (rex >= 0 ? Encoding::FIELD_REX : 0) |
+				         (escape >= 0 ? Encoding::FIELD_O2 : 0) |
+				         Encoding::FIELD_O1 |
+				         (modRM >= 0 ? Encoding::FIELD_MODRM : 0) |
+				         (immediate >= 1 ? Encoding::FIELD_I1 : 0) |
+				         (immediate >= 4 ? Encoding::FIELD_I2 | Encoding::FIELD_I3 | Encoding::FIELD_I4 : 0),
+				length = (prefix >= 0) + (rex >= 0) + (escape >= 0) + 1 + (modRM >= 0) + immediate
+			};
+
+			static const Code code;
+		};
+
+		template<int instruction, int prefix, int rex, int escape, int opcode, int modRM, int immediate>
+		const Code Form<instruction, prefix, rex, escape, opcode, modRM, immediate>::code =
+		{
+			instruction, fields, length, immediate,
+			{
+				Pick<0, prefix, rex, escape, opcode, modRM>::value,
+				Pick<1, prefix, rex, escape, opcode, modRM>::value,
+				Pick<2, prefix, rex, escape, opcode, modRM>::value,
+				Pick<3, prefix, rex, escape, opcode, modRM>::value,
+				Pick<4, prefix, rex, escape, opcode, modRM>::value
+			}
+		};
+
+		template<int w, int reg, int r_m>
+		struct Rex   // -1 when not needed
+		{
+			enum {value = w || reg > 7 || r_m > 7 ? 0x40 | w << 3 | (reg & 8) >> 1 | (r_m & 8) >> 3 : -1};
+		};
+
+		template<int instruction, int prefix, int w, int escape, int opcode, int reg, int r_m, int immediate>
+		struct ModRM : Form<instruction, prefix, Rex<w, reg, r_m>::value, escape, opcode, 0xC0 | (reg & 7) << 3 | (r_m & 7), immediate> {};
+
+		template<int instruction, int w, int opcode, int r, int immediate>
+		struct AddReg : Form<instruction, -1, Rex<w, 0, r>::value, -1, opcode + (r & 7), -1, immediate> {};
+
+		template<int instruction, int opcode>
+		struct Plain : Form<instruction, -1, -1, -1, opcode, -1, 0> {};
+
+		inline Code immediate(Code code, int value)
+		{
+			unsigned char *i = &code.byte[code.length - code.immediate];
+
+			for(int n = 0; n < code.immediate; n++)
+			{
+				i[n] = (unsigned char)(value >> (8 * n));
+			}
+
+			return code;
+		}
+
+		// Indices follow Intrinsics.hpp, testFixed in Test.cpp checks every template against the instruction set
+		template<int a, int b> inline Code adc(REG32<a>, REG32<b>) {return ModRM<8, -1, 0, -1, 0x11, b, a, 0>::code;}
+		template<int a, int b> inline Code adc(REG64<a>, REG64<b>) {return ModRM<9, -1, 1, -1, 0x11, b, a, 0>::code;}
+		template<int a, int b> inline Code add(REG32<a>, REG32<b>) {return ModRM<27, -1, 0, -1, 0x01, b, a, 0>::code;}
+		template<int a, int b> inline Code add(REG64<a>, REG64<b>) {return ModRM<28, -1, 1, -1, 0x01, b, a, 0>::code;}
+		template<int a, int b> inline Code and(REG32<a>, REG32<b>) {return ModRM<53, -1, 0, -1, 0x21, b, a, 0>::code;}
+		template<int a, int b> inline Code and(REG64<a>, REG64<b>) {return ModRM<54, -1, 1, -1, 0x21, b, a, 0>::code;}
+		template<int a, int b> inline Code cmp(REG32<a>, REG32<b>) {return ModRM<212, -1, 0, -1, 0x39, b, a, 0>::code;}
+		template<int a, int b> inline Code cmp(REG64<a>, REG64<b>) {return ModRM<213, -1, 1, -1, 0x39, b, a, 0>::code;}
+		template<int a, int b> inline Code imul(REG32<a>, REG32<b>) {return ModRM<520, -1, 0, 0x0F, 0xAF, a, b, 0>::code;}
+		template<int a, int b> inline Code imul(REG64<a>, REG64<b>) {return ModRM<521, -1, 1, 0x0F, 0xAF, a, b, 0>::code;}
+		template<int a, int b> inline Code mov(REG32<a>, REG32<b>) {return ModRM<760, -1, 0, -1, 0x89, b, a, 0>::code;}
+		template<int a, int b> inline Code mov(REG64<a>, REG64<b>) {return ModRM<761, -1, 1, -1, 0x89, b, a, 0>::code;}
+		template<int a, int b> inline Code or(REG32<a>, REG32<b>) {return ModRM<862, -1, 0, -1, 0x09, b, a, 0>::code;}
+		template<int a, int b> inline Code or(REG64<a>, REG64<b>) {return ModRM<863, -1, 1, -1, 0x09, b, a, 0>::code;}
+		template<int a, int b> inline Code sbb(REG32<a>, REG32<b>) {return ModRM<1228, -1, 0, -1, 0x19, b, a, 0>::code;}
+		template<int a, int b> inline Code sbb(REG64<a>, REG64<b>) {return ModRM<1229, -1, 1, -1, 0x19, b, a, 0>::code;}
+		template<int a, int b> inline Code sub(REG32<a>, REG32<b>) {return ModRM<1334, -1, 0, -1, 0x29, b, a, 0>::code;}
+		template<int a, int b> inline Code sub(REG64<a>, REG64<b>) {return ModRM<1335, -1, 1, -1, 0x29, b, a, 0>::code;}
+		template<int a, int b> inline Code test(REG32<a>, REG32<b>) {return ModRM<1358, -1, 0, -1, 0x85, b, a, 0>::code;}
+		template<int a, int b> inline Code test(REG64<a>, REG64<b>) {return ModRM<1359, -1, 1, -1, 0x85, b, a, 0>::code;}
+		template<int a, int b> inline Code xor(REG32<a>, REG32<b>) {return ModRM<1398, -1, 0, -1, 0x31, b, a, 0>::code;}
+		template<int a, int b> inline Code xor(REG64<a>, REG64<b>) {return ModRM<1399, -1, 1, -1, 0x31, b, a, 0>::code;}
+
+		template<int a> inline Code adc(REG32<a>, int b) {return immediate(ModRM<16, -1, 0, -1, 0x81, 2, a, 4>::code, b);}
+		template<int a> inline Code adc(REG64<a>, int b) {return immediate(ModRM<17, -1, 1, -1, 0x81, 2, a, 4>::code, b);}
+		template<int a> inline Code add(REG32<a>, int b) {return immediate(ModRM<35, -1, 0, -1, 0x81, 0, a, 4>::code, b);}
+		template<int a> inline Code add(REG64<a>, int b) {return immediate(ModRM<36, -1, 1, -1, 0x81, 0, a, 4>::code, b);}
+		template<int a> inline Code and(REG32<a>, int b) {return immediate(ModRM<61, -1, 0, -1, 0x81, 4, a, 4>::code, b);}
+		template<int a> inline Code and(REG64<a>, int b) {return immediate(ModRM<62, -1, 1, -1, 0x81, 4, a, 4>::code, b);}
+		template<int a> inline Code cmp(REG32<a>, int b) {return immediate(ModRM<220, -1, 0, -1, 0x81, 7, a, 4>::code, b);}
+		template<int a> inline Code cmp(REG64<a>, int b) {return immediate(ModRM<221, -1, 1, -1, 0x81, 7, a, 4>::code, b);}
+		template<int a> inline Code mov(REG32<a>, int b) {return immediate(AddReg<768, 0, 0xB8, a, 4>::code, b);}
+		template<int a> inline Code mov(REG64<a>, int b) {return immediate(ModRM<773, -1, 1, -1, 0xC7, 0, a, 4>::code, b);}
+		template<int a> inline Code or(REG32<a>, int b) {return immediate(ModRM<870, -1, 0, -1, 0x81, 1, a, 4>::code, b);}
+		template<int a> inline Code or(REG64<a>, int b) {return immediate(ModRM<871, -1, 1, -1, 0x81, 1, a, 4>::code, b);}
+		template<int a> inline Code sar(REG32<a>, int b) {return immediate(ModRM<1222, -1, 0, -1, 0xC1, 7, a, 1>::code, b);}
+		template<int a> inline Code sar(REG64<a>, int b) {return immediate(ModRM<1225, -1, 1, -1, 0xC1, 7, a, 1>::code, b);}
+		template<int a> inline Code sbb(REG32<a>, int b) {return immediate(ModRM<1236, -1, 0, -1, 0x81, 3, a, 4>::code, b);}
+		template<int a> inline Code sbb(REG64<a>, int b) {return immediate(ModRM<1237, -1, 1, -1, 0x81, 3, a, 4>::code, b);}
+		template<int a> inline Code shl(REG32<a>, int b) {return immediate(ModRM<1288, -1, 0, -1, 0xC1, 4, a, 1>::code, b);}
+		template<int a> inline Code shl(REG64<a>, int b) {return immediate(ModRM<1291, -1, 1, -1, 0xC1, 4, a, 1>::code, b);}
+		template<int a> inline Code shr(REG32<a>, int b) {return immediate(ModRM<1306, -1, 0, -1, 0xC1, 5, a, 1>::code, b);}
+		template<int a> inline Code shr(REG64<a>, int b) {return immediate(ModRM<1309, -1, 1, -1, 0xC1, 5, a, 1>::code, b);}
+		template<int a> inline Code sub(REG32<a>, int b) {return immediate(ModRM<1342, -1, 0, -1, 0x81, 5, a, 4>::code, b);}
+		template<int a> inline Code sub(REG64<a>, int b) {return immediate(ModRM<1343, -1, 1, -1, 0x81, 5, a, 4>::code, b);}
+		template<int a> inline Code xor(REG32<a>, int b) {return immediate(ModRM<1406, -1, 0, -1, 0x81, 6, a, 4>::code, b);}
+		template<int a> inline Code xor(REG64<a>, int b) {return immediate(ModRM<1407, -1, 1, -1, 0x81, 6, a, 4>::code, b);}
+
+		template<int a> inline Code neg(REG32<a>) {return ModRM<852, -1, 0, -1, 0xF7, 3, a, 0>::code;}
+		template<int a> inline Code neg(REG64<a>) {return ModRM<853, -1, 1, -1, 0xF7, 3, a, 0>::code;}
+		template<int a> inline Code not(REG32<a>) {return ModRM<857, -1, 0, -1, 0xF7, 2, a, 0>::code;}
+		template<int a> inline Code not(REG64<a>) {return ModRM<858, -1, 1, -1, 0xF7, 2, a, 0>::code;}
+		template<int a> inline Code pop(REG32<a>) {return AddReg<992, 0, 0x58, a, 0>::code;}
+		template<int a> inline Code pop(REG64<a>) {return AddReg<993, 1, 0x58, a, 0>::code;}
+		template<int a> inline Code push(REG32<a>) {return AddReg<1084, 0, 0x50, a, 0>::code;}
+		template<int a> inline Code push(REG64<a>) {return AddReg<1085, 1, 0x50, a, 0>::code;}
+
+		inline Code nop() {return Plain<854, 0x90>::code;}
+		inline Code ret() {return Plain<1172, 0xC3>::code;}
+
+		template<int a, int b> inline Code addps(XMMREG<a>, XMMREG<b>) {return ModRM<45, -1, 0, 0x0F, 0x58, a, b, 0>::code;}
+		template<int a, int b> inline Code addss(XMMREG<a>, XMMREG<b>) {return ModRM<47, 0xF3, 0, 0x0F, 0x58, a, b, 0>::code;}
+		template<int a, int b> inline Code andps(XMMREG<a>, XMMREG<b>) {return ModRM<73, -1, 0, 0x0F, 0x54, a, b, 0>::code;}
+		template<int a, int b> inline Code divps(XMMREG<a>, XMMREG<b>) {return ModRM<319, -1, 0, 0x0F, 0x5E, a, b, 0>::code;}
+		template<int a, int b> inline Code maxps(XMMREG<a>, XMMREG<b>) {return ModRM<749, -1, 0, 0x0F, 0x5F, a, b, 0>::code;}
+		template<int a, int b> inline Code minps(XMMREG<a>, XMMREG<b>) {return ModRM<754, -1, 0, 0x0F, 0x5D, a, b, 0>::code;}
+		template<int a, int b> inline Code movaps(XMMREG<a>, XMMREG<b>) {return ModRM<776, -1, 0, 0x0F, 0x28, a, b, 0>::code;}
+		template<int a, int b> inline Code movups(XMMREG<a>, XMMREG<b>) {return ModRM<834, -1, 0, 0x0F, 0x10, a, b, 0>::code;}
+		template<int a, int b> inline Code mulps(XMMREG<a>, XMMREG<b>) {return ModRM<846, -1, 0, 0x0F, 0x59, a, b, 0>::code;}
+		template<int a, int b> inline Code mulss(XMMREG<a>, XMMREG<b>) {return ModRM<848, 0xF3, 0, 0x0F, 0x59, a, b, 0>::code;}
+		template<int a, int b> inline Code orps(XMMREG<a>, XMMREG<b>) {return ModRM<880, -1, 0, 0x0F, 0x56, a, b, 0>::code;}
+		template<int a, int b> inline Code sqrtps(XMMREG<a>, XMMREG<b>) {return ModRM<1321, -1, 0, 0x0F, 0x51, a, b, 0>::code;}
+		template<int a, int b> inline Code subps(XMMREG<a>, XMMREG<b>) {return ModRM<1352, -1, 0, 0x0F, 0x5C, a, b, 0>::code;}
+		template<int a, int b> inline Code xorps(XMMREG<a>, XMMREG<b>) {return ModRM<1415, -1, 0, 0x0F, 0x57, a, b, 0>::code;}
+	}
+}
+
+#endif   // SoftWire_Fixed_hpp
@@ -152,12 +152,23 @@ namespace SoftWire
 
 	bool Instruction::is16Bit() const
 	{
-		return (syntax->flags & CPU_386) != CPU_386;
+		return !is32Bit();
 	}
 
 	bool Instruction::is32Bit() const
 	{
-		return (syntax->flags & CPU_386) == CPU_386;
+		if((syntax->flags & CPU_386) != CPU_386)
+		{
+			return false;
+		}
+
+		// 16-bit operands of 386+ instructions still need the operand size prefix, DX is a port
+		return !Operand::isSubtypeOf(firstOperand, Operand::OPERAND_R_M16) || Operand::isSubtypeOf(secondOperand, Operand::OPERAND_R_M32);
+	}
+
+	bool Instruction::isCyrix() const
+	{
+		return (syntax->flags & CPU_CYRIX) == CPU_CYRIX;
 	}
 
 	bool Instruction::is64Bit() const
@@ -113,6 +113,7 @@ namespace SoftWire
 		bool is32Bit() const;
 		bool is64Bit() const;
 		bool isInvalid64() const;
+		bool isCyrix() const;
 
 		int approximateSize() const;
 
@@ -645,7 +645,7 @@ namespace SoftWire
 		{"JMP",				"NEAR imm8",				"EB -b",				Instruction::CPU_8086},
 	//	{"JMP",				"imm:imm16",				"po EA iw iw",			Instruction::CPU_8086 | Instruction::CPU_INVALID64},
 	//	{"JMP",				"imm:imm32",				"po EA id iw",			Instruction::CPU_386 | Instruction::CPU_INVALID64},
-		{"JMP",				"mem",						"po FF /5",				Instruction::CPU_8086},
+		{"JMP",				"mem",						"FF /4",				Instruction::CPU_8086},
 	//	{"JMP",				"FAR mem",					"po FF /5",				Instruction::CPU_386},
 		{"JMP",				"WORD r/m16",				"po FF /4",				Instruction::CPU_8086},
 		{"JMP",				"DWORD r/m32",				"po FF /4",				Instruction::CPU_386},
@@ -697,13 +697,13 @@ namespace SoftWire
 		{"LDDQU",			"xmmreg,mem",				"p2 0F F0 /r",			Instruction::CPU_PNI},  
 		{"LDMXCSR",			"mem32",					"0F AE /2",				Instruction::CPU_KATMAI | Instruction::CPU_SSE},
 		{"LDS",				"reg16,mem",				"po C5 /r",				Instruction::CPU_8086 | Instruction::CPU_INVALID64},
-		{"LDS",				"reg32,mem",				"po C5 /r",				Instruction::CPU_8086 | Instruction::CPU_INVALID64},
+		{"LDS",				"reg32,mem",				"po C5 /r",				Instruction::CPU_386 | Instruction::CPU_INVALID64},
 		{"LEA",				"reg16,mem",				"po 8D /r",				Instruction::CPU_8086},
 		{"LEA",				"reg32,mem",				"po 8D /r",				Instruction::CPU_386},
 		{"LEA",				"reg64,mem",				"po 8D /r",				Instruction::CPU_X64},
 		{"LEAVE",			"",							"C9",					Instruction::CPU_186},
 		{"LES",				"reg16,mem",				"po C4 /r",				Instruction::CPU_8086 | Instruction::CPU_INVALID64},
-		{"LES",				"reg32,mem",				"po C4 /r",				Instruction::CPU_8086 | Instruction::CPU_INVALID64},
+		{"LES",				"reg32,mem",				"po C4 /r",				Instruction::CPU_386 | Instruction::CPU_INVALID64},
 		{"LFENCE",			"",							"0F AE E8",				Instruction::CPU_WILLAMETTE | Instruction::CPU_SSE2}, 
 		{"LFS",				"reg16,mem",				"po 0F B4 /r",			Instruction::CPU_386},
 		{"LFS",				"reg32,mem",				"po 0F B4 /r",			Instruction::CPU_386},
@@ -782,7 +782,7 @@ namespace SoftWire
 		{"LOCK SBB",		"WORD mem16,imm16",			"p0 po 81 /3 iw",		Instruction::CPU_8086},
 		{"LOCK SBB",		"DWORD mem32,imm32",		"p0 po 81 /3 id",		Instruction::CPU_386},
 		{"LOCK SBB",		"WORD mem16,imm8",			"p0 po 83 /3 ib",		Instruction::CPU_8086},
-		{"LOCK SBB",		"DWORD mem32,imm8",			"p0 po 83 /3 ib",		Instruction::CPU_8086},
+		{"LOCK SBB",		"DWORD mem32,imm8",			"p0 po 83 /3 ib",		Instruction::CPU_386},
 		{"LOCK SUB",		"BYTE mem8,imm8",			"p0 80 /5 ib",			Instruction::CPU_8086},
 		{"LOCK SUB",		"WORD mem16,imm16",			"p0 po 81 /5 iw",		Instruction::CPU_8086},
 		{"LOCK SUB",		"DWORD mem32,imm32",		"p0 po 81 /5 id",		Instruction::CPU_386},
@@ -852,7 +852,7 @@ namespace SoftWire
 		{"MOV",				"reg8,imm8",				"B0 +r ib",				Instruction::CPU_8086},
 		{"MOV",				"reg16,imm16",				"po B8 +r iw",			Instruction::CPU_8086},
 		{"MOV",				"reg32,imm32",				"po B8 +r id",			Instruction::CPU_386},
-	//	{"MOV",				"reg64,imm64",				"po B8 +r iq",			Instruction::CPU_X64},   // FIXME: imm64 unimplemented
+		{"MOV",				"reg64,imm64",				"po B8 +r iq",			Instruction::CPU_X64},
 		{"MOV",				"BYTE r/m8,imm8",			"C6 /0 ib",				Instruction::CPU_8086},
 		{"MOV",				"WORD r/m16,imm16",			"po C7 /0 iw",			Instruction::CPU_8086},
 		{"MOV",				"DWORD r/m32,imm32",		"po C7 /0 id",			Instruction::CPU_386},
@@ -1586,6 +1586,11 @@ namespace SoftWire
 		return &intrinsicMap[i];
 	}
 
+	int InstructionSet::instructionCount() const
+	{
+		return numInstructions;
+	}
+
 	void InstructionSet::generateIntrinsics()
 	{
 		assert(intrinsicMap);
@@ -1609,45 +1614,38 @@ namespace SoftWire
 
 		fprintf(intrinsics, "#ifndef SOFTWIRE_NO_INTRINSICS\n\n");
 
-		fprintf(intrinsics, "typedef OperandIMM IMM;\n");
-		fprintf(intrinsics, "typedef OperandAL AL;\n");
-		fprintf(intrinsics, "typedef OperandAX AX;\n");
-		fprintf(intrinsics, "typedef OperandEAX EAX;\n");
-		fprintf(intrinsics, "typedef OperandRAX RAX;\n");
-		fprintf(intrinsics, "typedef OperandDX DX;\n");
-		fprintf(intrinsics, "typedef OperandCL CL;\n");
-		fprintf(intrinsics, "typedef OperandCX CX;\n");
-		fprintf(intrinsics, "typedef OperandECX ECX;\n");
-		fprintf(intrinsics, "typedef OperandST0 ST0;\n");
-		fprintf(intrinsics, "typedef OperandREG8 REG8;\n");
-		fprintf(intrinsics, "typedef OperandREG16 REG16;\n");
-		fprintf(intrinsics, "typedef OperandREG32 REG32;\n");
-		fprintf(intrinsics, "typedef OperandREG64 REG64;\n");
-		fprintf(intrinsics, "typedef OperandFPUREG FPUREG;\n");
-		fprintf(intrinsics, "typedef OperandMMREG MMREG;\n");
-		fprintf(intrinsics, "typedef OperandXMMREG XMMREG;\n");
-		fprintf(intrinsics, "typedef OperandMEM8 MEM8;\n");
-		fprintf(intrinsics, "typedef OperandMEM16 MEM16;\n");
-		fprintf(intrinsics, "typedef OperandMEM32 MEM32;\n");
-		fprintf(intrinsics, "typedef OperandMEM64 MEM64;\n");
-		fprintf(intrinsics, "typedef OperandMEM128 MEM128;\n");
-		fprintf(intrinsics, "typedef OperandR_M8 R_M8;\n");
-		fprintf(intrinsics, "typedef OperandR_M16 R_M16;\n");
-		fprintf(intrinsics, "typedef OperandR_M32 R_M32;\n");
-		fprintf(intrinsics, "typedef OperandR_M64 R_M64;\n");
-		fprintf(intrinsics, "typedef OperandR_M128 R_M128;\n");
-		fprintf(intrinsics, "typedef OperandXMM32 XMM32;\n");
-		fprintf(intrinsics, "typedef OperandXMM64 XMM64;\n");
-		fprintf(intrinsics, "typedef OperandMM64 MM64;\n");
-		fprintf(intrinsics, "typedef OperandREF REF;\n");
+		const char *operandTypes[] = {"IMM", "IMM64", "AL", "AX", "EAX", "RAX", "DX", "CL", "CX", "ECX", "ST0", "REG8", "REG16", "REG32", "REG64", "FPUREG", "MMREG",
+		                              "XMMREG", "MEM8", "MEM16", "MEM32", "MEM64", "MEM128", "R_M8", "R_M16", "R_M32", "R_M64", "R_M128", "XMM32", "XMM64", "MM64", "REF"};
+		const int operandTypeCount = sizeof(operandTypes) / sizeof(operandTypes[0]);
+
+		fprintf(intrinsics, "#ifndef SOFTWIRE_STATIC_INTRINSICS\n\n");
+
+		for(int i = 0; i < operandTypeCount; i++)
+		{
+			fprintf(intrinsics, "typedef Operand%s %s;\n", operandTypes[i], operandTypes[i]);
+		}
+
+		fprintf(intrinsics, "\n");
+		fprintf(intrinsics, "#define enc virtual Encoding*\n");
+		fprintf(intrinsics, "\n");
+		fprintf(intrinsics, "#else   // Operands by reference, bound at compile time\n\n");
+
+		for(int j = 0; j < operandTypeCount; j++)
+		{
+			fprintf(intrinsics, "typedef const Operand%s &%s;\n", operandTypes[j], operandTypes[j]);
+		}
+
 		fprintf(intrinsics, "\n");
+		fprintf(intrinsics, "#define enc Encoding*\n");
+		fprintf(intrinsics, "\n");
+		fprintf(intrinsics, "#endif\n");
+		fprintf(intrinsics, "\n");
+
 		fprintf(intrinsics, "typedef unsigned char byte;\n");
 		fprintf(intrinsics, "typedef unsigned short word;\n");
 		fprintf(intrinsics, "typedef unsigned int dword;\n");
 		fprintf(intrinsics, "typedef unsigned __int64 qword;\n");
 		fprintf(intrinsics, "\n");
-		fprintf(intrinsics, "#define enc virtual Encoding*\n");
-		fprintf(intrinsics, "\n");
 
 		struct InstructionSignature
 		{
@@ -1691,7 +1689,7 @@ namespace SoftWire
 				{Operand::OPERAND_IMM8,		"byte"},
 				{Operand::OPERAND_IMM16,	"word"},
 				{Operand::OPERAND_IMM32,	"dword"},
-			//	{Operand::OPERAND_IMM64,	"qword"},
+				{Operand::OPERAND_IMM64,	"IMM64"},   // Explicit, to keep MOV reg64,imm32 the default
 
 				{Operand::OPERAND_REG8,		"REG8"},
 				{Operand::OPERAND_REG16,	"REG16"},
@@ -15,6 +15,7 @@ namespace SoftWire
 		virtual ~InstructionSet();
 
 		const Instruction *instruction(int i);
+		int instructionCount() const;
 
 	private:
 		struct Entry
@@ -3,7 +3,10 @@
 
 #ifndef SOFTWIRE_NO_INTRINSICS
 
+#ifndef SOFTWIRE_STATIC_INTRINSICS
+
 typedef OperandIMM IMM;
+typedef OperandIMM64 IMM64;
 typedef OperandAL AL;
 typedef OperandAX AX;
 typedef OperandEAX EAX;
@@ -35,13 +38,52 @@ typedef OperandXMM64 XMM64;
 typedef OperandMM64 MM64;
 typedef OperandREF REF;
 
+#define enc virtual Encoding*
+
+#else   // Operands by reference, bound at compile time
+
+typedef const OperandIMM &IMM;
+typedef const OperandIMM64 &IMM64;
+typedef const OperandAL &AL;
+typedef const OperandAX &AX;
+typedef const OperandEAX &EAX;
+typedef const OperandRAX &RAX;
+typedef const OperandDX &DX;
+typedef const OperandCL &CL;
+typedef const OperandCX &CX;
+typedef const OperandECX &ECX;
+typedef const OperandST0 &ST0;
+typedef const OperandREG8 &REG8;
+typedef const OperandREG16 &REG16;
+typedef const OperandREG32 &REG32;
+typedef const OperandREG64 &REG64;
+typedef const OperandFPUREG &FPUREG;
+typedef const OperandMMREG &MMREG;
+typedef const OperandXMMREG &XMMREG;
+typedef const OperandMEM8 &MEM8;
+typedef const OperandMEM16 &MEM16;
+typedef const OperandMEM32 &MEM32;
+typedef const OperandMEM64 &MEM64;
+typedef const OperandMEM128 &MEM128;
+typedef const OperandR_M8 &R_M8;
+typedef const OperandR_M16 &R_M16;
+typedef const OperandR_M32 &R_M32;
+typedef const OperandR_M64 &R_M64;
+typedef const OperandR_M128 &R_M128;
+typedef const OperandXMM32 &XMM32;
+typedef const OperandXMM64 &XMM64;
+typedef const OperandMM64 &MM64;
+typedef const OperandREF &REF;
+
+#define enc Encoding*
+
+#endif
+
 typedef unsigned char byte;
 typedef unsigned short word;
 typedef unsigned int dword;
 typedef unsigned __int64 qword;
 
-#define enc virtual Encoding*
-
 enc aaa(){return x86(0);}
 enc aad(){return x86(1);}
 enc aad(REF a){return x86(2,a);}
@@ -1616,1524 +1658,1525 @@ enc mov(REG16 a,byte b){return x86(767,a,(IMM)b);}
 enc mov(REG16 a,word b){return x86(767,a,(IMM)b);}
 enc mov(REG32 a,REF b){return x86(768,a,b);}
 enc mov(REG32 a,dword b){return x86(768,a,(IMM)b);}
-enc mov(MEM8 a,byte b){return x86(769,a,(IMM)b);}
-enc mov(R_M8 a,byte b){return x86(769,a,(IMM)b);}
-enc mov(MEM16 a,byte b){return x86(770,a,(IMM)b);}
-enc mov(MEM16 a,word b){return x86(770,a,(IMM)b);}
-enc mov(R_M16 a,byte b){return x86(770,a,(IMM)b);}
-enc mov(R_M16 a,word b){return x86(770,a,(IMM)b);}
-enc mov(MEM32 a,REF b){return x86(771,a,b);}
-enc mov(MEM32 a,dword b){return x86(771,a,(IMM)b);}
-enc mov(R_M32 a,REF b){return x86(771,a,b);}
-enc mov(R_M32 a,dword b){return x86(771,a,(IMM)b);}
-enc mov(REG64 a,REF b){return x86(772,a,b);}
-enc mov(REG64 a,dword b){return x86(772,a,(IMM)b);}
-enc mov(MEM64 a,REF b){return x86(772,a,b);}
-enc mov(MEM64 a,dword b){return x86(772,a,(IMM)b);}
-enc mov(R_M64 a,REF b){return x86(772,a,b);}
-enc mov(R_M64 a,dword b){return x86(772,a,(IMM)b);}
-enc movapd(XMMREG a,XMMREG b){return x86(773,a,b);}
-enc movapd(XMMREG a,MEM128 b){return x86(773,a,b);}
-enc movapd(XMMREG a,R_M128 b){return x86(773,a,b);}
-enc movapd(MEM128 a,XMMREG b){return x86(774,a,b);}
-enc movapd(R_M128 a,XMMREG b){return x86(774,a,b);}
-enc movaps(XMMREG a,XMMREG b){return x86(775,a,b);}
-enc movaps(XMMREG a,MEM128 b){return x86(775,a,b);}
-enc movaps(XMMREG a,R_M128 b){return x86(775,a,b);}
-enc movaps(MEM128 a,XMMREG b){return x86(776,a,b);}
-enc movaps(R_M128 a,XMMREG b){return x86(776,a,b);}
-enc movd(MMREG a,REG32 b){return x86(777,a,b);}
-enc movd(MMREG a,MEM32 b){return x86(777,a,b);}
-enc movd(MMREG a,R_M32 b){return x86(777,a,b);}
-enc movd(MMREG a,REG64 b){return x86(778,a,b);}
-enc movd(MMREG a,MEM64 b){return x86(778,a,b);}
-enc movd(MMREG a,R_M64 b){return x86(778,a,b);}
-enc movd(REG32 a,MMREG b){return x86(779,a,b);}
-enc movd(MEM32 a,MMREG b){return x86(779,a,b);}
-enc movd(R_M32 a,MMREG b){return x86(779,a,b);}
-enc movd(REG64 a,MMREG b){return x86(780,a,b);}
-enc movd(MEM64 a,MMREG b){return x86(780,a,b);}
-enc movd(R_M64 a,MMREG b){return x86(780,a,b);}
-enc movd(XMMREG a,REG32 b){return x86(781,a,b);}
-enc movd(XMMREG a,MEM32 b){return x86(781,a,b);}
-enc movd(XMMREG a,R_M32 b){return x86(781,a,b);}
-enc movd(XMMREG a,REG64 b){return x86(782,a,b);}
-enc movd(XMMREG a,MEM64 b){return x86(782,a,b);}
-enc movd(XMMREG a,R_M64 b){return x86(782,a,b);}
-enc movd(REG32 a,XMMREG b){return x86(783,a,b);}
-enc movd(MEM32 a,XMMREG b){return x86(783,a,b);}
-enc movd(R_M32 a,XMMREG b){return x86(783,a,b);}
-enc movd(REG64 a,XMMREG b){return x86(784,a,b);}
-enc movd(MEM64 a,XMMREG b){return x86(784,a,b);}
-enc movd(R_M64 a,XMMREG b){return x86(784,a,b);}
-enc movddup(XMMREG a,XMMREG b){return x86(785,a,b);}
-enc movddup(XMMREG a,MEM128 b){return x86(785,a,b);}
-enc movddup(XMMREG a,R_M128 b){return x86(785,a,b);}
-enc movdq2q(MMREG a,XMMREG b){return x86(786,a,b);}
-enc movdqa(XMMREG a,XMMREG b){return x86(787,a,b);}
-enc movdqa(XMMREG a,MEM128 b){return x86(787,a,b);}
-enc movdqa(XMMREG a,R_M128 b){return x86(787,a,b);}
-enc movdqa(MEM128 a,XMMREG b){return x86(788,a,b);}
-enc movdqa(R_M128 a,XMMREG b){return x86(788,a,b);}
-enc movdqu(XMMREG a,XMMREG b){return x86(789,a,b);}
-enc movdqu(XMMREG a,MEM128 b){return x86(789,a,b);}
-enc movdqu(XMMREG a,R_M128 b){return x86(789,a,b);}
-enc movdqu(MEM128 a,XMMREG b){return x86(790,a,b);}
-enc movdqu(R_M128 a,XMMREG b){return x86(790,a,b);}
-enc movhlps(XMMREG a,XMMREG b){return x86(791,a,b);}
-enc movhpd(XMMREG a,MEM64 b){return x86(792,a,b);}
-enc movhpd(MEM64 a,XMMREG b){return x86(793,a,b);}
-enc movhps(XMMREG a,MEM64 b){return x86(794,a,b);}
-enc movhps(MEM64 a,XMMREG b){return x86(795,a,b);}
-enc movhps(XMMREG a,XMMREG b){return x86(796,a,b);}
-enc movlhps(XMMREG a,XMMREG b){return x86(797,a,b);}
-enc movlpd(XMMREG a,MEM64 b){return x86(798,a,b);}
-enc movlpd(MEM64 a,XMMREG b){return x86(799,a,b);}
-enc movlps(XMMREG a,MEM64 b){return x86(800,a,b);}
-enc movlps(MEM64 a,XMMREG b){return x86(801,a,b);}
-enc movmskpd(REG32 a,XMMREG b){return x86(802,a,b);}
-enc movmskps(REG32 a,XMMREG b){return x86(803,a,b);}
-enc movntdq(MEM128 a,XMMREG b){return x86(804,a,b);}
-enc movnti(MEM32 a,REG32 b){return x86(805,a,b);}
-enc movnti(MEM64 a,REG64 b){return x86(806,a,b);}
-enc movntpd(MEM128 a,XMMREG b){return x86(807,a,b);}
-enc movntps(MEM128 a,XMMREG b){return x86(808,a,b);}
-enc movntq(MEM64 a,MMREG b){return x86(809,a,b);}
-enc movq(MMREG a,MMREG b){return x86(810,a,b);}
-enc movq(MMREG a,MEM64 b){return x86(810,a,b);}
-enc movq(MMREG a,MM64 b){return x86(810,a,b);}
-enc movq(MEM64 a,MMREG b){return x86(811,a,b);}
-enc movq(MM64 a,MMREG b){return x86(811,a,b);}
-enc movq(XMMREG a,XMMREG b){return x86(812,a,b);}
-enc movq(XMMREG a,MEM64 b){return x86(812,a,b);}
-enc movq(XMMREG a,XMM64 b){return x86(812,a,b);}
-enc movq(MEM64 a,XMMREG b){return x86(813,a,b);}
-enc movq(XMM64 a,XMMREG b){return x86(813,a,b);}
-enc movq2dq(XMMREG a,MMREG b){return x86(814,a,b);}
-enc movsb(){return x86(815);}
-enc movsd(){return x86(816);}
-enc movsd(XMMREG a,XMMREG b){return x86(817,a,b);}
-enc movsd(XMMREG a,MEM64 b){return x86(817,a,b);}
-enc movsd(XMMREG a,XMM64 b){return x86(817,a,b);}
-enc movsd(MEM64 a,XMMREG b){return x86(818,a,b);}
-enc movsd(XMM64 a,XMMREG b){return x86(818,a,b);}
-enc movshdup(XMMREG a,XMMREG b){return x86(819,a,b);}
-enc movshdup(XMMREG a,MEM128 b){return x86(819,a,b);}
-enc movshdup(XMMREG a,R_M128 b){return x86(819,a,b);}
-enc movsldup(XMMREG a,XMMREG b){return x86(820,a,b);}
-enc movsldup(XMMREG a,MEM128 b){return x86(820,a,b);}
-enc movsldup(XMMREG a,R_M128 b){return x86(820,a,b);}
-enc movsq(){return x86(821);}
-enc movss(XMMREG a,XMMREG b){return x86(822,a,b);}
-enc movss(XMMREG a,MEM32 b){return x86(822,a,b);}
-enc movss(XMMREG a,XMM32 b){return x86(822,a,b);}
-enc movss(MEM32 a,XMMREG b){return x86(823,a,b);}
-enc movss(XMM32 a,XMMREG b){return x86(823,a,b);}
-enc movsw(){return x86(824);}
-enc movsx(REG16 a,REG8 b){return x86(825,a,b);}
-enc movsx(REG16 a,MEM8 b){return x86(825,a,b);}
-enc movsx(REG16 a,R_M8 b){return x86(825,a,b);}
-enc movsx(REG32 a,REG8 b){return x86(826,a,b);}
-enc movsx(REG32 a,MEM8 b){return x86(826,a,b);}
-enc movsx(REG32 a,R_M8 b){return x86(826,a,b);}
-enc movsx(REG64 a,REG8 b){return x86(827,a,b);}
-enc movsx(REG64 a,MEM8 b){return x86(827,a,b);}
-enc movsx(REG64 a,R_M8 b){return x86(827,a,b);}
-enc movsx(REG32 a,REG16 b){return x86(828,a,b);}
-enc movsx(REG32 a,MEM16 b){return x86(828,a,b);}
-enc movsx(REG32 a,R_M16 b){return x86(828,a,b);}
-enc movsx(REG64 a,REG16 b){return x86(829,a,b);}
-enc movsx(REG64 a,MEM16 b){return x86(829,a,b);}
-enc movsx(REG64 a,R_M16 b){return x86(829,a,b);}
-enc movsxd(REG64 a,REG32 b){return x86(830,a,b);}
-enc movsxd(REG64 a,MEM32 b){return x86(830,a,b);}
-enc movsxd(REG64 a,R_M32 b){return x86(830,a,b);}
-enc movupd(XMMREG a,XMMREG b){return x86(831,a,b);}
-enc movupd(XMMREG a,MEM128 b){return x86(831,a,b);}
-enc movupd(XMMREG a,R_M128 b){return x86(831,a,b);}
-enc movupd(MEM128 a,XMMREG b){return x86(832,a,b);}
-enc movupd(R_M128 a,XMMREG b){return x86(832,a,b);}
-enc movups(XMMREG a,XMMREG b){return x86(833,a,b);}
-enc movups(XMMREG a,MEM128 b){return x86(833,a,b);}
-enc movups(XMMREG a,R_M128 b){return x86(833,a,b);}
-enc movups(MEM128 a,XMMREG b){return x86(834,a,b);}
-enc movups(R_M128 a,XMMREG b){return x86(834,a,b);}
-enc movzx(REG16 a,REG8 b){return x86(835,a,b);}
-enc movzx(REG16 a,MEM8 b){return x86(835,a,b);}
-enc movzx(REG16 a,R_M8 b){return x86(835,a,b);}
-enc movzx(REG32 a,REG8 b){return x86(836,a,b);}
-enc movzx(REG32 a,MEM8 b){return x86(836,a,b);}
-enc movzx(REG32 a,R_M8 b){return x86(836,a,b);}
-enc movzx(REG64 a,REG8 b){return x86(837,a,b);}
-enc movzx(REG64 a,MEM8 b){return x86(837,a,b);}
-enc movzx(REG64 a,R_M8 b){return x86(837,a,b);}
-enc movzx(REG32 a,REG16 b){return x86(838,a,b);}
-enc movzx(REG32 a,MEM16 b){return x86(838,a,b);}
-enc movzx(REG32 a,R_M16 b){return x86(838,a,b);}
-enc movzx(REG64 a,REG16 b){return x86(839,a,b);}
-enc movzx(REG64 a,MEM16 b){return x86(839,a,b);}
-enc movzx(REG64 a,R_M16 b){return x86(839,a,b);}
-enc mul(REG8 a){return x86(840,a);}
-enc mul(MEM8 a){return x86(840,a);}
-enc mul(R_M8 a){return x86(840,a);}
-enc mul(REG16 a){return x86(841,a);}
-enc mul(MEM16 a){return x86(841,a);}
-enc mul(R_M16 a){return x86(841,a);}
-enc mul(REG32 a){return x86(842,a);}
-enc mul(MEM32 a){return x86(842,a);}
-enc mul(R_M32 a){return x86(842,a);}
-enc mul(REG64 a){return x86(843,a);}
-enc mul(MEM64 a){return x86(843,a);}
-enc mul(R_M64 a){return x86(843,a);}
-enc mulpd(XMMREG a,XMMREG b){return x86(844,a,b);}
-enc mulpd(XMMREG a,MEM128 b){return x86(844,a,b);}
-enc mulpd(XMMREG a,R_M128 b){return x86(844,a,b);}
-enc mulps(XMMREG a,XMMREG b){return x86(845,a,b);}
-enc mulps(XMMREG a,MEM128 b){return x86(845,a,b);}
-enc mulps(XMMREG a,R_M128 b){return x86(845,a,b);}
-enc mulsd(XMMREG a,XMMREG b){return x86(846,a,b);}
-enc mulsd(XMMREG a,MEM64 b){return x86(846,a,b);}
-enc mulsd(XMMREG a,XMM64 b){return x86(846,a,b);}
-enc mulss(XMMREG a,XMMREG b){return x86(847,a,b);}
-enc mulss(XMMREG a,MEM32 b){return x86(847,a,b);}
-enc mulss(XMMREG a,XMM32 b){return x86(847,a,b);}
-enc mwait(){return x86(848);}
-enc neg(REG8 a){return x86(849,a);}
-enc neg(MEM8 a){return x86(849,a);}
-enc neg(R_M8 a){return x86(849,a);}
-enc neg(REG16 a){return x86(850,a);}
-enc neg(MEM16 a){return x86(850,a);}
-enc neg(R_M16 a){return x86(850,a);}
-enc neg(REG32 a){return x86(851,a);}
-enc neg(MEM32 a){return x86(851,a);}
-enc neg(R_M32 a){return x86(851,a);}
-enc neg(REG64 a){return x86(852,a);}
-enc neg(MEM64 a){return x86(852,a);}
-enc neg(R_M64 a){return x86(852,a);}
-enc nop(){return x86(853);}
-enc not(REG8 a){return x86(854,a);}
-enc not(MEM8 a){return x86(854,a);}
-enc not(R_M8 a){return x86(854,a);}
-enc not(REG16 a){return x86(855,a);}
-enc not(MEM16 a){return x86(855,a);}
-enc not(R_M16 a){return x86(855,a);}
-enc not(REG32 a){return x86(856,a);}
-enc not(MEM32 a){return x86(856,a);}
-enc not(R_M32 a){return x86(856,a);}
-enc not(REG64 a){return x86(857,a);}
-enc not(MEM64 a){return x86(857,a);}
-enc not(R_M64 a){return x86(857,a);}
-enc null(){return x86(858);}
-enc or(REG8 a,REG8 b){return x86(859,a,b);}
-enc or(MEM8 a,REG8 b){return x86(859,a,b);}
-enc or(R_M8 a,REG8 b){return x86(859,a,b);}
-enc or(REG16 a,REG16 b){return x86(860,a,b);}
-enc or(MEM16 a,REG16 b){return x86(860,a,b);}
-enc or(R_M16 a,REG16 b){return x86(860,a,b);}
-enc or(REG32 a,REG32 b){return x86(861,a,b);}
-enc or(MEM32 a,REG32 b){return x86(861,a,b);}
-enc or(R_M32 a,REG32 b){return x86(861,a,b);}
-enc or(REG64 a,REG64 b){return x86(862,a,b);}
-enc or(MEM64 a,REG64 b){return x86(862,a,b);}
-enc or(R_M64 a,REG64 b){return x86(862,a,b);}
-enc or(REG8 a,MEM8 b){return x86(863,a,b);}
-enc or(REG8 a,R_M8 b){return x86(863,a,b);}
-enc or(REG16 a,MEM16 b){return x86(864,a,b);}
-enc or(REG16 a,R_M16 b){return x86(864,a,b);}
-enc or(REG32 a,MEM32 b){return x86(865,a,b);}
-enc or(REG32 a,R_M32 b){return x86(865,a,b);}
-enc or(REG64 a,MEM64 b){return x86(866,a,b);}
-enc or(REG64 a,R_M64 b){return x86(866,a,b);}
-enc or(REG8 a,byte b){return x86(867,a,(IMM)b);}
-enc or(AL a,byte b){return x86(867,a,(IMM)b);}
-enc or(CL a,byte b){return x86(867,a,(IMM)b);}
-enc or(MEM8 a,byte b){return x86(867,a,(IMM)b);}
-enc or(R_M8 a,byte b){return x86(867,a,(IMM)b);}
-enc or(REG16 a,byte b){return x86(868,a,(IMM)b);}
-enc or(REG16 a,word b){return x86(868,a,(IMM)b);}
-enc or(MEM16 a,byte b){return x86(868,a,(IMM)b);}
-enc or(MEM16 a,word b){return x86(868,a,(IMM)b);}
-enc or(R_M16 a,byte b){return x86(868,a,(IMM)b);}
-enc or(R_M16 a,word b){return x86(868,a,(IMM)b);}
-enc or(REG32 a,REF b){return x86(869,a,b);}
-enc or(REG32 a,dword b){return x86(869,a,(IMM)b);}
-enc or(MEM32 a,REF b){return x86(869,a,b);}
-enc or(MEM32 a,dword b){return x86(869,a,(IMM)b);}
-enc or(R_M32 a,REF b){return x86(869,a,b);}
-enc or(R_M32 a,dword b){return x86(869,a,(IMM)b);}
-enc or(REG64 a,REF b){return x86(870,a,b);}
-enc or(REG64 a,dword b){return x86(870,a,(IMM)b);}
-enc or(MEM64 a,REF b){return x86(870,a,b);}
-enc or(MEM64 a,dword b){return x86(870,a,(IMM)b);}
-enc or(R_M64 a,REF b){return x86(870,a,b);}
-enc or(R_M64 a,dword b){return x86(870,a,(IMM)b);}
-enc orpd(XMMREG a,XMMREG b){return x86(878,a,b);}
-enc orpd(XMMREG a,MEM128 b){return x86(878,a,b);}
-enc orpd(XMMREG a,R_M128 b){return x86(878,a,b);}
-enc orps(XMMREG a,XMMREG b){return x86(879,a,b);}
-enc orps(XMMREG a,MEM128 b){return x86(879,a,b);}
-enc orps(XMMREG a,R_M128 b){return x86(879,a,b);}
-enc out(byte a,AL b){return x86(880,(IMM)a,b);}
-enc out(byte a,AX b){return x86(881,(IMM)a,b);}
-enc out(byte a,EAX b){return x86(882,(IMM)a,b);}
-enc out(DX a,AL b){return x86(883,a,b);}
-enc out(DX a,AX b){return x86(884,a,b);}
-enc out(DX a,EAX b){return x86(885,a,b);}
-enc outsb(){return x86(886);}
-enc outsd(){return x86(887);}
-enc outsw(){return x86(888);}
-enc packssdw(MMREG a,MMREG b){return x86(889,a,b);}
-enc packssdw(MMREG a,MEM64 b){return x86(889,a,b);}
-enc packssdw(MMREG a,MM64 b){return x86(889,a,b);}
-enc packssdw(XMMREG a,XMMREG b){return x86(890,a,b);}
-enc packssdw(XMMREG a,MEM128 b){return x86(890,a,b);}
-enc packssdw(XMMREG a,R_M128 b){return x86(890,a,b);}
-enc packsswb(MMREG a,MMREG b){return x86(891,a,b);}
-enc packsswb(MMREG a,MEM64 b){return x86(891,a,b);}
-enc packsswb(MMREG a,MM64 b){return x86(891,a,b);}
-enc packsswb(XMMREG a,XMMREG b){return x86(892,a,b);}
-enc packsswb(XMMREG a,MEM128 b){return x86(892,a,b);}
-enc packsswb(XMMREG a,R_M128 b){return x86(892,a,b);}
-enc packuswb(MMREG a,MMREG b){return x86(893,a,b);}
-enc packuswb(MMREG a,MEM64 b){return x86(893,a,b);}
-enc packuswb(MMREG a,MM64 b){return x86(893,a,b);}
-enc packuswb(XMMREG a,XMMREG b){return x86(894,a,b);}
-enc packuswb(XMMREG a,MEM128 b){return x86(894,a,b);}
-enc packuswb(XMMREG a,R_M128 b){return x86(894,a,b);}
-enc paddb(MMREG a,MMREG b){return x86(895,a,b);}
-enc paddb(MMREG a,MEM64 b){return x86(895,a,b);}
-enc paddb(MMREG a,MM64 b){return x86(895,a,b);}
-enc paddb(XMMREG a,XMMREG b){return x86(896,a,b);}
-enc paddb(XMMREG a,MEM128 b){return x86(896,a,b);}
-enc paddb(XMMREG a,R_M128 b){return x86(896,a,b);}
-enc paddd(MMREG a,MMREG b){return x86(897,a,b);}
-enc paddd(MMREG a,MEM64 b){return x86(897,a,b);}
-enc paddd(MMREG a,MM64 b){return x86(897,a,b);}
-enc paddd(XMMREG a,XMMREG b){return x86(898,a,b);}
-enc paddd(XMMREG a,MEM128 b){return x86(898,a,b);}
-enc paddd(XMMREG a,R_M128 b){return x86(898,a,b);}
-enc paddq(MMREG a,MMREG b){return x86(899,a,b);}
-enc paddq(MMREG a,MEM64 b){return x86(899,a,b);}
-enc paddq(MMREG a,MM64 b){return x86(899,a,b);}
-enc paddq(XMMREG a,XMMREG b){return x86(900,a,b);}
-enc paddq(XMMREG a,MEM128 b){return x86(900,a,b);}
-enc paddq(XMMREG a,R_M128 b){return x86(900,a,b);}
-enc paddsb(MMREG a,MMREG b){return x86(901,a,b);}
-enc paddsb(MMREG a,MEM64 b){return x86(901,a,b);}
-enc paddsb(MMREG a,MM64 b){return x86(901,a,b);}
-enc paddsb(XMMREG a,XMMREG b){return x86(902,a,b);}
-enc paddsb(XMMREG a,MEM128 b){return x86(902,a,b);}
-enc paddsb(XMMREG a,R_M128 b){return x86(902,a,b);}
-enc paddsiw(MMREG a,MMREG b){return x86(903,a,b);}
-enc paddsiw(MMREG a,MEM64 b){return x86(903,a,b);}
-enc paddsiw(MMREG a,MM64 b){return x86(903,a,b);}
-enc paddsw(MMREG a,MMREG b){return x86(904,a,b);}
-enc paddsw(MMREG a,MEM64 b){return x86(904,a,b);}
-enc paddsw(MMREG a,MM64 b){return x86(904,a,b);}
-enc paddsw(XMMREG a,XMMREG b){return x86(905,a,b);}
-enc paddsw(XMMREG a,MEM128 b){return x86(905,a,b);}
-enc paddsw(XMMREG a,R_M128 b){return x86(905,a,b);}
-enc paddusb(MMREG a,MMREG b){return x86(906,a,b);}
-enc paddusb(MMREG a,MEM64 b){return x86(906,a,b);}
-enc paddusb(MMREG a,MM64 b){return x86(906,a,b);}
-enc paddusb(XMMREG a,XMMREG b){return x86(907,a,b);}
-enc paddusb(XMMREG a,MEM128 b){return x86(907,a,b);}
-enc paddusb(XMMREG a,R_M128 b){return x86(907,a,b);}
-enc paddusw(MMREG a,MMREG b){return x86(908,a,b);}
-enc paddusw(MMREG a,MEM64 b){return x86(908,a,b);}
-enc paddusw(MMREG a,MM64 b){return x86(908,a,b);}
-enc paddusw(XMMREG a,XMMREG b){return x86(909,a,b);}
-enc paddusw(XMMREG a,MEM128 b){return x86(909,a,b);}
-enc paddusw(XMMREG a,R_M128 b){return x86(909,a,b);}
-enc paddw(MMREG a,MMREG b){return x86(910,a,b);}
-enc paddw(MMREG a,MEM64 b){return x86(910,a,b);}
-enc paddw(MMREG a,MM64 b){return x86(910,a,b);}
-enc paddw(XMMREG a,XMMREG b){return x86(911,a,b);}
-enc paddw(XMMREG a,MEM128 b){return x86(911,a,b);}
-enc paddw(XMMREG a,R_M128 b){return x86(911,a,b);}
-enc pand(MMREG a,MMREG b){return x86(912,a,b);}
-enc pand(MMREG a,MEM64 b){return x86(912,a,b);}
-enc pand(MMREG a,MM64 b){return x86(912,a,b);}
-enc pand(XMMREG a,XMMREG b){return x86(913,a,b);}
-enc pand(XMMREG a,MEM128 b){return x86(913,a,b);}
-enc pand(XMMREG a,R_M128 b){return x86(913,a,b);}
-enc pandn(MMREG a,MMREG b){return x86(914,a,b);}
-enc pandn(MMREG a,MEM64 b){return x86(914,a,b);}
-enc pandn(MMREG a,MM64 b){return x86(914,a,b);}
-enc pandn(XMMREG a,XMMREG b){return x86(915,a,b);}
-enc pandn(XMMREG a,MEM128 b){return x86(915,a,b);}
-enc pandn(XMMREG a,R_M128 b){return x86(915,a,b);}
-enc pause(){return x86(916);}
-enc paveb(MMREG a,MMREG b){return x86(917,a,b);}
-enc paveb(MMREG a,MEM64 b){return x86(917,a,b);}
-enc paveb(MMREG a,MM64 b){return x86(917,a,b);}
-enc pavgb(MMREG a,MMREG b){return x86(918,a,b);}
-enc pavgb(MMREG a,MEM64 b){return x86(918,a,b);}
-enc pavgb(MMREG a,MM64 b){return x86(918,a,b);}
-enc pavgb(XMMREG a,XMMREG b){return x86(919,a,b);}
-enc pavgb(XMMREG a,MEM128 b){return x86(919,a,b);}
-enc pavgb(XMMREG a,R_M128 b){return x86(919,a,b);}
-enc pavgusb(MMREG a,MMREG b){return x86(920,a,b);}
-enc pavgusb(MMREG a,MEM64 b){return x86(920,a,b);}
-enc pavgusb(MMREG a,MM64 b){return x86(920,a,b);}
-enc pavgw(MMREG a,MMREG b){return x86(921,a,b);}
-enc pavgw(MMREG a,MEM64 b){return x86(921,a,b);}
-enc pavgw(MMREG a,MM64 b){return x86(921,a,b);}
-enc pavgw(XMMREG a,XMMREG b){return x86(922,a,b);}
-enc pavgw(XMMREG a,MEM128 b){return x86(922,a,b);}
-enc pavgw(XMMREG a,R_M128 b){return x86(922,a,b);}
-enc pcmpeqb(MMREG a,MMREG b){return x86(923,a,b);}
-enc pcmpeqb(MMREG a,MEM64 b){return x86(923,a,b);}
-enc pcmpeqb(MMREG a,MM64 b){return x86(923,a,b);}
-enc pcmpeqb(XMMREG a,XMMREG b){return x86(924,a,b);}
-enc pcmpeqb(XMMREG a,MEM128 b){return x86(924,a,b);}
-enc pcmpeqb(XMMREG a,R_M128 b){return x86(924,a,b);}
-enc pcmpeqd(MMREG a,MMREG b){return x86(925,a,b);}
-enc pcmpeqd(MMREG a,MEM64 b){return x86(925,a,b);}
-enc pcmpeqd(MMREG a,MM64 b){return x86(925,a,b);}
-enc pcmpeqd(XMMREG a,XMMREG b){return x86(926,a,b);}
-enc pcmpeqd(XMMREG a,MEM128 b){return x86(926,a,b);}
-enc pcmpeqd(XMMREG a,R_M128 b){return x86(926,a,b);}
-enc pcmpeqw(MMREG a,MMREG b){return x86(927,a,b);}
-enc pcmpeqw(MMREG a,MEM64 b){return x86(927,a,b);}
-enc pcmpeqw(MMREG a,MM64 b){return x86(927,a,b);}
-enc pcmpeqw(XMMREG a,XMMREG b){return x86(928,a,b);}
-enc pcmpeqw(XMMREG a,MEM128 b){return x86(928,a,b);}
-enc pcmpeqw(XMMREG a,R_M128 b){return x86(928,a,b);}
-enc pcmpgtb(MMREG a,MMREG b){return x86(929,a,b);}
-enc pcmpgtb(MMREG a,MEM64 b){return x86(929,a,b);}
-enc pcmpgtb(MMREG a,MM64 b){return x86(929,a,b);}
-enc pcmpgtb(XMMREG a,XMMREG b){return x86(930,a,b);}
-enc pcmpgtb(XMMREG a,MEM128 b){return x86(930,a,b);}
-enc pcmpgtb(XMMREG a,R_M128 b){return x86(930,a,b);}
-enc pcmpgtd(MMREG a,MMREG b){return x86(931,a,b);}
-enc pcmpgtd(MMREG a,MEM64 b){return x86(931,a,b);}
-enc pcmpgtd(MMREG a,MM64 b){return x86(931,a,b);}
-enc pcmpgtd(XMMREG a,XMMREG b){return x86(932,a,b);}
-enc pcmpgtd(XMMREG a,MEM128 b){return x86(932,a,b);}
-enc pcmpgtd(XMMREG a,R_M128 b){return x86(932,a,b);}
-enc pcmpgtw(MMREG a,MMREG b){return x86(933,a,b);}
-enc pcmpgtw(MMREG a,MEM64 b){return x86(933,a,b);}
-enc pcmpgtw(MMREG a,MM64 b){return x86(933,a,b);}
-enc pcmpgtw(XMMREG a,XMMREG b){return x86(934,a,b);}
-enc pcmpgtw(XMMREG a,MEM128 b){return x86(934,a,b);}
-enc pcmpgtw(XMMREG a,R_M128 b){return x86(934,a,b);}
-enc pdistib(MMREG a,MEM64 b){return x86(935,a,b);}
-enc pextrw(REG32 a,MMREG b,byte c){return x86(936,a,b,(IMM)c);}
-enc pextrw(EAX a,MMREG b,byte c){return x86(936,a,b,(IMM)c);}
-enc pextrw(ECX a,MMREG b,byte c){return x86(936,a,b,(IMM)c);}
-enc pextrw(REG32 a,XMMREG b,byte c){return x86(937,a,b,(IMM)c);}
-enc pextrw(EAX a,XMMREG b,byte c){return x86(937,a,b,(IMM)c);}
-enc pextrw(ECX a,XMMREG b,byte c){return x86(937,a,b,(IMM)c);}
-enc pf2id(MMREG a,MMREG b){return x86(938,a,b);}
-enc pf2id(MMREG a,MEM64 b){return x86(938,a,b);}
-enc pf2id(MMREG a,MM64 b){return x86(938,a,b);}
-enc pf2iw(MMREG a,MMREG b){return x86(939,a,b);}
-enc pf2iw(MMREG a,MEM64 b){return x86(939,a,b);}
-enc pf2iw(MMREG a,MM64 b){return x86(939,a,b);}
-enc pfacc(MMREG a,MMREG b){return x86(940,a,b);}
-enc pfacc(MMREG a,MEM64 b){return x86(940,a,b);}
-enc pfacc(MMREG a,MM64 b){return x86(940,a,b);}
-enc pfadd(MMREG a,MMREG b){return x86(941,a,b);}
-enc pfadd(MMREG a,MEM64 b){return x86(941,a,b);}
-enc pfadd(MMREG a,MM64 b){return x86(941,a,b);}
-enc pfcmpeq(MMREG a,MMREG b){return x86(942,a,b);}
-enc pfcmpeq(MMREG a,MEM64 b){return x86(942,a,b);}
-enc pfcmpeq(MMREG a,MM64 b){return x86(942,a,b);}
-enc pfcmpge(MMREG a,MMREG b){return x86(943,a,b);}
-enc pfcmpge(MMREG a,MEM64 b){return x86(943,a,b);}
-enc pfcmpge(MMREG a,MM64 b){return x86(943,a,b);}
-enc pfcmpgt(MMREG a,MMREG b){return x86(944,a,b);}
-enc pfcmpgt(MMREG a,MEM64 b){return x86(944,a,b);}
-enc pfcmpgt(MMREG a,MM64 b){return x86(944,a,b);}
-enc pfmax(MMREG a,MMREG b){return x86(945,a,b);}
-enc pfmax(MMREG a,MEM64 b){return x86(945,a,b);}
-enc pfmax(MMREG a,MM64 b){return x86(945,a,b);}
-enc pfmin(MMREG a,MMREG b){return x86(946,a,b);}
-enc pfmin(MMREG a,MEM64 b){return x86(946,a,b);}
-enc pfmin(MMREG a,MM64 b){return x86(946,a,b);}
-enc pfmul(MMREG a,MMREG b){return x86(947,a,b);}
-enc pfmul(MMREG a,MEM64 b){return x86(947,a,b);}
-enc pfmul(MMREG a,MM64 b){return x86(947,a,b);}
-enc pfnacc(MMREG a,MMREG b){return x86(948,a,b);}
-enc pfnacc(MMREG a,MEM64 b){return x86(948,a,b);}
-enc pfnacc(MMREG a,MM64 b){return x86(948,a,b);}
-enc pfpnacc(MMREG a,MMREG b){return x86(949,a,b);}
-enc pfpnacc(MMREG a,MEM64 b){return x86(949,a,b);}
-enc pfpnacc(MMREG a,MM64 b){return x86(949,a,b);}
-enc pfrcp(MMREG a,MMREG b){return x86(950,a,b);}
-enc pfrcp(MMREG a,MEM64 b){return x86(950,a,b);}
-enc pfrcp(MMREG a,MM64 b){return x86(950,a,b);}
-enc pfrcpit1(MMREG a,MMREG b){return x86(951,a,b);}
-enc pfrcpit1(MMREG a,MEM64 b){return x86(951,a,b);}
-enc pfrcpit1(MMREG a,MM64 b){return x86(951,a,b);}
-enc pfrcpit2(MMREG a,MMREG b){return x86(952,a,b);}
-enc pfrcpit2(MMREG a,MEM64 b){return x86(952,a,b);}
-enc pfrcpit2(MMREG a,MM64 b){return x86(952,a,b);}
-enc pfrsqit1(MMREG a,MMREG b){return x86(953,a,b);}
-enc pfrsqit1(MMREG a,MEM64 b){return x86(953,a,b);}
-enc pfrsqit1(MMREG a,MM64 b){return x86(953,a,b);}
-enc pfrsqrt(MMREG a,MMREG b){return x86(954,a,b);}
-enc pfrsqrt(MMREG a,MEM64 b){return x86(954,a,b);}
-enc pfrsqrt(MMREG a,MM64 b){return x86(954,a,b);}
-enc pfsub(MMREG a,MMREG b){return x86(955,a,b);}
-enc pfsub(MMREG a,MEM64 b){return x86(955,a,b);}
-enc pfsub(MMREG a,MM64 b){return x86(955,a,b);}
-enc pfsubr(MMREG a,MMREG b){return x86(956,a,b);}
-enc pfsubr(MMREG a,MEM64 b){return x86(956,a,b);}
-enc pfsubr(MMREG a,MM64 b){return x86(956,a,b);}
-enc pi2fd(MMREG a,MMREG b){return x86(957,a,b);}
-enc pi2fd(MMREG a,MEM64 b){return x86(957,a,b);}
-enc pi2fd(MMREG a,MM64 b){return x86(957,a,b);}
-enc pi2fw(MMREG a,MMREG b){return x86(958,a,b);}
-enc pi2fw(MMREG a,MEM64 b){return x86(958,a,b);}
-enc pi2fw(MMREG a,MM64 b){return x86(958,a,b);}
-enc pinsrw(MMREG a,REG16 b,byte c){return x86(959,a,b,(IMM)c);}
-enc pinsrw(MMREG a,AX b,byte c){return x86(959,a,b,(IMM)c);}
-enc pinsrw(MMREG a,DX b,byte c){return x86(959,a,b,(IMM)c);}
-enc pinsrw(MMREG a,CX b,byte c){return x86(959,a,b,(IMM)c);}
-enc pinsrw(MMREG a,MEM16 b,byte c){return x86(959,a,b,(IMM)c);}
-enc pinsrw(MMREG a,R_M16 b,byte c){return x86(959,a,b,(IMM)c);}
-enc pinsrw(XMMREG a,REG16 b,byte c){return x86(960,a,b,(IMM)c);}
-enc pinsrw(XMMREG a,AX b,byte c){return x86(960,a,b,(IMM)c);}
-enc pinsrw(XMMREG a,DX b,byte c){return x86(960,a,b,(IMM)c);}
-enc pinsrw(XMMREG a,CX b,byte c){return x86(960,a,b,(IMM)c);}
-enc pinsrw(XMMREG a,MEM16 b,byte c){return x86(960,a,b,(IMM)c);}
-enc pinsrw(XMMREG a,R_M16 b,byte c){return x86(960,a,b,(IMM)c);}
-enc pmachriw(MMREG a,MEM64 b){return x86(961,a,b);}
-enc pmaddwd(MMREG a,MMREG b){return x86(962,a,b);}
-enc pmaddwd(MMREG a,MEM64 b){return x86(962,a,b);}
-enc pmaddwd(MMREG a,MM64 b){return x86(962,a,b);}
-enc pmaddwd(XMMREG a,XMMREG b){return x86(963,a,b);}
-enc pmaddwd(XMMREG a,MEM128 b){return x86(963,a,b);}
-enc pmaddwd(XMMREG a,R_M128 b){return x86(963,a,b);}
-enc pmagw(MMREG a,MMREG b){return x86(964,a,b);}
-enc pmagw(MMREG a,MEM64 b){return x86(964,a,b);}
-enc pmagw(MMREG a,MM64 b){return x86(964,a,b);}
-enc pmaxsw(XMMREG a,XMMREG b){return x86(965,a,b);}
-enc pmaxsw(XMMREG a,MEM128 b){return x86(965,a,b);}
-enc pmaxsw(XMMREG a,R_M128 b){return x86(965,a,b);}
-enc pmaxsw(MMREG a,MMREG b){return x86(966,a,b);}
-enc pmaxsw(MMREG a,MEM64 b){return x86(966,a,b);}
-enc pmaxsw(MMREG a,MM64 b){return x86(966,a,b);}
-enc pmaxub(MMREG a,MMREG b){return x86(967,a,b);}
-enc pmaxub(MMREG a,MEM64 b){return x86(967,a,b);}
-enc pmaxub(MMREG a,MM64 b){return x86(967,a,b);}
-enc pmaxub(XMMREG a,XMMREG b){return x86(968,a,b);}
-enc pmaxub(XMMREG a,MEM128 b){return x86(968,a,b);}
-enc pmaxub(XMMREG a,R_M128 b){return x86(968,a,b);}
-enc pminsw(MMREG a,MMREG b){return x86(969,a,b);}
-enc pminsw(MMREG a,MEM64 b){return x86(969,a,b);}
-enc pminsw(MMREG a,MM64 b){return x86(969,a,b);}
-enc pminsw(XMMREG a,XMMREG b){return x86(970,a,b);}
-enc pminsw(XMMREG a,MEM128 b){return x86(970,a,b);}
-enc pminsw(XMMREG a,R_M128 b){return x86(970,a,b);}
-enc pminub(MMREG a,MMREG b){return x86(971,a,b);}
-enc pminub(MMREG a,MEM64 b){return x86(971,a,b);}
-enc pminub(MMREG a,MM64 b){return x86(971,a,b);}
-enc pminub(XMMREG a,XMMREG b){return x86(972,a,b);}
-enc pminub(XMMREG a,MEM128 b){return x86(972,a,b);}
-enc pminub(XMMREG a,R_M128 b){return x86(972,a,b);}
-enc pmovmskb(REG32 a,MMREG b){return x86(973,a,b);}
-enc pmovmskb(REG32 a,XMMREG b){return x86(974,a,b);}
-enc pmulhriw(MMREG a,MMREG b){return x86(975,a,b);}
-enc pmulhriw(MMREG a,MEM64 b){return x86(975,a,b);}
-enc pmulhriw(MMREG a,MM64 b){return x86(975,a,b);}
-enc pmulhrwa(MMREG a,MMREG b){return x86(976,a,b);}
-enc pmulhrwa(MMREG a,MEM64 b){return x86(976,a,b);}
-enc pmulhrwa(MMREG a,MM64 b){return x86(976,a,b);}
-enc pmulhrwc(MMREG a,MMREG b){return x86(977,a,b);}
-enc pmulhrwc(MMREG a,MEM64 b){return x86(977,a,b);}
-enc pmulhrwc(MMREG a,MM64 b){return x86(977,a,b);}
-enc pmulhuw(MMREG a,MMREG b){return x86(978,a,b);}
-enc pmulhuw(MMREG a,MEM64 b){return x86(978,a,b);}
-enc pmulhuw(MMREG a,MM64 b){return x86(978,a,b);}
-enc pmulhuw(XMMREG a,XMMREG b){return x86(979,a,b);}
-enc pmulhuw(XMMREG a,MEM128 b){return x86(979,a,b);}
-enc pmulhuw(XMMREG a,R_M128 b){return x86(979,a,b);}
-enc pmulhw(MMREG a,MMREG b){return x86(980,a,b);}
-enc pmulhw(MMREG a,MEM64 b){return x86(980,a,b);}
-enc pmulhw(MMREG a,MM64 b){return x86(980,a,b);}
-enc pmulhw(XMMREG a,XMMREG b){return x86(981,a,b);}
-enc pmulhw(XMMREG a,MEM128 b){return x86(981,a,b);}
-enc pmulhw(XMMREG a,R_M128 b){return x86(981,a,b);}
-enc pmullw(MMREG a,MMREG b){return x86(982,a,b);}
-enc pmullw(MMREG a,MEM64 b){return x86(982,a,b);}
-enc pmullw(MMREG a,MM64 b){return x86(982,a,b);}
-enc pmullw(XMMREG a,XMMREG b){return x86(983,a,b);}
-enc pmullw(XMMREG a,MEM128 b){return x86(983,a,b);}
-enc pmullw(XMMREG a,R_M128 b){return x86(983,a,b);}
-enc pmuludq(MMREG a,MMREG b){return x86(984,a,b);}
-enc pmuludq(MMREG a,MEM64 b){return x86(984,a,b);}
-enc pmuludq(MMREG a,MM64 b){return x86(984,a,b);}
-enc pmuludq(XMMREG a,XMMREG b){return x86(985,a,b);}
-enc pmuludq(XMMREG a,MEM128 b){return x86(985,a,b);}
-enc pmuludq(XMMREG a,R_M128 b){return x86(985,a,b);}
-enc pmvgezb(MMREG a,MEM64 b){return x86(986,a,b);}
-enc pmvlzb(MMREG a,MEM64 b){return x86(987,a,b);}
-enc pmvnzb(MMREG a,MEM64 b){return x86(988,a,b);}
-enc pmvzb(MMREG a,MEM64 b){return x86(989,a,b);}
-enc pop(REG16 a){return x86(990,a);}
-enc pop(REG32 a){return x86(991,a);}
-enc pop(REG64 a){return x86(992,a);}
-enc pop(MEM16 a){return x86(993,a);}
-enc pop(R_M16 a){return x86(993,a);}
-enc pop(MEM32 a){return x86(994,a);}
-enc pop(R_M32 a){return x86(994,a);}
-enc pop(MEM64 a){return x86(995,a);}
-enc pop(R_M64 a){return x86(995,a);}
-enc popa(){return x86(996);}
-enc popad(){return x86(997);}
-enc popaw(){return x86(998);}
-enc popf(){return x86(999);}
-enc popfd(){return x86(1000);}
-enc popfq(){return x86(1001);}
-enc popfw(){return x86(1002);}
-enc por(MMREG a,MMREG b){return x86(1003,a,b);}
-enc por(MMREG a,MEM64 b){return x86(1003,a,b);}
-enc por(MMREG a,MM64 b){return x86(1003,a,b);}
-enc por(XMMREG a,XMMREG b){return x86(1004,a,b);}
-enc por(XMMREG a,MEM128 b){return x86(1004,a,b);}
-enc por(XMMREG a,R_M128 b){return x86(1004,a,b);}
-enc prefetch(MEM8 a){return x86(1005,a);}
-enc prefetch(MEM16 a){return x86(1005,a);}
-enc prefetch(MEM32 a){return x86(1005,a);}
-enc prefetch(MEM64 a){return x86(1005,a);}
-enc prefetch(MEM128 a){return x86(1005,a);}
-enc prefetchnta(MEM8 a){return x86(1006,a);}
-enc prefetchnta(MEM16 a){return x86(1006,a);}
-enc prefetchnta(MEM32 a){return x86(1006,a);}
-enc prefetchnta(MEM64 a){return x86(1006,a);}
-enc prefetchnta(MEM128 a){return x86(1006,a);}
-enc prefetcht0(MEM8 a){return x86(1007,a);}
-enc prefetcht0(MEM16 a){return x86(1007,a);}
-enc prefetcht0(MEM32 a){return x86(1007,a);}
-enc prefetcht0(MEM64 a){return x86(1007,a);}
-enc prefetcht0(MEM128 a){return x86(1007,a);}
-enc prefetcht1(MEM8 a){return x86(1008,a);}
-enc prefetcht1(MEM16 a){return x86(1008,a);}
-enc prefetcht1(MEM32 a){return x86(1008,a);}
-enc prefetcht1(MEM64 a){return x86(1008,a);}
-enc prefetcht1(MEM128 a){return x86(1008,a);}
-enc prefetcht2(MEM8 a){return x86(1009,a);}
-enc prefetcht2(MEM16 a){return x86(1009,a);}
-enc prefetcht2(MEM32 a){return x86(1009,a);}
-enc prefetcht2(MEM64 a){return x86(1009,a);}
-enc prefetcht2(MEM128 a){return x86(1009,a);}
-enc prefetchw(MEM8 a){return x86(1010,a);}
-enc prefetchw(MEM16 a){return x86(1010,a);}
-enc prefetchw(MEM32 a){return x86(1010,a);}
-enc prefetchw(MEM64 a){return x86(1010,a);}
-enc prefetchw(MEM128 a){return x86(1010,a);}
-enc psadbw(MMREG a,MMREG b){return x86(1011,a,b);}
-enc psadbw(MMREG a,MEM64 b){return x86(1011,a,b);}
-enc psadbw(MMREG a,MM64 b){return x86(1011,a,b);}
-enc psadbw(XMMREG a,XMMREG b){return x86(1012,a,b);}
-enc psadbw(XMMREG a,MEM128 b){return x86(1012,a,b);}
-enc psadbw(XMMREG a,R_M128 b){return x86(1012,a,b);}
-enc pshufd(XMMREG a,XMMREG b,byte c){return x86(1013,a,b,(IMM)c);}
-enc pshufd(XMMREG a,MEM128 b,byte c){return x86(1013,a,b,(IMM)c);}
-enc pshufd(XMMREG a,R_M128 b,byte c){return x86(1013,a,b,(IMM)c);}
-enc pshufhw(XMMREG a,XMMREG b,byte c){return x86(1014,a,b,(IMM)c);}
-enc pshufhw(XMMREG a,MEM128 b,byte c){return x86(1014,a,b,(IMM)c);}
-enc pshufhw(XMMREG a,R_M128 b,byte c){return x86(1014,a,b,(IMM)c);}
-enc pshuflw(XMMREG a,XMMREG b,byte c){return x86(1015,a,b,(IMM)c);}
-enc pshuflw(XMMREG a,MEM128 b,byte c){return x86(1015,a,b,(IMM)c);}
-enc pshuflw(XMMREG a,R_M128 b,byte c){return x86(1015,a,b,(IMM)c);}
-enc pshufw(MMREG a,MMREG b,byte c){return x86(1016,a,b,(IMM)c);}
-enc pshufw(MMREG a,MEM64 b,byte c){return x86(1016,a,b,(IMM)c);}
-enc pshufw(MMREG a,MM64 b,byte c){return x86(1016,a,b,(IMM)c);}
-enc pslld(MMREG a,MMREG b){return x86(1017,a,b);}
-enc pslld(MMREG a,MEM64 b){return x86(1017,a,b);}
-enc pslld(MMREG a,MM64 b){return x86(1017,a,b);}
-enc pslld(MMREG a,byte b){return x86(1018,a,(IMM)b);}
-enc pslld(XMMREG a,XMMREG b){return x86(1019,a,b);}
-enc pslld(XMMREG a,MEM128 b){return x86(1019,a,b);}
-enc pslld(XMMREG a,R_M128 b){return x86(1019,a,b);}
-enc pslld(XMMREG a,byte b){return x86(1020,a,(IMM)b);}
-enc psllq(MMREG a,MMREG b){return x86(1021,a,b);}
-enc psllq(MMREG a,MEM64 b){return x86(1021,a,b);}
-enc psllq(MMREG a,MM64 b){return x86(1021,a,b);}
-enc psllq(MMREG a,byte b){return x86(1022,a,(IMM)b);}
-enc psllq(XMMREG a,XMMREG b){return x86(1023,a,b);}
-enc psllq(XMMREG a,MEM128 b){return x86(1023,a,b);}
-enc psllq(XMMREG a,R_M128 b){return x86(1023,a,b);}
-enc psllq(XMMREG a,byte b){return x86(1024,a,(IMM)b);}
-enc psllw(MMREG a,MMREG b){return x86(1025,a,b);}
-enc psllw(MMREG a,MEM64 b){return x86(1025,a,b);}
-enc psllw(MMREG a,MM64 b){return x86(1025,a,b);}
-enc psllw(MMREG a,byte b){return x86(1026,a,(IMM)b);}
-enc psllw(XMMREG a,XMMREG b){return x86(1027,a,b);}
-enc psllw(XMMREG a,MEM128 b){return x86(1027,a,b);}
-enc psllw(XMMREG a,R_M128 b){return x86(1027,a,b);}
-enc psllw(XMMREG a,byte b){return x86(1028,a,(IMM)b);}
-enc psrad(MMREG a,MMREG b){return x86(1029,a,b);}
-enc psrad(MMREG a,MEM64 b){return x86(1029,a,b);}
-enc psrad(MMREG a,MM64 b){return x86(1029,a,b);}
-enc psrad(MMREG a,byte b){return x86(1030,a,(IMM)b);}
-enc psrad(XMMREG a,XMMREG b){return x86(1031,a,b);}
-enc psrad(XMMREG a,MEM128 b){return x86(1031,a,b);}
-enc psrad(XMMREG a,R_M128 b){return x86(1031,a,b);}
-enc psrad(XMMREG a,byte b){return x86(1032,a,(IMM)b);}
-enc psraw(MMREG a,MMREG b){return x86(1033,a,b);}
-enc psraw(MMREG a,MEM64 b){return x86(1033,a,b);}
-enc psraw(MMREG a,MM64 b){return x86(1033,a,b);}
-enc psraw(MMREG a,byte b){return x86(1034,a,(IMM)b);}
-enc psraw(XMMREG a,XMMREG b){return x86(1035,a,b);}
-enc psraw(XMMREG a,MEM128 b){return x86(1035,a,b);}
-enc psraw(XMMREG a,R_M128 b){return x86(1035,a,b);}
-enc psraw(XMMREG a,byte b){return x86(1036,a,(IMM)b);}
-enc psrld(MMREG a,MMREG b){return x86(1037,a,b);}
-enc psrld(MMREG a,MEM64 b){return x86(1037,a,b);}
-enc psrld(MMREG a,MM64 b){return x86(1037,a,b);}
-enc psrld(MMREG a,byte b){return x86(1038,a,(IMM)b);}
-enc psrld(XMMREG a,XMMREG b){return x86(1039,a,b);}
-enc psrld(XMMREG a,MEM128 b){return x86(1039,a,b);}
-enc psrld(XMMREG a,R_M128 b){return x86(1039,a,b);}
-enc psrld(XMMREG a,byte b){return x86(1040,a,(IMM)b);}
-enc psrldq(XMMREG a,byte b){return x86(1041,a,(IMM)b);}
-enc psrlq(MMREG a,MMREG b){return x86(1042,a,b);}
-enc psrlq(MMREG a,MEM64 b){return x86(1042,a,b);}
-enc psrlq(MMREG a,MM64 b){return x86(1042,a,b);}
-enc psrlq(MMREG a,byte b){return x86(1043,a,(IMM)b);}
-enc psrlq(XMMREG a,XMMREG b){return x86(1044,a,b);}
-enc psrlq(XMMREG a,MEM128 b){return x86(1044,a,b);}
-enc psrlq(XMMREG a,R_M128 b){return x86(1044,a,b);}
-enc psrlq(XMMREG a,byte b){return x86(1045,a,(IMM)b);}
-enc psrlw(MMREG a,MMREG b){return x86(1046,a,b);}
-enc psrlw(MMREG a,MEM64 b){return x86(1046,a,b);}
-enc psrlw(MMREG a,MM64 b){return x86(1046,a,b);}
-enc psrlw(MMREG a,byte b){return x86(1047,a,(IMM)b);}
-enc psrlw(XMMREG a,XMMREG b){return x86(1048,a,b);}
-enc psrlw(XMMREG a,MEM128 b){return x86(1048,a,b);}
-enc psrlw(XMMREG a,R_M128 b){return x86(1048,a,b);}
-enc psrlw(XMMREG a,byte b){return x86(1049,a,(IMM)b);}
-enc psubb(MMREG a,MMREG b){return x86(1050,a,b);}
-enc psubb(MMREG a,MEM64 b){return x86(1050,a,b);}
-enc psubb(MMREG a,MM64 b){return x86(1050,a,b);}
-enc psubb(XMMREG a,XMMREG b){return x86(1051,a,b);}
-enc psubb(XMMREG a,MEM128 b){return x86(1051,a,b);}
-enc psubb(XMMREG a,R_M128 b){return x86(1051,a,b);}
-enc psubd(MMREG a,MMREG b){return x86(1052,a,b);}
-enc psubd(MMREG a,MEM64 b){return x86(1052,a,b);}
-enc psubd(MMREG a,MM64 b){return x86(1052,a,b);}
-enc psubd(XMMREG a,XMMREG b){return x86(1053,a,b);}
-enc psubd(XMMREG a,MEM128 b){return x86(1053,a,b);}
-enc psubd(XMMREG a,R_M128 b){return x86(1053,a,b);}
-enc psubq(MMREG a,MMREG b){return x86(1054,a,b);}
-enc psubq(MMREG a,MEM64 b){return x86(1054,a,b);}
-enc psubq(MMREG a,MM64 b){return x86(1054,a,b);}
-enc psubq(XMMREG a,XMMREG b){return x86(1055,a,b);}
-enc psubq(XMMREG a,MEM128 b){return x86(1055,a,b);}
-enc psubq(XMMREG a,R_M128 b){return x86(1055,a,b);}
-enc psubsb(MMREG a,MMREG b){return x86(1056,a,b);}
-enc psubsb(MMREG a,MEM64 b){return x86(1056,a,b);}
-enc psubsb(MMREG a,MM64 b){return x86(1056,a,b);}
-enc psubsb(XMMREG a,XMMREG b){return x86(1057,a,b);}
-enc psubsb(XMMREG a,MEM128 b){return x86(1057,a,b);}
-enc psubsb(XMMREG a,R_M128 b){return x86(1057,a,b);}
-enc psubsiw(MMREG a,MMREG b){return x86(1058,a,b);}
-enc psubsiw(MMREG a,MEM64 b){return x86(1058,a,b);}
-enc psubsiw(MMREG a,MM64 b){return x86(1058,a,b);}
-enc psubsw(MMREG a,MMREG b){return x86(1059,a,b);}
-enc psubsw(MMREG a,MEM64 b){return x86(1059,a,b);}
-enc psubsw(MMREG a,MM64 b){return x86(1059,a,b);}
-enc psubsw(XMMREG a,XMMREG b){return x86(1060,a,b);}
-enc psubsw(XMMREG a,MEM128 b){return x86(1060,a,b);}
-enc psubsw(XMMREG a,R_M128 b){return x86(1060,a,b);}
-enc psubusb(MMREG a,MMREG b){return x86(1061,a,b);}
-enc psubusb(MMREG a,MEM64 b){return x86(1061,a,b);}
-enc psubusb(MMREG a,MM64 b){return x86(1061,a,b);}
-enc psubusb(XMMREG a,XMMREG b){return x86(1062,a,b);}
-enc psubusb(XMMREG a,MEM128 b){return x86(1062,a,b);}
-enc psubusb(XMMREG a,R_M128 b){return x86(1062,a,b);}
-enc psubusw(MMREG a,MMREG b){return x86(1063,a,b);}
-enc psubusw(MMREG a,MEM64 b){return x86(1063,a,b);}
-enc psubusw(MMREG a,MM64 b){return x86(1063,a,b);}
-enc psubusw(XMMREG a,XMMREG b){return x86(1064,a,b);}
-enc psubusw(XMMREG a,MEM128 b){return x86(1064,a,b);}
-enc psubusw(XMMREG a,R_M128 b){return x86(1064,a,b);}
-enc psubw(MMREG a,MMREG b){return x86(1065,a,b);}
-enc psubw(MMREG a,MEM64 b){return x86(1065,a,b);}
-enc psubw(MMREG a,MM64 b){return x86(1065,a,b);}
-enc psubw(XMMREG a,XMMREG b){return x86(1066,a,b);}
-enc psubw(XMMREG a,MEM128 b){return x86(1066,a,b);}
-enc psubw(XMMREG a,R_M128 b){return x86(1066,a,b);}
-enc pswapd(MMREG a,MMREG b){return x86(1067,a,b);}
-enc pswapd(MMREG a,MEM64 b){return x86(1067,a,b);}
-enc pswapd(MMREG a,MM64 b){return x86(1067,a,b);}
-enc punpckhbw(MMREG a,MMREG b){return x86(1068,a,b);}
-enc punpckhbw(MMREG a,MEM64 b){return x86(1068,a,b);}
-enc punpckhbw(MMREG a,MM64 b){return x86(1068,a,b);}
-enc punpckhbw(XMMREG a,XMMREG b){return x86(1069,a,b);}
-enc punpckhbw(XMMREG a,MEM128 b){return x86(1069,a,b);}
-enc punpckhbw(XMMREG a,R_M128 b){return x86(1069,a,b);}
-enc punpckhdq(MMREG a,MMREG b){return x86(1070,a,b);}
-enc punpckhdq(MMREG a,MEM64 b){return x86(1070,a,b);}
-enc punpckhdq(MMREG a,MM64 b){return x86(1070,a,b);}
-enc punpckhdq(XMMREG a,XMMREG b){return x86(1071,a,b);}
-enc punpckhdq(XMMREG a,MEM128 b){return x86(1071,a,b);}
-enc punpckhdq(XMMREG a,R_M128 b){return x86(1071,a,b);}
-enc punpckhqdq(XMMREG a,XMMREG b){return x86(1072,a,b);}
-enc punpckhqdq(XMMREG a,MEM128 b){return x86(1072,a,b);}
-enc punpckhqdq(XMMREG a,R_M128 b){return x86(1072,a,b);}
-enc punpckhwd(MMREG a,MMREG b){return x86(1073,a,b);}
-enc punpckhwd(MMREG a,MEM64 b){return x86(1073,a,b);}
-enc punpckhwd(MMREG a,MM64 b){return x86(1073,a,b);}
-enc punpckhwd(XMMREG a,XMMREG b){return x86(1074,a,b);}
-enc punpckhwd(XMMREG a,MEM128 b){return x86(1074,a,b);}
-enc punpckhwd(XMMREG a,R_M128 b){return x86(1074,a,b);}
-enc punpcklbw(MMREG a,MMREG b){return x86(1075,a,b);}
-enc punpcklbw(MMREG a,MEM64 b){return x86(1075,a,b);}
-enc punpcklbw(MMREG a,MM64 b){return x86(1075,a,b);}
-enc punpcklbw(XMMREG a,XMMREG b){return x86(1076,a,b);}
-enc punpcklbw(XMMREG a,MEM128 b){return x86(1076,a,b);}
-enc punpcklbw(XMMREG a,R_M128 b){return x86(1076,a,b);}
-enc punpckldq(MMREG a,MMREG b){return x86(1077,a,b);}
-enc punpckldq(MMREG a,MEM64 b){return x86(1077,a,b);}
-enc punpckldq(MMREG a,MM64 b){return x86(1077,a,b);}
-enc punpckldq(XMMREG a,XMMREG b){return x86(1078,a,b);}
-enc punpckldq(XMMREG a,MEM128 b){return x86(1078,a,b);}
-enc punpckldq(XMMREG a,R_M128 b){return x86(1078,a,b);}
-enc punpcklqdq(XMMREG a,XMMREG b){return x86(1079,a,b);}
-enc punpcklqdq(XMMREG a,MEM128 b){return x86(1079,a,b);}
-enc punpcklqdq(XMMREG a,R_M128 b){return x86(1079,a,b);}
-enc punpcklwd(MMREG a,MMREG b){return x86(1080,a,b);}
-enc punpcklwd(MMREG a,MEM64 b){return x86(1080,a,b);}
-enc punpcklwd(MMREG a,MM64 b){return x86(1080,a,b);}
-enc punpcklwd(XMMREG a,XMMREG b){return x86(1081,a,b);}
-enc punpcklwd(XMMREG a,MEM128 b){return x86(1081,a,b);}
-enc punpcklwd(XMMREG a,R_M128 b){return x86(1081,a,b);}
-enc push(REG16 a){return x86(1082,a);}
-enc push(REG32 a){return x86(1083,a);}
-enc push(REG64 a){return x86(1084,a);}
-enc push(MEM16 a){return x86(1085,a);}
-enc push(R_M16 a){return x86(1085,a);}
-enc push(MEM32 a){return x86(1086,a);}
-enc push(R_M32 a){return x86(1086,a);}
-enc push(MEM64 a){return x86(1087,a);}
-enc push(R_M64 a){return x86(1087,a);}
-enc push(byte a){return x86(1088,(IMM)a);}
-enc push(word a){return x86(1089,(IMM)a);}
-enc push(REF a){return x86(1090,a);}
-enc push(dword a){return x86(1090,(IMM)a);}
-enc pusha(){return x86(1092);}
-enc pushad(){return x86(1093);}
-enc pushaw(){return x86(1094);}
-enc pushf(){return x86(1095);}
-enc pushfd(){return x86(1096);}
-enc pushfw(){return x86(1097);}
-enc pxor(MMREG a,MMREG b){return x86(1098,a,b);}
-enc pxor(MMREG a,MEM64 b){return x86(1098,a,b);}
-enc pxor(MMREG a,MM64 b){return x86(1098,a,b);}
-enc pxor(XMMREG a,XMMREG b){return x86(1099,a,b);}
-enc pxor(XMMREG a,MEM128 b){return x86(1099,a,b);}
-enc pxor(XMMREG a,R_M128 b){return x86(1099,a,b);}
-enc rcl(REG8 a,CL b){return x86(1101,a,b);}
-enc rcl(MEM8 a,CL b){return x86(1101,a,b);}
-enc rcl(R_M8 a,CL b){return x86(1101,a,b);}
-enc rcl(REG8 a,byte b){return x86(1102,a,(IMM)b);}
-enc rcl(AL a,byte b){return x86(1102,a,(IMM)b);}
-enc rcl(CL a,byte b){return x86(1102,a,(IMM)b);}
-enc rcl(MEM8 a,byte b){return x86(1102,a,(IMM)b);}
-enc rcl(R_M8 a,byte b){return x86(1102,a,(IMM)b);}
-enc rcl(REG16 a,CL b){return x86(1104,a,b);}
-enc rcl(MEM16 a,CL b){return x86(1104,a,b);}
-enc rcl(R_M16 a,CL b){return x86(1104,a,b);}
-enc rcl(REG16 a,byte b){return x86(1105,a,(IMM)b);}
-enc rcl(MEM16 a,byte b){return x86(1105,a,(IMM)b);}
-enc rcl(R_M16 a,byte b){return x86(1105,a,(IMM)b);}
-enc rcl(REG32 a,CL b){return x86(1107,a,b);}
-enc rcl(MEM32 a,CL b){return x86(1107,a,b);}
-enc rcl(R_M32 a,CL b){return x86(1107,a,b);}
-enc rcl(REG32 a,byte b){return x86(1108,a,(IMM)b);}
-enc rcl(MEM32 a,byte b){return x86(1108,a,(IMM)b);}
-enc rcl(R_M32 a,byte b){return x86(1108,a,(IMM)b);}
-enc rcl(REG64 a,CL b){return x86(1110,a,b);}
-enc rcl(MEM64 a,CL b){return x86(1110,a,b);}
-enc rcl(R_M64 a,CL b){return x86(1110,a,b);}
-enc rcl(REG64 a,byte b){return x86(1111,a,(IMM)b);}
-enc rcl(RAX a,byte b){return x86(1111,a,(IMM)b);}
-enc rcl(MEM64 a,byte b){return x86(1111,a,(IMM)b);}
-enc rcl(R_M64 a,byte b){return x86(1111,a,(IMM)b);}
-enc rcpps(XMMREG a,XMMREG b){return x86(1112,a,b);}
-enc rcpps(XMMREG a,MEM128 b){return x86(1112,a,b);}
-enc rcpps(XMMREG a,R_M128 b){return x86(1112,a,b);}
-enc rcpss(XMMREG a,XMMREG b){return x86(1113,a,b);}
-enc rcpss(XMMREG a,MEM32 b){return x86(1113,a,b);}
-enc rcpss(XMMREG a,XMM32 b){return x86(1113,a,b);}
-enc rcr(REG8 a,CL b){return x86(1115,a,b);}
-enc rcr(MEM8 a,CL b){return x86(1115,a,b);}
-enc rcr(R_M8 a,CL b){return x86(1115,a,b);}
-enc rcr(REG8 a,byte b){return x86(1116,a,(IMM)b);}
-enc rcr(AL a,byte b){return x86(1116,a,(IMM)b);}
-enc rcr(CL a,byte b){return x86(1116,a,(IMM)b);}
-enc rcr(MEM8 a,byte b){return x86(1116,a,(IMM)b);}
-enc rcr(R_M8 a,byte b){return x86(1116,a,(IMM)b);}
-enc rcr(REG16 a,CL b){return x86(1118,a,b);}
-enc rcr(MEM16 a,CL b){return x86(1118,a,b);}
-enc rcr(R_M16 a,CL b){return x86(1118,a,b);}
-enc rcr(REG16 a,byte b){return x86(1119,a,(IMM)b);}
-enc rcr(MEM16 a,byte b){return x86(1119,a,(IMM)b);}
-enc rcr(R_M16 a,byte b){return x86(1119,a,(IMM)b);}
-enc rcr(REG32 a,CL b){return x86(1121,a,b);}
-enc rcr(MEM32 a,CL b){return x86(1121,a,b);}
-enc rcr(R_M32 a,CL b){return x86(1121,a,b);}
-enc rcr(REG32 a,byte b){return x86(1122,a,(IMM)b);}
-enc rcr(MEM32 a,byte b){return x86(1122,a,(IMM)b);}
-enc rcr(R_M32 a,byte b){return x86(1122,a,(IMM)b);}
-enc rdmsr(){return x86(1126);}
-enc rdpmc(){return x86(1127);}
-enc rdtsc(){return x86(1128);}
-enc rep_insb(){return x86(1129);}
-enc rep_insd(){return x86(1130);}
-enc rep_insw(){return x86(1131);}
-enc rep_lodsb(){return x86(1132);}
-enc rep_lodsd(){return x86(1133);}
-enc rep_lodsw(){return x86(1134);}
-enc rep_movsb(){return x86(1135);}
-enc rep_movsd(){return x86(1136);}
-enc rep_movsw(){return x86(1137);}
-enc rep_outsb(){return x86(1138);}
-enc rep_outsd(){return x86(1139);}
-enc rep_outsw(){return x86(1140);}
-enc rep_scasb(){return x86(1141);}
-enc rep_scasd(){return x86(1142);}
-enc rep_scasw(){return x86(1143);}
-enc rep_stosb(){return x86(1144);}
-enc rep_stosd(){return x86(1145);}
-enc rep_stosw(){return x86(1146);}
-enc repe_cmpsb(){return x86(1147);}
-enc repe_cmpsd(){return x86(1148);}
-enc repe_cmpsw(){return x86(1149);}
-enc repe_scasb(){return x86(1150);}
-enc repe_scasd(){return x86(1151);}
-enc repe_scasw(){return x86(1152);}
-enc repne_cmpsb(){return x86(1153);}
-enc repne_cmpsd(){return x86(1154);}
-enc repne_cmpsw(){return x86(1155);}
-enc repne_scasb(){return x86(1156);}
-enc repne_scasd(){return x86(1157);}
-enc repne_scasw(){return x86(1158);}
-enc repnz_cmpsb(){return x86(1159);}
-enc repnz_cmpsd(){return x86(1160);}
-enc repnz_cmpsw(){return x86(1161);}
-enc repnz_scasb(){return x86(1162);}
-enc repnz_scasd(){return x86(1163);}
-enc repnz_scasw(){return x86(1164);}
-enc repz_cmpsb(){return x86(1165);}
-enc repz_cmpsd(){return x86(1166);}
-enc repz_cmpsw(){return x86(1167);}
-enc repz_scasb(){return x86(1168);}
-enc repz_scasd(){return x86(1169);}
-enc repz_scasw(){return x86(1170);}
-enc ret(){return x86(1171);}
-enc ret(byte a){return x86(1172,(IMM)a);}
-enc ret(word a){return x86(1172,(IMM)a);}
-enc rol(REG8 a,CL b){return x86(1174,a,b);}
-enc rol(MEM8 a,CL b){return x86(1174,a,b);}
-enc rol(R_M8 a,CL b){return x86(1174,a,b);}
-enc rol(REG8 a,byte b){return x86(1175,a,(IMM)b);}
-enc rol(AL a,byte b){return x86(1175,a,(IMM)b);}
-enc rol(CL a,byte b){return x86(1175,a,(IMM)b);}
-enc rol(MEM8 a,byte b){return x86(1175,a,(IMM)b);}
-enc rol(R_M8 a,byte b){return x86(1175,a,(IMM)b);}
-enc rol(REG16 a,CL b){return x86(1177,a,b);}
-enc rol(MEM16 a,CL b){return x86(1177,a,b);}
-enc rol(R_M16 a,CL b){return x86(1177,a,b);}
-enc rol(REG16 a,byte b){return x86(1178,a,(IMM)b);}
-enc rol(MEM16 a,byte b){return x86(1178,a,(IMM)b);}
-enc rol(R_M16 a,byte b){return x86(1178,a,(IMM)b);}
-enc rol(REG32 a,CL b){return x86(1180,a,b);}
-enc rol(MEM32 a,CL b){return x86(1180,a,b);}
-enc rol(R_M32 a,CL b){return x86(1180,a,b);}
-enc rol(REG32 a,byte b){return x86(1181,a,(IMM)b);}
-enc rol(MEM32 a,byte b){return x86(1181,a,(IMM)b);}
-enc rol(R_M32 a,byte b){return x86(1181,a,(IMM)b);}
-enc ror(REG8 a,CL b){return x86(1186,a,b);}
-enc ror(MEM8 a,CL b){return x86(1186,a,b);}
-enc ror(R_M8 a,CL b){return x86(1186,a,b);}
-enc ror(REG8 a,byte b){return x86(1187,a,(IMM)b);}
-enc ror(AL a,byte b){return x86(1187,a,(IMM)b);}
-enc ror(CL a,byte b){return x86(1187,a,(IMM)b);}
-enc ror(MEM8 a,byte b){return x86(1187,a,(IMM)b);}
-enc ror(R_M8 a,byte b){return x86(1187,a,(IMM)b);}
-enc ror(REG16 a,CL b){return x86(1189,a,b);}
-enc ror(MEM16 a,CL b){return x86(1189,a,b);}
-enc ror(R_M16 a,CL b){return x86(1189,a,b);}
-enc ror(REG16 a,byte b){return x86(1190,a,(IMM)b);}
-enc ror(MEM16 a,byte b){return x86(1190,a,(IMM)b);}
-enc ror(R_M16 a,byte b){return x86(1190,a,(IMM)b);}
-enc ror(REG32 a,CL b){return x86(1192,a,b);}
-enc ror(MEM32 a,CL b){return x86(1192,a,b);}
-enc ror(R_M32 a,CL b){return x86(1192,a,b);}
-enc ror(REG32 a,byte b){return x86(1193,a,(IMM)b);}
-enc ror(MEM32 a,byte b){return x86(1193,a,(IMM)b);}
-enc ror(R_M32 a,byte b){return x86(1193,a,(IMM)b);}
-enc ror(REG64 a,CL b){return x86(1195,a,b);}
-enc ror(MEM64 a,CL b){return x86(1195,a,b);}
-enc ror(R_M64 a,CL b){return x86(1195,a,b);}
-enc ror(REG64 a,byte b){return x86(1196,a,(IMM)b);}
-enc ror(RAX a,byte b){return x86(1196,a,(IMM)b);}
-enc ror(MEM64 a,byte b){return x86(1196,a,(IMM)b);}
-enc ror(R_M64 a,byte b){return x86(1196,a,(IMM)b);}
-enc rsm(){return x86(1197);}
-enc rsqrtps(XMMREG a,XMMREG b){return x86(1198,a,b);}
-enc rsqrtps(XMMREG a,MEM128 b){return x86(1198,a,b);}
-enc rsqrtps(XMMREG a,R_M128 b){return x86(1198,a,b);}
-enc rsqrtss(XMMREG a,XMMREG b){return x86(1199,a,b);}
-enc rsqrtss(XMMREG a,MEM32 b){return x86(1199,a,b);}
-enc rsqrtss(XMMREG a,XMM32 b){return x86(1199,a,b);}
-enc sahf(){return x86(1200);}
-enc sal(REG8 a,CL b){return x86(1202,a,b);}
-enc sal(MEM8 a,CL b){return x86(1202,a,b);}
-enc sal(R_M8 a,CL b){return x86(1202,a,b);}
-enc sal(REG8 a,byte b){return x86(1203,a,(IMM)b);}
-enc sal(AL a,byte b){return x86(1203,a,(IMM)b);}
-enc sal(CL a,byte b){return x86(1203,a,(IMM)b);}
-enc sal(MEM8 a,byte b){return x86(1203,a,(IMM)b);}
-enc sal(R_M8 a,byte b){return x86(1203,a,(IMM)b);}
-enc sal(REG16 a,CL b){return x86(1205,a,b);}
-enc sal(MEM16 a,CL b){return x86(1205,a,b);}
-enc sal(R_M16 a,CL b){return x86(1205,a,b);}
-enc sal(REG16 a,byte b){return x86(1206,a,(IMM)b);}
-enc sal(MEM16 a,byte b){return x86(1206,a,(IMM)b);}
-enc sal(R_M16 a,byte b){return x86(1206,a,(IMM)b);}
-enc sal(REG32 a,CL b){return x86(1208,a,b);}
-enc sal(MEM32 a,CL b){return x86(1208,a,b);}
-enc sal(R_M32 a,CL b){return x86(1208,a,b);}
-enc sal(REG32 a,byte b){return x86(1209,a,(IMM)b);}
-enc sal(MEM32 a,byte b){return x86(1209,a,(IMM)b);}
-enc sal(R_M32 a,byte b){return x86(1209,a,(IMM)b);}
-enc sal(REG64 a,CL b){return x86(1211,a,b);}
-enc sal(MEM64 a,CL b){return x86(1211,a,b);}
-enc sal(R_M64 a,CL b){return x86(1211,a,b);}
-enc sal(REG64 a,byte b){return x86(1212,a,(IMM)b);}
-enc sal(RAX a,byte b){return x86(1212,a,(IMM)b);}
-enc sal(MEM64 a,byte b){return x86(1212,a,(IMM)b);}
-enc sal(R_M64 a,byte b){return x86(1212,a,(IMM)b);}
-enc sar(REG8 a,CL b){return x86(1214,a,b);}
-enc sar(MEM8 a,CL b){return x86(1214,a,b);}
-enc sar(R_M8 a,CL b){return x86(1214,a,b);}
-enc sar(REG8 a,byte b){return x86(1215,a,(IMM)b);}
-enc sar(AL a,byte b){return x86(1215,a,(IMM)b);}
-enc sar(CL a,byte b){return x86(1215,a,(IMM)b);}
-enc sar(MEM8 a,byte b){return x86(1215,a,(IMM)b);}
-enc sar(R_M8 a,byte b){return x86(1215,a,(IMM)b);}
-enc sar(REG16 a,CL b){return x86(1217,a,b);}
-enc sar(MEM16 a,CL b){return x86(1217,a,b);}
-enc sar(R_M16 a,CL b){return x86(1217,a,b);}
-enc sar(REG16 a,byte b){return x86(1218,a,(IMM)b);}
-enc sar(MEM16 a,byte b){return x86(1218,a,(IMM)b);}
-enc sar(R_M16 a,byte b){return x86(1218,a,(IMM)b);}
-enc sar(REG32 a,CL b){return x86(1220,a,b);}
-enc sar(MEM32 a,CL b){return x86(1220,a,b);}
-enc sar(R_M32 a,CL b){return x86(1220,a,b);}
-enc sar(REG32 a,byte b){return x86(1221,a,(IMM)b);}
-enc sar(MEM32 a,byte b){return x86(1221,a,(IMM)b);}
-enc sar(R_M32 a,byte b){return x86(1221,a,(IMM)b);}
-enc sar(REG64 a,CL b){return x86(1223,a,b);}
-enc sar(MEM64 a,CL b){return x86(1223,a,b);}
-enc sar(R_M64 a,CL b){return x86(1223,a,b);}
-enc sar(REG64 a,byte b){return x86(1224,a,(IMM)b);}
-enc sar(RAX a,byte b){return x86(1224,a,(IMM)b);}
-enc sar(MEM64 a,byte b){return x86(1224,a,(IMM)b);}
-enc sar(R_M64 a,byte b){return x86(1224,a,(IMM)b);}
-enc sbb(REG8 a,REG8 b){return x86(1225,a,b);}
-enc sbb(MEM8 a,REG8 b){return x86(1225,a,b);}
-enc sbb(R_M8 a,REG8 b){return x86(1225,a,b);}
-enc sbb(REG16 a,REG16 b){return x86(1226,a,b);}
-enc sbb(MEM16 a,REG16 b){return x86(1226,a,b);}
-enc sbb(R_M16 a,REG16 b){return x86(1226,a,b);}
-enc sbb(REG32 a,REG32 b){return x86(1227,a,b);}
-enc sbb(MEM32 a,REG32 b){return x86(1227,a,b);}
-enc sbb(R_M32 a,REG32 b){return x86(1227,a,b);}
-enc sbb(REG64 a,REG64 b){return x86(1228,a,b);}
-enc sbb(MEM64 a,REG64 b){return x86(1228,a,b);}
-enc sbb(R_M64 a,REG64 b){return x86(1228,a,b);}
-enc sbb(REG8 a,MEM8 b){return x86(1229,a,b);}
-enc sbb(REG8 a,R_M8 b){return x86(1229,a,b);}
-enc sbb(REG16 a,MEM16 b){return x86(1230,a,b);}
-enc sbb(REG16 a,R_M16 b){return x86(1230,a,b);}
-enc sbb(REG32 a,MEM32 b){return x86(1231,a,b);}
-enc sbb(REG32 a,R_M32 b){return x86(1231,a,b);}
-enc sbb(REG64 a,MEM64 b){return x86(1232,a,b);}
-enc sbb(REG64 a,R_M64 b){return x86(1232,a,b);}
-enc sbb(REG8 a,byte b){return x86(1233,a,(IMM)b);}
-enc sbb(AL a,byte b){return x86(1233,a,(IMM)b);}
-enc sbb(CL a,byte b){return x86(1233,a,(IMM)b);}
-enc sbb(MEM8 a,byte b){return x86(1233,a,(IMM)b);}
-enc sbb(R_M8 a,byte b){return x86(1233,a,(IMM)b);}
-enc sbb(REG16 a,byte b){return x86(1234,a,(IMM)b);}
-enc sbb(REG16 a,word b){return x86(1234,a,(IMM)b);}
-enc sbb(MEM16 a,byte b){return x86(1234,a,(IMM)b);}
-enc sbb(MEM16 a,word b){return x86(1234,a,(IMM)b);}
-enc sbb(R_M16 a,byte b){return x86(1234,a,(IMM)b);}
-enc sbb(R_M16 a,word b){return x86(1234,a,(IMM)b);}
-enc sbb(REG32 a,REF b){return x86(1235,a,b);}
-enc sbb(REG32 a,dword b){return x86(1235,a,(IMM)b);}
-enc sbb(MEM32 a,REF b){return x86(1235,a,b);}
-enc sbb(MEM32 a,dword b){return x86(1235,a,(IMM)b);}
-enc sbb(R_M32 a,REF b){return x86(1235,a,b);}
-enc sbb(R_M32 a,dword b){return x86(1235,a,(IMM)b);}
-enc sbb(REG64 a,REF b){return x86(1236,a,b);}
-enc sbb(REG64 a,dword b){return x86(1236,a,(IMM)b);}
-enc sbb(MEM64 a,REF b){return x86(1236,a,b);}
-enc sbb(MEM64 a,dword b){return x86(1236,a,(IMM)b);}
-enc sbb(R_M64 a,REF b){return x86(1236,a,b);}
-enc sbb(R_M64 a,dword b){return x86(1236,a,(IMM)b);}
-enc scasb(){return x86(1244);}
-enc scasd(){return x86(1245);}
-enc scasq(){return x86(1246);}
-enc scasw(){return x86(1247);}
-enc seta(REG8 a){return x86(1248,a);}
-enc seta(MEM8 a){return x86(1248,a);}
-enc seta(R_M8 a){return x86(1248,a);}
-enc setae(REG8 a){return x86(1249,a);}
-enc setae(MEM8 a){return x86(1249,a);}
-enc setae(R_M8 a){return x86(1249,a);}
-enc setb(REG8 a){return x86(1250,a);}
-enc setb(MEM8 a){return x86(1250,a);}
-enc setb(R_M8 a){return x86(1250,a);}
-enc setbe(REG8 a){return x86(1251,a);}
-enc setbe(MEM8 a){return x86(1251,a);}
-enc setbe(R_M8 a){return x86(1251,a);}
-enc setc(REG8 a){return x86(1252,a);}
-enc setc(MEM8 a){return x86(1252,a);}
-enc setc(R_M8 a){return x86(1252,a);}
-enc sete(REG8 a){return x86(1253,a);}
-enc sete(MEM8 a){return x86(1253,a);}
-enc sete(R_M8 a){return x86(1253,a);}
-enc setg(REG8 a){return x86(1254,a);}
-enc setg(MEM8 a){return x86(1254,a);}
-enc setg(R_M8 a){return x86(1254,a);}
-enc setge(REG8 a){return x86(1255,a);}
-enc setge(MEM8 a){return x86(1255,a);}
-enc setge(R_M8 a){return x86(1255,a);}
-enc setl(REG8 a){return x86(1256,a);}
-enc setl(MEM8 a){return x86(1256,a);}
-enc setl(R_M8 a){return x86(1256,a);}
-enc setle(REG8 a){return x86(1257,a);}
-enc setle(MEM8 a){return x86(1257,a);}
-enc setle(R_M8 a){return x86(1257,a);}
-enc setna(REG8 a){return x86(1258,a);}
-enc setna(MEM8 a){return x86(1258,a);}
-enc setna(R_M8 a){return x86(1258,a);}
-enc setnb(REG8 a){return x86(1259,a);}
-enc setnb(MEM8 a){return x86(1259,a);}
-enc setnb(R_M8 a){return x86(1259,a);}
-enc setnbe(REG8 a){return x86(1260,a);}
-enc setnbe(MEM8 a){return x86(1260,a);}
-enc setnbe(R_M8 a){return x86(1260,a);}
-enc setnc(REG8 a){return x86(1261,a);}
-enc setnc(MEM8 a){return x86(1261,a);}
-enc setnc(R_M8 a){return x86(1261,a);}
-enc setne(REG8 a){return x86(1262,a);}
-enc setne(MEM8 a){return x86(1262,a);}
-enc setne(R_M8 a){return x86(1262,a);}
-enc setnea(REG8 a){return x86(1263,a);}
-enc setnea(MEM8 a){return x86(1263,a);}
-enc setnea(R_M8 a){return x86(1263,a);}
-enc setng(REG8 a){return x86(1264,a);}
-enc setng(MEM8 a){return x86(1264,a);}
-enc setng(R_M8 a){return x86(1264,a);}
-enc setnge(REG8 a){return x86(1265,a);}
-enc setnge(MEM8 a){return x86(1265,a);}
-enc setnge(R_M8 a){return x86(1265,a);}
-enc setnl(REG8 a){return x86(1266,a);}
-enc setnl(MEM8 a){return x86(1266,a);}
-enc setnl(R_M8 a){return x86(1266,a);}
-enc setnle(REG8 a){return x86(1267,a);}
-enc setnle(MEM8 a){return x86(1267,a);}
-enc setnle(R_M8 a){return x86(1267,a);}
-enc setno(REG8 a){return x86(1268,a);}
-enc setno(MEM8 a){return x86(1268,a);}
-enc setno(R_M8 a){return x86(1268,a);}
-enc setnp(REG8 a){return x86(1269,a);}
-enc setnp(MEM8 a){return x86(1269,a);}
-enc setnp(R_M8 a){return x86(1269,a);}
-enc setns(REG8 a){return x86(1270,a);}
-enc setns(MEM8 a){return x86(1270,a);}
-enc setns(R_M8 a){return x86(1270,a);}
-enc setnz(REG8 a){return x86(1271,a);}
-enc setnz(MEM8 a){return x86(1271,a);}
-enc setnz(R_M8 a){return x86(1271,a);}
-enc seto(REG8 a){return x86(1272,a);}
-enc seto(MEM8 a){return x86(1272,a);}
-enc seto(R_M8 a){return x86(1272,a);}
-enc setp(REG8 a){return x86(1273,a);}
-enc setp(MEM8 a){return x86(1273,a);}
-enc setp(R_M8 a){return x86(1273,a);}
-enc setpe(REG8 a){return x86(1274,a);}
-enc setpe(MEM8 a){return x86(1274,a);}
-enc setpe(R_M8 a){return x86(1274,a);}
-enc setpo(REG8 a){return x86(1275,a);}
-enc setpo(MEM8 a){return x86(1275,a);}
-enc setpo(R_M8 a){return x86(1275,a);}
-enc sets(REG8 a){return x86(1276,a);}
-enc sets(MEM8 a){return x86(1276,a);}
-enc sets(R_M8 a){return x86(1276,a);}
-enc setz(REG8 a){return x86(1277,a);}
-enc setz(MEM8 a){return x86(1277,a);}
-enc setz(R_M8 a){return x86(1277,a);}
-enc sfence(){return x86(1278);}
-enc shl(REG8 a,CL b){return x86(1280,a,b);}
-enc shl(MEM8 a,CL b){return x86(1280,a,b);}
-enc shl(R_M8 a,CL b){return x86(1280,a,b);}
-enc shl(REG8 a,byte b){return x86(1281,a,(IMM)b);}
-enc shl(AL a,byte b){return x86(1281,a,(IMM)b);}
-enc shl(CL a,byte b){return x86(1281,a,(IMM)b);}
-enc shl(MEM8 a,byte b){return x86(1281,a,(IMM)b);}
-enc shl(R_M8 a,byte b){return x86(1281,a,(IMM)b);}
-enc shl(REG16 a,CL b){return x86(1283,a,b);}
-enc shl(MEM16 a,CL b){return x86(1283,a,b);}
-enc shl(R_M16 a,CL b){return x86(1283,a,b);}
-enc shl(REG16 a,byte b){return x86(1284,a,(IMM)b);}
-enc shl(MEM16 a,byte b){return x86(1284,a,(IMM)b);}
-enc shl(R_M16 a,byte b){return x86(1284,a,(IMM)b);}
-enc shl(REG32 a,CL b){return x86(1286,a,b);}
-enc shl(MEM32 a,CL b){return x86(1286,a,b);}
-enc shl(R_M32 a,CL b){return x86(1286,a,b);}
-enc shl(REG32 a,byte b){return x86(1287,a,(IMM)b);}
-enc shl(MEM32 a,byte b){return x86(1287,a,(IMM)b);}
-enc shl(R_M32 a,byte b){return x86(1287,a,(IMM)b);}
-enc shl(REG64 a,CL b){return x86(1289,a,b);}
-enc shl(MEM64 a,CL b){return x86(1289,a,b);}
-enc shl(R_M64 a,CL b){return x86(1289,a,b);}
-enc shl(REG64 a,byte b){return x86(1290,a,(IMM)b);}
-enc shl(RAX a,byte b){return x86(1290,a,(IMM)b);}
-enc shl(MEM64 a,byte b){return x86(1290,a,(IMM)b);}
-enc shl(R_M64 a,byte b){return x86(1290,a,(IMM)b);}
-enc shld(REG16 a,REG16 b,byte c){return x86(1291,a,b,(IMM)c);}
-enc shld(REG16 a,AX b,byte c){return x86(1291,a,b,(IMM)c);}
-enc shld(REG16 a,DX b,byte c){return x86(1291,a,b,(IMM)c);}
-enc shld(REG16 a,CX b,byte c){return x86(1291,a,b,(IMM)c);}
-enc shld(AX a,REG16 b,byte c){return x86(1291,a,b,(IMM)c);}
-enc shld(DX a,REG16 b,byte c){return x86(1291,a,b,(IMM)c);}
-enc shld(CX a,REG16 b,byte c){return x86(1291,a,b,(IMM)c);}
-enc shld(MEM16 a,REG16 b,byte c){return x86(1291,a,b,(IMM)c);}
-enc shld(MEM16 a,AX b,byte c){return x86(1291,a,b,(IMM)c);}
-enc shld(MEM16 a,DX b,byte c){return x86(1291,a,b,(IMM)c);}
-enc shld(MEM16 a,CX b,byte c){return x86(1291,a,b,(IMM)c);}
-enc shld(R_M16 a,REG16 b,byte c){return x86(1291,a,b,(IMM)c);}
-enc shld(R_M16 a,AX b,byte c){return x86(1291,a,b,(IMM)c);}
-enc shld(R_M16 a,DX b,byte c){return x86(1291,a,b,(IMM)c);}
-enc shld(R_M16 a,CX b,byte c){return x86(1291,a,b,(IMM)c);}
-enc shld(REG32 a,REG32 b,byte c){return x86(1292,a,b,(IMM)c);}
-enc shld(REG32 a,EAX b,byte c){return x86(1292,a,b,(IMM)c);}
-enc shld(REG32 a,ECX b,byte c){return x86(1292,a,b,(IMM)c);}
-enc shld(EAX a,REG32 b,byte c){return x86(1292,a,b,(IMM)c);}
-enc shld(ECX a,REG32 b,byte c){return x86(1292,a,b,(IMM)c);}
-enc shld(MEM32 a,REG32 b,byte c){return x86(1292,a,b,(IMM)c);}
-enc shld(MEM32 a,EAX b,byte c){return x86(1292,a,b,(IMM)c);}
-enc shld(MEM32 a,ECX b,byte c){return x86(1292,a,b,(IMM)c);}
-enc shld(R_M32 a,REG32 b,byte c){return x86(1292,a,b,(IMM)c);}
-enc shld(R_M32 a,EAX b,byte c){return x86(1292,a,b,(IMM)c);}
-enc shld(R_M32 a,ECX b,byte c){return x86(1292,a,b,(IMM)c);}
-enc shld(REG64 a,REG64 b,byte c){return x86(1293,a,b,(IMM)c);}
-enc shld(REG64 a,RAX b,byte c){return x86(1293,a,b,(IMM)c);}
-enc shld(RAX a,REG64 b,byte c){return x86(1293,a,b,(IMM)c);}
-enc shld(MEM64 a,REG64 b,byte c){return x86(1293,a,b,(IMM)c);}
-enc shld(MEM64 a,RAX b,byte c){return x86(1293,a,b,(IMM)c);}
-enc shld(R_M64 a,REG64 b,byte c){return x86(1293,a,b,(IMM)c);}
-enc shld(R_M64 a,RAX b,byte c){return x86(1293,a,b,(IMM)c);}
-enc shld(REG16 a,REG16 b,CL c){return x86(1294,a,b,c);}
-enc shld(MEM16 a,REG16 b,CL c){return x86(1294,a,b,c);}
-enc shld(R_M16 a,REG16 b,CL c){return x86(1294,a,b,c);}
-enc shld(REG32 a,REG32 b,CL c){return x86(1295,a,b,c);}
-enc shld(MEM32 a,REG32 b,CL c){return x86(1295,a,b,c);}
-enc shld(R_M32 a,REG32 b,CL c){return x86(1295,a,b,c);}
-enc shld(REG64 a,REG64 b,CL c){return x86(1296,a,b,c);}
-enc shld(MEM64 a,REG64 b,CL c){return x86(1296,a,b,c);}
-enc shld(R_M64 a,REG64 b,CL c){return x86(1296,a,b,c);}
-enc shr(REG8 a,CL b){return x86(1298,a,b);}
-enc shr(MEM8 a,CL b){return x86(1298,a,b);}
-enc shr(R_M8 a,CL b){return x86(1298,a,b);}
-enc shr(REG8 a,byte b){return x86(1299,a,(IMM)b);}
-enc shr(AL a,byte b){return x86(1299,a,(IMM)b);}
-enc shr(CL a,byte b){return x86(1299,a,(IMM)b);}
-enc shr(MEM8 a,byte b){return x86(1299,a,(IMM)b);}
-enc shr(R_M8 a,byte b){return x86(1299,a,(IMM)b);}
-enc shr(REG16 a,CL b){return x86(1301,a,b);}
-enc shr(MEM16 a,CL b){return x86(1301,a,b);}
-enc shr(R_M16 a,CL b){return x86(1301,a,b);}
-enc shr(REG16 a,byte b){return x86(1302,a,(IMM)b);}
-enc shr(MEM16 a,byte b){return x86(1302,a,(IMM)b);}
-enc shr(R_M16 a,byte b){return x86(1302,a,(IMM)b);}
-enc shr(REG32 a,CL b){return x86(1304,a,b);}
-enc shr(MEM32 a,CL b){return x86(1304,a,b);}
-enc shr(R_M32 a,CL b){return x86(1304,a,b);}
-enc shr(REG32 a,byte b){return x86(1305,a,(IMM)b);}
-enc shr(MEM32 a,byte b){return x86(1305,a,(IMM)b);}
-enc shr(R_M32 a,byte b){return x86(1305,a,(IMM)b);}
-enc shr(REG64 a,CL b){return x86(1307,a,b);}
-enc shr(MEM64 a,CL b){return x86(1307,a,b);}
-enc shr(R_M64 a,CL b){return x86(1307,a,b);}
-enc shr(REG64 a,byte b){return x86(1308,a,(IMM)b);}
-enc shr(RAX a,byte b){return x86(1308,a,(IMM)b);}
-enc shr(MEM64 a,byte b){return x86(1308,a,(IMM)b);}
-enc shr(R_M64 a,byte b){return x86(1308,a,(IMM)b);}
-enc shrd(REG16 a,REG16 b,byte c){return x86(1309,a,b,(IMM)c);}
-enc shrd(REG16 a,AX b,byte c){return x86(1309,a,b,(IMM)c);}
-enc shrd(REG16 a,DX b,byte c){return x86(1309,a,b,(IMM)c);}
-enc shrd(REG16 a,CX b,byte c){return x86(1309,a,b,(IMM)c);}
-enc shrd(AX a,REG16 b,byte c){return x86(1309,a,b,(IMM)c);}
-enc shrd(DX a,REG16 b,byte c){return x86(1309,a,b,(IMM)c);}
-enc shrd(CX a,REG16 b,byte c){return x86(1309,a,b,(IMM)c);}
-enc shrd(MEM16 a,REG16 b,byte c){return x86(1309,a,b,(IMM)c);}
-enc shrd(MEM16 a,AX b,byte c){return x86(1309,a,b,(IMM)c);}
-enc shrd(MEM16 a,DX b,byte c){return x86(1309,a,b,(IMM)c);}
-enc shrd(MEM16 a,CX b,byte c){return x86(1309,a,b,(IMM)c);}
-enc shrd(R_M16 a,REG16 b,byte c){return x86(1309,a,b,(IMM)c);}
-enc shrd(R_M16 a,AX b,byte c){return x86(1309,a,b,(IMM)c);}
-enc shrd(R_M16 a,DX b,byte c){return x86(1309,a,b,(IMM)c);}
-enc shrd(R_M16 a,CX b,byte c){return x86(1309,a,b,(IMM)c);}
-enc shrd(REG32 a,REG32 b,byte c){return x86(1310,a,b,(IMM)c);}
-enc shrd(REG32 a,EAX b,byte c){return x86(1310,a,b,(IMM)c);}
-enc shrd(REG32 a,ECX b,byte c){return x86(1310,a,b,(IMM)c);}
-enc shrd(EAX a,REG32 b,byte c){return x86(1310,a,b,(IMM)c);}
-enc shrd(ECX a,REG32 b,byte c){return x86(1310,a,b,(IMM)c);}
-enc shrd(MEM32 a,REG32 b,byte c){return x86(1310,a,b,(IMM)c);}
-enc shrd(MEM32 a,EAX b,byte c){return x86(1310,a,b,(IMM)c);}
-enc shrd(MEM32 a,ECX b,byte c){return x86(1310,a,b,(IMM)c);}
-enc shrd(R_M32 a,REG32 b,byte c){return x86(1310,a,b,(IMM)c);}
-enc shrd(R_M32 a,EAX b,byte c){return x86(1310,a,b,(IMM)c);}
-enc shrd(R_M32 a,ECX b,byte c){return x86(1310,a,b,(IMM)c);}
-enc shrd(REG64 a,REG64 b,byte c){return x86(1311,a,b,(IMM)c);}
-enc shrd(REG64 a,RAX b,byte c){return x86(1311,a,b,(IMM)c);}
-enc shrd(RAX a,REG64 b,byte c){return x86(1311,a,b,(IMM)c);}
-enc shrd(MEM64 a,REG64 b,byte c){return x86(1311,a,b,(IMM)c);}
-enc shrd(MEM64 a,RAX b,byte c){return x86(1311,a,b,(IMM)c);}
-enc shrd(R_M64 a,REG64 b,byte c){return x86(1311,a,b,(IMM)c);}
-enc shrd(R_M64 a,RAX b,byte c){return x86(1311,a,b,(IMM)c);}
-enc shrd(REG16 a,REG16 b,CL c){return x86(1312,a,b,c);}
-enc shrd(MEM16 a,REG16 b,CL c){return x86(1312,a,b,c);}
-enc shrd(R_M16 a,REG16 b,CL c){return x86(1312,a,b,c);}
-enc shrd(REG32 a,REG32 b,CL c){return x86(1313,a,b,c);}
-enc shrd(MEM32 a,REG32 b,CL c){return x86(1313,a,b,c);}
-enc shrd(R_M32 a,REG32 b,CL c){return x86(1313,a,b,c);}
-enc shrd(REG64 a,REG64 b,CL c){return x86(1314,a,b,c);}
-enc shrd(MEM64 a,REG64 b,CL c){return x86(1314,a,b,c);}
-enc shrd(R_M64 a,REG64 b,CL c){return x86(1314,a,b,c);}
-enc shufpd(XMMREG a,XMMREG b,byte c){return x86(1315,a,b,(IMM)c);}
-enc shufpd(XMMREG a,MEM128 b,byte c){return x86(1315,a,b,(IMM)c);}
-enc shufpd(XMMREG a,R_M128 b,byte c){return x86(1315,a,b,(IMM)c);}
-enc shufps(XMMREG a,XMMREG b,byte c){return x86(1316,a,b,(IMM)c);}
-enc shufps(XMMREG a,MEM128 b,byte c){return x86(1316,a,b,(IMM)c);}
-enc shufps(XMMREG a,R_M128 b,byte c){return x86(1316,a,b,(IMM)c);}
-enc smint(){return x86(1317);}
-enc smintold(){return x86(1318);}
-enc sqrtpd(XMMREG a,XMMREG b){return x86(1319,a,b);}
-enc sqrtpd(XMMREG a,MEM128 b){return x86(1319,a,b);}
-enc sqrtpd(XMMREG a,R_M128 b){return x86(1319,a,b);}
-enc sqrtps(XMMREG a,XMMREG b){return x86(1320,a,b);}
-enc sqrtps(XMMREG a,MEM128 b){return x86(1320,a,b);}
-enc sqrtps(XMMREG a,R_M128 b){return x86(1320,a,b);}
-enc sqrtsd(XMMREG a,XMMREG b){return x86(1321,a,b);}
-enc sqrtsd(XMMREG a,MEM64 b){return x86(1321,a,b);}
-enc sqrtsd(XMMREG a,XMM64 b){return x86(1321,a,b);}
-enc sqrtss(XMMREG a,XMMREG b){return x86(1322,a,b);}
-enc sqrtss(XMMREG a,MEM32 b){return x86(1322,a,b);}
-enc sqrtss(XMMREG a,XMM32 b){return x86(1322,a,b);}
-enc stc(){return x86(1323);}
-enc std(){return x86(1324);}
-enc sti(){return x86(1325);}
-enc stmxcsr(MEM32 a){return x86(1326,a);}
-enc stosb(){return x86(1327);}
-enc stosd(){return x86(1328);}
-enc stosq(){return x86(1329);}
-enc stosw(){return x86(1330);}
-enc sub(REG8 a,REG8 b){return x86(1331,a,b);}
-enc sub(MEM8 a,REG8 b){return x86(1331,a,b);}
-enc sub(R_M8 a,REG8 b){return x86(1331,a,b);}
-enc sub(REG16 a,REG16 b){return x86(1332,a,b);}
-enc sub(MEM16 a,REG16 b){return x86(1332,a,b);}
-enc sub(R_M16 a,REG16 b){return x86(1332,a,b);}
-enc sub(REG32 a,REG32 b){return x86(1333,a,b);}
-enc sub(MEM32 a,REG32 b){return x86(1333,a,b);}
-enc sub(R_M32 a,REG32 b){return x86(1333,a,b);}
-enc sub(REG64 a,REG64 b){return x86(1334,a,b);}
-enc sub(MEM64 a,REG64 b){return x86(1334,a,b);}
-enc sub(R_M64 a,REG64 b){return x86(1334,a,b);}
-enc sub(REG8 a,MEM8 b){return x86(1335,a,b);}
-enc sub(REG8 a,R_M8 b){return x86(1335,a,b);}
-enc sub(REG16 a,MEM16 b){return x86(1336,a,b);}
-enc sub(REG16 a,R_M16 b){return x86(1336,a,b);}
-enc sub(REG32 a,MEM32 b){return x86(1337,a,b);}
-enc sub(REG32 a,R_M32 b){return x86(1337,a,b);}
-enc sub(REG64 a,MEM64 b){return x86(1338,a,b);}
-enc sub(REG64 a,R_M64 b){return x86(1338,a,b);}
-enc sub(REG8 a,byte b){return x86(1339,a,(IMM)b);}
-enc sub(AL a,byte b){return x86(1339,a,(IMM)b);}
-enc sub(CL a,byte b){return x86(1339,a,(IMM)b);}
-enc sub(MEM8 a,byte b){return x86(1339,a,(IMM)b);}
-enc sub(R_M8 a,byte b){return x86(1339,a,(IMM)b);}
-enc sub(REG16 a,byte b){return x86(1340,a,(IMM)b);}
-enc sub(REG16 a,word b){return x86(1340,a,(IMM)b);}
-enc sub(MEM16 a,byte b){return x86(1340,a,(IMM)b);}
-enc sub(MEM16 a,word b){return x86(1340,a,(IMM)b);}
-enc sub(R_M16 a,byte b){return x86(1340,a,(IMM)b);}
-enc sub(R_M16 a,word b){return x86(1340,a,(IMM)b);}
-enc sub(REG32 a,REF b){return x86(1341,a,b);}
-enc sub(REG32 a,dword b){return x86(1341,a,(IMM)b);}
-enc sub(MEM32 a,REF b){return x86(1341,a,b);}
-enc sub(MEM32 a,dword b){return x86(1341,a,(IMM)b);}
-enc sub(R_M32 a,REF b){return x86(1341,a,b);}
-enc sub(R_M32 a,dword b){return x86(1341,a,(IMM)b);}
-enc sub(REG64 a,REF b){return x86(1342,a,b);}
-enc sub(REG64 a,dword b){return x86(1342,a,(IMM)b);}
-enc sub(MEM64 a,REF b){return x86(1342,a,b);}
-enc sub(MEM64 a,dword b){return x86(1342,a,(IMM)b);}
-enc sub(R_M64 a,REF b){return x86(1342,a,b);}
-enc sub(R_M64 a,dword b){return x86(1342,a,(IMM)b);}
-enc subpd(XMMREG a,XMMREG b){return x86(1350,a,b);}
-enc subpd(XMMREG a,MEM128 b){return x86(1350,a,b);}
-enc subpd(XMMREG a,R_M128 b){return x86(1350,a,b);}
-enc subps(XMMREG a,XMMREG b){return x86(1351,a,b);}
-enc subps(XMMREG a,MEM128 b){return x86(1351,a,b);}
-enc subps(XMMREG a,R_M128 b){return x86(1351,a,b);}
-enc subsd(XMMREG a,XMMREG b){return x86(1352,a,b);}
-enc subsd(XMMREG a,MEM64 b){return x86(1352,a,b);}
-enc subsd(XMMREG a,XMM64 b){return x86(1352,a,b);}
-enc subss(XMMREG a,XMMREG b){return x86(1353,a,b);}
-enc subss(XMMREG a,MEM32 b){return x86(1353,a,b);}
-enc subss(XMMREG a,XMM32 b){return x86(1353,a,b);}
-enc sysenter(){return x86(1354);}
-enc test(REG8 a,REG8 b){return x86(1355,a,b);}
-enc test(MEM8 a,REG8 b){return x86(1355,a,b);}
-enc test(R_M8 a,REG8 b){return x86(1355,a,b);}
-enc test(REG16 a,REG16 b){return x86(1356,a,b);}
-enc test(MEM16 a,REG16 b){return x86(1356,a,b);}
-enc test(R_M16 a,REG16 b){return x86(1356,a,b);}
-enc test(REG32 a,REG32 b){return x86(1357,a,b);}
-enc test(MEM32 a,REG32 b){return x86(1357,a,b);}
-enc test(R_M32 a,REG32 b){return x86(1357,a,b);}
-enc test(REG64 a,REG64 b){return x86(1358,a,b);}
-enc test(MEM64 a,REG64 b){return x86(1358,a,b);}
-enc test(R_M64 a,REG64 b){return x86(1358,a,b);}
-enc test(REG8 a,byte b){return x86(1359,a,(IMM)b);}
-enc test(AL a,byte b){return x86(1359,a,(IMM)b);}
-enc test(CL a,byte b){return x86(1359,a,(IMM)b);}
-enc test(MEM8 a,byte b){return x86(1359,a,(IMM)b);}
-enc test(R_M8 a,byte b){return x86(1359,a,(IMM)b);}
-enc test(REG16 a,byte b){return x86(1360,a,(IMM)b);}
-enc test(REG16 a,word b){return x86(1360,a,(IMM)b);}
-enc test(MEM16 a,byte b){return x86(1360,a,(IMM)b);}
-enc test(MEM16 a,word b){return x86(1360,a,(IMM)b);}
-enc test(R_M16 a,byte b){return x86(1360,a,(IMM)b);}
-enc test(R_M16 a,word b){return x86(1360,a,(IMM)b);}
-enc test(REG32 a,REF b){return x86(1361,a,b);}
-enc test(REG32 a,dword b){return x86(1361,a,(IMM)b);}
-enc test(MEM32 a,REF b){return x86(1361,a,b);}
-enc test(MEM32 a,dword b){return x86(1361,a,(IMM)b);}
-enc test(R_M32 a,REF b){return x86(1361,a,b);}
-enc test(R_M32 a,dword b){return x86(1361,a,(IMM)b);}
-enc test(REG64 a,REF b){return x86(1362,a,b);}
-enc test(REG64 a,dword b){return x86(1362,a,(IMM)b);}
-enc test(MEM64 a,REF b){return x86(1362,a,b);}
-enc test(MEM64 a,dword b){return x86(1362,a,(IMM)b);}
-enc test(R_M64 a,REF b){return x86(1362,a,b);}
-enc test(R_M64 a,dword b){return x86(1362,a,(IMM)b);}
-enc ucomisd(XMMREG a,XMMREG b){return x86(1367,a,b);}
-enc ucomisd(XMMREG a,MEM64 b){return x86(1367,a,b);}
-enc ucomisd(XMMREG a,XMM64 b){return x86(1367,a,b);}
-enc ucomiss(XMMREG a,XMMREG b){return x86(1368,a,b);}
-enc ucomiss(XMMREG a,MEM32 b){return x86(1368,a,b);}
-enc ucomiss(XMMREG a,XMM32 b){return x86(1368,a,b);}
-enc ud2(){return x86(1369);}
-enc unpckhpd(XMMREG a,XMMREG b){return x86(1370,a,b);}
-enc unpckhpd(XMMREG a,MEM128 b){return x86(1370,a,b);}
-enc unpckhpd(XMMREG a,R_M128 b){return x86(1370,a,b);}
-enc unpckhps(XMMREG a,XMMREG b){return x86(1371,a,b);}
-enc unpckhps(XMMREG a,MEM128 b){return x86(1371,a,b);}
-enc unpckhps(XMMREG a,R_M128 b){return x86(1371,a,b);}
-enc unpcklpd(XMMREG a,XMMREG b){return x86(1372,a,b);}
-enc unpcklpd(XMMREG a,MEM128 b){return x86(1372,a,b);}
-enc unpcklpd(XMMREG a,R_M128 b){return x86(1372,a,b);}
-enc unpcklps(XMMREG a,XMMREG b){return x86(1373,a,b);}
-enc unpcklps(XMMREG a,MEM128 b){return x86(1373,a,b);}
-enc unpcklps(XMMREG a,R_M128 b){return x86(1373,a,b);}
-enc wait(){return x86(1374);}
-enc wrmsr(){return x86(1375);}
-enc xadd(REG8 a,REG8 b){return x86(1376,a,b);}
-enc xadd(MEM8 a,REG8 b){return x86(1376,a,b);}
-enc xadd(R_M8 a,REG8 b){return x86(1376,a,b);}
-enc xadd(REG16 a,REG16 b){return x86(1377,a,b);}
-enc xadd(MEM16 a,REG16 b){return x86(1377,a,b);}
-enc xadd(R_M16 a,REG16 b){return x86(1377,a,b);}
-enc xadd(REG32 a,REG32 b){return x86(1378,a,b);}
-enc xadd(MEM32 a,REG32 b){return x86(1378,a,b);}
-enc xadd(R_M32 a,REG32 b){return x86(1378,a,b);}
-enc xadd(REG64 a,REG64 b){return x86(1379,a,b);}
-enc xadd(MEM64 a,REG64 b){return x86(1379,a,b);}
-enc xadd(R_M64 a,REG64 b){return x86(1379,a,b);}
-enc xchg(REG8 a,REG8 b){return x86(1380,a,b);}
-enc xchg(REG8 a,MEM8 b){return x86(1380,a,b);}
-enc xchg(REG8 a,R_M8 b){return x86(1380,a,b);}
-enc xchg(REG16 a,REG16 b){return x86(1381,a,b);}
-enc xchg(REG16 a,MEM16 b){return x86(1381,a,b);}
-enc xchg(REG16 a,R_M16 b){return x86(1381,a,b);}
-enc xchg(REG32 a,REG32 b){return x86(1382,a,b);}
-enc xchg(REG32 a,MEM32 b){return x86(1382,a,b);}
-enc xchg(REG32 a,R_M32 b){return x86(1382,a,b);}
-enc xchg(REG64 a,REG64 b){return x86(1383,a,b);}
-enc xchg(REG64 a,MEM64 b){return x86(1383,a,b);}
-enc xchg(REG64 a,R_M64 b){return x86(1383,a,b);}
-enc xchg(MEM8 a,REG8 b){return x86(1384,a,b);}
-enc xchg(R_M8 a,REG8 b){return x86(1384,a,b);}
-enc xchg(MEM16 a,REG16 b){return x86(1385,a,b);}
-enc xchg(R_M16 a,REG16 b){return x86(1385,a,b);}
-enc xchg(MEM32 a,REG32 b){return x86(1386,a,b);}
-enc xchg(R_M32 a,REG32 b){return x86(1386,a,b);}
-enc xchg(MEM64 a,REG64 b){return x86(1387,a,b);}
-enc xchg(R_M64 a,REG64 b){return x86(1387,a,b);}
-enc xlatb(){return x86(1394);}
-enc xor(REG8 a,REG8 b){return x86(1395,a,b);}
-enc xor(MEM8 a,REG8 b){return x86(1395,a,b);}
-enc xor(R_M8 a,REG8 b){return x86(1395,a,b);}
-enc xor(REG16 a,REG16 b){return x86(1396,a,b);}
-enc xor(MEM16 a,REG16 b){return x86(1396,a,b);}
-enc xor(R_M16 a,REG16 b){return x86(1396,a,b);}
-enc xor(REG32 a,REG32 b){return x86(1397,a,b);}
-enc xor(MEM32 a,REG32 b){return x86(1397,a,b);}
-enc xor(R_M32 a,REG32 b){return x86(1397,a,b);}
-enc xor(REG64 a,REG64 b){return x86(1398,a,b);}
-enc xor(MEM64 a,REG64 b){return x86(1398,a,b);}
-enc xor(R_M64 a,REG64 b){return x86(1398,a,b);}
-enc xor(REG8 a,MEM8 b){return x86(1399,a,b);}
-enc xor(REG8 a,R_M8 b){return x86(1399,a,b);}
-enc xor(REG16 a,MEM16 b){return x86(1400,a,b);}
-enc xor(REG16 a,R_M16 b){return x86(1400,a,b);}
-enc xor(REG32 a,MEM32 b){return x86(1401,a,b);}
-enc xor(REG32 a,R_M32 b){return x86(1401,a,b);}
-enc xor(REG64 a,MEM64 b){return x86(1402,a,b);}
-enc xor(REG64 a,R_M64 b){return x86(1402,a,b);}
-enc xor(REG8 a,byte b){return x86(1403,a,(IMM)b);}
-enc xor(AL a,byte b){return x86(1403,a,(IMM)b);}
-enc xor(CL a,byte b){return x86(1403,a,(IMM)b);}
-enc xor(MEM8 a,byte b){return x86(1403,a,(IMM)b);}
-enc xor(R_M8 a,byte b){return x86(1403,a,(IMM)b);}
-enc xor(REG16 a,byte b){return x86(1404,a,(IMM)b);}
-enc xor(REG16 a,word b){return x86(1404,a,(IMM)b);}
-enc xor(MEM16 a,byte b){return x86(1404,a,(IMM)b);}
-enc xor(MEM16 a,word b){return x86(1404,a,(IMM)b);}
-enc xor(R_M16 a,byte b){return x86(1404,a,(IMM)b);}
-enc xor(R_M16 a,word b){return x86(1404,a,(IMM)b);}
-enc xor(REG32 a,REF b){return x86(1405,a,b);}
-enc xor(REG32 a,dword b){return x86(1405,a,(IMM)b);}
-enc xor(MEM32 a,REF b){return x86(1405,a,b);}
-enc xor(MEM32 a,dword b){return x86(1405,a,(IMM)b);}
-enc xor(R_M32 a,REF b){return x86(1405,a,b);}
-enc xor(R_M32 a,dword b){return x86(1405,a,(IMM)b);}
-enc xor(REG64 a,REF b){return x86(1406,a,b);}
-enc xor(REG64 a,dword b){return x86(1406,a,(IMM)b);}
-enc xor(MEM64 a,REF b){return x86(1406,a,b);}
-enc xor(MEM64 a,dword b){return x86(1406,a,(IMM)b);}
-enc xor(R_M64 a,REF b){return x86(1406,a,b);}
-enc xor(R_M64 a,dword b){return x86(1406,a,(IMM)b);}
-enc xorps(XMMREG a,XMMREG b){return x86(1414,a,b);}
-enc xorps(XMMREG a,MEM128 b){return x86(1414,a,b);}
-enc xorps(XMMREG a,R_M128 b){return x86(1414,a,b);}
+enc mov(REG64 a,IMM64 b){return x86(769,a,b);}
+enc mov(MEM8 a,byte b){return x86(770,a,(IMM)b);}
+enc mov(R_M8 a,byte b){return x86(770,a,(IMM)b);}
+enc mov(MEM16 a,byte b){return x86(771,a,(IMM)b);}
+enc mov(MEM16 a,word b){return x86(771,a,(IMM)b);}
+enc mov(R_M16 a,byte b){return x86(771,a,(IMM)b);}
+enc mov(R_M16 a,word b){return x86(771,a,(IMM)b);}
+enc mov(MEM32 a,REF b){return x86(772,a,b);}
+enc mov(MEM32 a,dword b){return x86(772,a,(IMM)b);}
+enc mov(R_M32 a,REF b){return x86(772,a,b);}
+enc mov(R_M32 a,dword b){return x86(772,a,(IMM)b);}
+enc mov(REG64 a,REF b){return x86(773,a,b);}
+enc mov(REG64 a,dword b){return x86(773,a,(IMM)b);}
+enc mov(MEM64 a,REF b){return x86(773,a,b);}
+enc mov(MEM64 a,dword b){return x86(773,a,(IMM)b);}
+enc mov(R_M64 a,REF b){return x86(773,a,b);}
+enc mov(R_M64 a,dword b){return x86(773,a,(IMM)b);}
+enc movapd(XMMREG a,XMMREG b){return x86(774,a,b);}
+enc movapd(XMMREG a,MEM128 b){return x86(774,a,b);}
+enc movapd(XMMREG a,R_M128 b){return x86(774,a,b);}
+enc movapd(MEM128 a,XMMREG b){return x86(775,a,b);}
+enc movapd(R_M128 a,XMMREG b){return x86(775,a,b);}
+enc movaps(XMMREG a,XMMREG b){return x86(776,a,b);}
+enc movaps(XMMREG a,MEM128 b){return x86(776,a,b);}
+enc movaps(XMMREG a,R_M128 b){return x86(776,a,b);}
+enc movaps(MEM128 a,XMMREG b){return x86(777,a,b);}
+enc movaps(R_M128 a,XMMREG b){return x86(777,a,b);}
+enc movd(MMREG a,REG32 b){return x86(778,a,b);}
+enc movd(MMREG a,MEM32 b){return x86(778,a,b);}
+enc movd(MMREG a,R_M32 b){return x86(778,a,b);}
+enc movd(MMREG a,REG64 b){return x86(779,a,b);}
+enc movd(MMREG a,MEM64 b){return x86(779,a,b);}
+enc movd(MMREG a,R_M64 b){return x86(779,a,b);}
+enc movd(REG32 a,MMREG b){return x86(780,a,b);}
+enc movd(MEM32 a,MMREG b){return x86(780,a,b);}
+enc movd(R_M32 a,MMREG b){return x86(780,a,b);}
+enc movd(REG64 a,MMREG b){return x86(781,a,b);}
+enc movd(MEM64 a,MMREG b){return x86(781,a,b);}
+enc movd(R_M64 a,MMREG b){return x86(781,a,b);}
+enc movd(XMMREG a,REG32 b){return x86(782,a,b);}
+enc movd(XMMREG a,MEM32 b){return x86(782,a,b);}
+enc movd(XMMREG a,R_M32 b){return x86(782,a,b);}
+enc movd(XMMREG a,REG64 b){return x86(783,a,b);}
+enc movd(XMMREG a,MEM64 b){return x86(783,a,b);}
+enc movd(XMMREG a,R_M64 b){return x86(783,a,b);}
+enc movd(REG32 a,XMMREG b){return x86(784,a,b);}
+enc movd(MEM32 a,XMMREG b){return x86(784,a,b);}
+enc movd(R_M32 a,XMMREG b){return x86(784,a,b);}
+enc movd(REG64 a,XMMREG b){return x86(785,a,b);}
+enc movd(MEM64 a,XMMREG b){return x86(785,a,b);}
+enc movd(R_M64 a,XMMREG b){return x86(785,a,b);}
+enc movddup(XMMREG a,XMMREG b){return x86(786,a,b);}
+enc movddup(XMMREG a,MEM128 b){return x86(786,a,b);}
+enc movddup(XMMREG a,R_M128 b){return x86(786,a,b);}
+enc movdq2q(MMREG a,XMMREG b){return x86(787,a,b);}
+enc movdqa(XMMREG a,XMMREG b){return x86(788,a,b);}
+enc movdqa(XMMREG a,MEM128 b){return x86(788,a,b);}
+enc movdqa(XMMREG a,R_M128 b){return x86(788,a,b);}
+enc movdqa(MEM128 a,XMMREG b){return x86(789,a,b);}
+enc movdqa(R_M128 a,XMMREG b){return x86(789,a,b);}
+enc movdqu(XMMREG a,XMMREG b){return x86(790,a,b);}
+enc movdqu(XMMREG a,MEM128 b){return x86(790,a,b);}
+enc movdqu(XMMREG a,R_M128 b){return x86(790,a,b);}
+enc movdqu(MEM128 a,XMMREG b){return x86(791,a,b);}
+enc movdqu(R_M128 a,XMMREG b){return x86(791,a,b);}
+enc movhlps(XMMREG a,XMMREG b){return x86(792,a,b);}
+enc movhpd(XMMREG a,MEM64 b){return x86(793,a,b);}
+enc movhpd(MEM64 a,XMMREG b){return x86(794,a,b);}
+enc movhps(XMMREG a,MEM64 b){return x86(795,a,b);}
+enc movhps(MEM64 a,XMMREG b){return x86(796,a,b);}
+enc movhps(XMMREG a,XMMREG b){return x86(797,a,b);}
+enc movlhps(XMMREG a,XMMREG b){return x86(798,a,b);}
+enc movlpd(XMMREG a,MEM64 b){return x86(799,a,b);}
+enc movlpd(MEM64 a,XMMREG b){return x86(800,a,b);}
+enc movlps(XMMREG a,MEM64 b){return x86(801,a,b);}
+enc movlps(MEM64 a,XMMREG b){return x86(802,a,b);}
+enc movmskpd(REG32 a,XMMREG b){return x86(803,a,b);}
+enc movmskps(REG32 a,XMMREG b){return x86(804,a,b);}
+enc movntdq(MEM128 a,XMMREG b){return x86(805,a,b);}
+enc movnti(MEM32 a,REG32 b){return x86(806,a,b);}
+enc movnti(MEM64 a,REG64 b){return x86(807,a,b);}
+enc movntpd(MEM128 a,XMMREG b){return x86(808,a,b);}
+enc movntps(MEM128 a,XMMREG b){return x86(809,a,b);}
+enc movntq(MEM64 a,MMREG b){return x86(810,a,b);}
+enc movq(MMREG a,MMREG b){return x86(811,a,b);}
+enc movq(MMREG a,MEM64 b){return x86(811,a,b);}
+enc movq(MMREG a,MM64 b){return x86(811,a,b);}
+enc movq(MEM64 a,MMREG b){return x86(812,a,b);}
+enc movq(MM64 a,MMREG b){return x86(812,a,b);}
+enc movq(XMMREG a,XMMREG b){return x86(813,a,b);}
+enc movq(XMMREG a,MEM64 b){return x86(813,a,b);}
+enc movq(XMMREG a,XMM64 b){return x86(813,a,b);}
+enc movq(MEM64 a,XMMREG b){return x86(814,a,b);}
+enc movq(XMM64 a,XMMREG b){return x86(814,a,b);}
+enc movq2dq(XMMREG a,MMREG b){return x86(815,a,b);}
+enc movsb(){return x86(816);}
+enc movsd(){return x86(817);}
+enc movsd(XMMREG a,XMMREG b){return x86(818,a,b);}
+enc movsd(XMMREG a,MEM64 b){return x86(818,a,b);}
+enc movsd(XMMREG a,XMM64 b){return x86(818,a,b);}
+enc movsd(MEM64 a,XMMREG b){return x86(819,a,b);}
+enc movsd(XMM64 a,XMMREG b){return x86(819,a,b);}
+enc movshdup(XMMREG a,XMMREG b){return x86(820,a,b);}
+enc movshdup(XMMREG a,MEM128 b){return x86(820,a,b);}
+enc movshdup(XMMREG a,R_M128 b){return x86(820,a,b);}
+enc movsldup(XMMREG a,XMMREG b){return x86(821,a,b);}
+enc movsldup(XMMREG a,MEM128 b){return x86(821,a,b);}
+enc movsldup(XMMREG a,R_M128 b){return x86(821,a,b);}
+enc movsq(){return x86(822);}
+enc movss(XMMREG a,XMMREG b){return x86(823,a,b);}
+enc movss(XMMREG a,MEM32 b){return x86(823,a,b);}
+enc movss(XMMREG a,XMM32 b){return x86(823,a,b);}
+enc movss(MEM32 a,XMMREG b){return x86(824,a,b);}
+enc movss(XMM32 a,XMMREG b){return x86(824,a,b);}
+enc movsw(){return x86(825);}
+enc movsx(REG16 a,REG8 b){return x86(826,a,b);}
+enc movsx(REG16 a,MEM8 b){return x86(826,a,b);}
+enc movsx(REG16 a,R_M8 b){return x86(826,a,b);}
+enc movsx(REG32 a,REG8 b){return x86(827,a,b);}
+enc movsx(REG32 a,MEM8 b){return x86(827,a,b);}
+enc movsx(REG32 a,R_M8 b){return x86(827,a,b);}
+enc movsx(REG64 a,REG8 b){return x86(828,a,b);}
+enc movsx(REG64 a,MEM8 b){return x86(828,a,b);}
+enc movsx(REG64 a,R_M8 b){return x86(828,a,b);}
+enc movsx(REG32 a,REG16 b){return x86(829,a,b);}
+enc movsx(REG32 a,MEM16 b){return x86(829,a,b);}
+enc movsx(REG32 a,R_M16 b){return x86(829,a,b);}
+enc movsx(REG64 a,REG16 b){return x86(830,a,b);}
+enc movsx(REG64 a,MEM16 b){return x86(830,a,b);}
+enc movsx(REG64 a,R_M16 b){return x86(830,a,b);}
+enc movsxd(REG64 a,REG32 b){return x86(831,a,b);}
+enc movsxd(REG64 a,MEM32 b){return x86(831,a,b);}
+enc movsxd(REG64 a,R_M32 b){return x86(831,a,b);}
+enc movupd(XMMREG a,XMMREG b){return x86(832,a,b);}
+enc movupd(XMMREG a,MEM128 b){return x86(832,a,b);}
+enc movupd(XMMREG a,R_M128 b){return x86(832,a,b);}
+enc movupd(MEM128 a,XMMREG b){return x86(833,a,b);}
+enc movupd(R_M128 a,XMMREG b){return x86(833,a,b);}
+enc movups(XMMREG a,XMMREG b){return x86(834,a,b);}
+enc movups(XMMREG a,MEM128 b){return x86(834,a,b);}
+enc movups(XMMREG a,R_M128 b){return x86(834,a,b);}
+enc movups(MEM128 a,XMMREG b){return x86(835,a,b);}
+enc movups(R_M128 a,XMMREG b){return x86(835,a,b);}
+enc movzx(REG16 a,REG8 b){return x86(836,a,b);}
+enc movzx(REG16 a,MEM8 b){return x86(836,a,b);}
+enc movzx(REG16 a,R_M8 b){return x86(836,a,b);}
+enc movzx(REG32 a,REG8 b){return x86(837,a,b);}
+enc movzx(REG32 a,MEM8 b){return x86(837,a,b);}
+enc movzx(REG32 a,R_M8 b){return x86(837,a,b);}
+enc movzx(REG64 a,REG8 b){return x86(838,a,b);}
+enc movzx(REG64 a,MEM8 b){return x86(838,a,b);}
+enc movzx(REG64 a,R_M8 b){return x86(838,a,b);}
+enc movzx(REG32 a,REG16 b){return x86(839,a,b);}
+enc movzx(REG32 a,MEM16 b){return x86(839,a,b);}
+enc movzx(REG32 a,R_M16 b){return x86(839,a,b);}
+enc movzx(REG64 a,REG16 b){return x86(840,a,b);}
+enc movzx(REG64 a,MEM16 b){return x86(840,a,b);}
+enc movzx(REG64 a,R_M16 b){return x86(840,a,b);}
+enc mul(REG8 a){return x86(841,a);}
+enc mul(MEM8 a){return x86(841,a);}
+enc mul(R_M8 a){return x86(841,a);}
+enc mul(REG16 a){return x86(842,a);}
+enc mul(MEM16 a){return x86(842,a);}
+enc mul(R_M16 a){return x86(842,a);}
+enc mul(REG32 a){return x86(843,a);}
+enc mul(MEM32 a){return x86(843,a);}
+enc mul(R_M32 a){return x86(843,a);}
+enc mul(REG64 a){return x86(844,a);}
+enc mul(MEM64 a){return x86(844,a);}
+enc mul(R_M64 a){return x86(844,a);}
+enc mulpd(XMMREG a,XMMREG b){return x86(845,a,b);}
+enc mulpd(XMMREG a,MEM128 b){return x86(845,a,b);}
+enc mulpd(XMMREG a,R_M128 b){return x86(845,a,b);}
+enc mulps(XMMREG a,XMMREG b){return x86(846,a,b);}
+enc mulps(XMMREG a,MEM128 b){return x86(846,a,b);}
+enc mulps(XMMREG a,R_M128 b){return x86(846,a,b);}
+enc mulsd(XMMREG a,XMMREG b){return x86(847,a,b);}
+enc mulsd(XMMREG a,MEM64 b){return x86(847,a,b);}
+enc mulsd(XMMREG a,XMM64 b){return x86(847,a,b);}
+enc mulss(XMMREG a,XMMREG b){return x86(848,a,b);}
+enc mulss(XMMREG a,MEM32 b){return x86(848,a,b);}
+enc mulss(XMMREG a,XMM32 b){return x86(848,a,b);}
+enc mwait(){return x86(849);}
+enc neg(REG8 a){return x86(850,a);}
+enc neg(MEM8 a){return x86(850,a);}
+enc neg(R_M8 a){return x86(850,a);}
+enc neg(REG16 a){return x86(851,a);}
+enc neg(MEM16 a){return x86(851,a);}
+enc neg(R_M16 a){return x86(851,a);}
+enc neg(REG32 a){return x86(852,a);}
+enc neg(MEM32 a){return x86(852,a);}
+enc neg(R_M32 a){return x86(852,a);}
+enc neg(REG64 a){return x86(853,a);}
+enc neg(MEM64 a){return x86(853,a);}
+enc neg(R_M64 a){return x86(853,a);}
+enc nop(){return x86(854);}
+enc not(REG8 a){return x86(855,a);}
+enc not(MEM8 a){return x86(855,a);}
+enc not(R_M8 a){return x86(855,a);}
+enc not(REG16 a){return x86(856,a);}
+enc not(MEM16 a){return x86(856,a);}
+enc not(R_M16 a){return x86(856,a);}
+enc not(REG32 a){return x86(857,a);}
+enc not(MEM32 a){return x86(857,a);}
+enc not(R_M32 a){return x86(857,a);}
+enc not(REG64 a){return x86(858,a);}
+enc not(MEM64 a){return x86(858,a);}
+enc not(R_M64 a){return x86(858,a);}
+enc null(){return x86(859);}
+enc or(REG8 a,REG8 b){return x86(860,a,b);}
+enc or(MEM8 a,REG8 b){return x86(860,a,b);}
+enc or(R_M8 a,REG8 b){return x86(860,a,b);}
+enc or(REG16 a,REG16 b){return x86(861,a,b);}
+enc or(MEM16 a,REG16 b){return x86(861,a,b);}
+enc or(R_M16 a,REG16 b){return x86(861,a,b);}
+enc or(REG32 a,REG32 b){return x86(862,a,b);}
+enc or(MEM32 a,REG32 b){return x86(862,a,b);}
+enc or(R_M32 a,REG32 b){return x86(862,a,b);}
+enc or(REG64 a,REG64 b){return x86(863,a,b);}
+enc or(MEM64 a,REG64 b){return x86(863,a,b);}
+enc or(R_M64 a,REG64 b){return x86(863,a,b);}
+enc or(REG8 a,MEM8 b){return x86(864,a,b);}
+enc or(REG8 a,R_M8 b){return x86(864,a,b);}
+enc or(REG16 a,MEM16 b){return x86(865,a,b);}
+enc or(REG16 a,R_M16 b){return x86(865,a,b);}
+enc or(REG32 a,MEM32 b){return x86(866,a,b);}
+enc or(REG32 a,R_M32 b){return x86(866,a,b);}
+enc or(REG64 a,MEM64 b){return x86(867,a,b);}
+enc or(REG64 a,R_M64 b){return x86(867,a,b);}
+enc or(REG8 a,byte b){return x86(868,a,(IMM)b);}
+enc or(AL a,byte b){return x86(868,a,(IMM)b);}
+enc or(CL a,byte b){return x86(868,a,(IMM)b);}
+enc or(MEM8 a,byte b){return x86(868,a,(IMM)b);}
+enc or(R_M8 a,byte b){return x86(868,a,(IMM)b);}
+enc or(REG16 a,byte b){return x86(869,a,(IMM)b);}
+enc or(REG16 a,word b){return x86(869,a,(IMM)b);}
+enc or(MEM16 a,byte b){return x86(869,a,(IMM)b);}
+enc or(MEM16 a,word b){return x86(869,a,(IMM)b);}
+enc or(R_M16 a,byte b){return x86(869,a,(IMM)b);}
+enc or(R_M16 a,word b){return x86(869,a,(IMM)b);}
+enc or(REG32 a,REF b){return x86(870,a,b);}
+enc or(REG32 a,dword b){return x86(870,a,(IMM)b);}
+enc or(MEM32 a,REF b){return x86(870,a,b);}
+enc or(MEM32 a,dword b){return x86(870,a,(IMM)b);}
+enc or(R_M32 a,REF b){return x86(870,a,b);}
+enc or(R_M32 a,dword b){return x86(870,a,(IMM)b);}
+enc or(REG64 a,REF b){return x86(871,a,b);}
+enc or(REG64 a,dword b){return x86(871,a,(IMM)b);}
+enc or(MEM64 a,REF b){return x86(871,a,b);}
+enc or(MEM64 a,dword b){return x86(871,a,(IMM)b);}
+enc or(R_M64 a,REF b){return x86(871,a,b);}
+enc or(R_M64 a,dword b){return x86(871,a,(IMM)b);}
+enc orpd(XMMREG a,XMMREG b){return x86(879,a,b);}
+enc orpd(XMMREG a,MEM128 b){return x86(879,a,b);}
+enc orpd(XMMREG a,R_M128 b){return x86(879,a,b);}
+enc orps(XMMREG a,XMMREG b){return x86(880,a,b);}
+enc orps(XMMREG a,MEM128 b){return x86(880,a,b);}
+enc orps(XMMREG a,R_M128 b){return x86(880,a,b);}
+enc out(byte a,AL b){return x86(881,(IMM)a,b);}
+enc out(byte a,AX b){return x86(882,(IMM)a,b);}
+enc out(byte a,EAX b){return x86(883,(IMM)a,b);}
+enc out(DX a,AL b){return x86(884,a,b);}
+enc out(DX a,AX b){return x86(885,a,b);}
+enc out(DX a,EAX b){return x86(886,a,b);}
+enc outsb(){return x86(887);}
+enc outsd(){return x86(888);}
+enc outsw(){return x86(889);}
+enc packssdw(MMREG a,MMREG b){return x86(890,a,b);}
+enc packssdw(MMREG a,MEM64 b){return x86(890,a,b);}
+enc packssdw(MMREG a,MM64 b){return x86(890,a,b);}
+enc packssdw(XMMREG a,XMMREG b){return x86(891,a,b);}
+enc packssdw(XMMREG a,MEM128 b){return x86(891,a,b);}
+enc packssdw(XMMREG a,R_M128 b){return x86(891,a,b);}
+enc packsswb(MMREG a,MMREG b){return x86(892,a,b);}
+enc packsswb(MMREG a,MEM64 b){return x86(892,a,b);}
+enc packsswb(MMREG a,MM64 b){return x86(892,a,b);}
+enc packsswb(XMMREG a,XMMREG b){return x86(893,a,b);}
+enc packsswb(XMMREG a,MEM128 b){return x86(893,a,b);}
+enc packsswb(XMMREG a,R_M128 b){return x86(893,a,b);}
+enc packuswb(MMREG a,MMREG b){return x86(894,a,b);}
+enc packuswb(MMREG a,MEM64 b){return x86(894,a,b);}
+enc packuswb(MMREG a,MM64 b){return x86(894,a,b);}
+enc packuswb(XMMREG a,XMMREG b){return x86(895,a,b);}
+enc packuswb(XMMREG a,MEM128 b){return x86(895,a,b);}
+enc packuswb(XMMREG a,R_M128 b){return x86(895,a,b);}
+enc paddb(MMREG a,MMREG b){return x86(896,a,b);}
+enc paddb(MMREG a,MEM64 b){return x86(896,a,b);}
+enc paddb(MMREG a,MM64 b){return x86(896,a,b);}
+enc paddb(XMMREG a,XMMREG b){return x86(897,a,b);}
+enc paddb(XMMREG a,MEM128 b){return x86(897,a,b);}
+enc paddb(XMMREG a,R_M128 b){return x86(897,a,b);}
+enc paddd(MMREG a,MMREG b){return x86(898,a,b);}
+enc paddd(MMREG a,MEM64 b){return x86(898,a,b);}
+enc paddd(MMREG a,MM64 b){return x86(898,a,b);}
+enc paddd(XMMREG a,XMMREG b){return x86(899,a,b);}
+enc paddd(XMMREG a,MEM128 b){return x86(899,a,b);}
+enc paddd(XMMREG a,R_M128 b){return x86(899,a,b);}
+enc paddq(MMREG a,MMREG b){return x86(900,a,b);}
+enc paddq(MMREG a,MEM64 b){return x86(900,a,b);}
+enc paddq(MMREG a,MM64 b){return x86(900,a,b);}
+enc paddq(XMMREG a,XMMREG b){return x86(901,a,b);}
+enc paddq(XMMREG a,MEM128 b){return x86(901,a,b);}
+enc paddq(XMMREG a,R_M128 b){return x86(901,a,b);}
+enc paddsb(MMREG a,MMREG b){return x86(902,a,b);}
+enc paddsb(MMREG a,MEM64 b){return x86(902,a,b);}
+enc paddsb(MMREG a,MM64 b){return x86(902,a,b);}
+enc paddsb(XMMREG a,XMMREG b){return x86(903,a,b);}
+enc paddsb(XMMREG a,MEM128 b){return x86(903,a,b);}
+enc paddsb(XMMREG a,R_M128 b){return x86(903,a,b);}
+enc paddsiw(MMREG a,MMREG b){return x86(904,a,b);}
+enc paddsiw(MMREG a,MEM64 b){return x86(904,a,b);}
+enc paddsiw(MMREG a,MM64 b){return x86(904,a,b);}
+enc paddsw(MMREG a,MMREG b){return x86(905,a,b);}
+enc paddsw(MMREG a,MEM64 b){return x86(905,a,b);}
+enc paddsw(MMREG a,MM64 b){return x86(905,a,b);}
+enc paddsw(XMMREG a,XMMREG b){return x86(906,a,b);}
+enc paddsw(XMMREG a,MEM128 b){return x86(906,a,b);}
+enc paddsw(XMMREG a,R_M128 b){return x86(906,a,b);}
+enc paddusb(MMREG a,MMREG b){return x86(907,a,b);}
+enc paddusb(MMREG a,MEM64 b){return x86(907,a,b);}
+enc paddusb(MMREG a,MM64 b){return x86(907,a,b);}
+enc paddusb(XMMREG a,XMMREG b){return x86(908,a,b);}
+enc paddusb(XMMREG a,MEM128 b){return x86(908,a,b);}
+enc paddusb(XMMREG a,R_M128 b){return x86(908,a,b);}
+enc paddusw(MMREG a,MMREG b){return x86(909,a,b);}
+enc paddusw(MMREG a,MEM64 b){return x86(909,a,b);}
+enc paddusw(MMREG a,MM64 b){return x86(909,a,b);}
+enc paddusw(XMMREG a,XMMREG b){return x86(910,a,b);}
+enc paddusw(XMMREG a,MEM128 b){return x86(910,a,b);}
+enc paddusw(XMMREG a,R_M128 b){return x86(910,a,b);}
+enc paddw(MMREG a,MMREG b){return x86(911,a,b);}
+enc paddw(MMREG a,MEM64 b){return x86(911,a,b);}
+enc paddw(MMREG a,MM64 b){return x86(911,a,b);}
+enc paddw(XMMREG a,XMMREG b){return x86(912,a,b);}
+enc paddw(XMMREG a,MEM128 b){return x86(912,a,b);}
+enc paddw(XMMREG a,R_M128 b){return x86(912,a,b);}
+enc pand(MMREG a,MMREG b){return x86(913,a,b);}
+enc pand(MMREG a,MEM64 b){return x86(913,a,b);}
+enc pand(MMREG a,MM64 b){return x86(913,a,b);}
+enc pand(XMMREG a,XMMREG b){return x86(914,a,b);}
+enc pand(XMMREG a,MEM128 b){return x86(914,a,b);}
+enc pand(XMMREG a,R_M128 b){return x86(914,a,b);}
+enc pandn(MMREG a,MMREG b){return x86(915,a,b);}
+enc pandn(MMREG a,MEM64 b){return x86(915,a,b);}
+enc pandn(MMREG a,MM64 b){return x86(915,a,b);}
+enc pandn(XMMREG a,XMMREG b){return x86(916,a,b);}
+enc pandn(XMMREG a,MEM128 b){return x86(916,a,b);}
+enc pandn(XMMREG a,R_M128 b){return x86(916,a,b);}
+enc pause(){return x86(917);}
+enc paveb(MMREG a,MMREG b){return x86(918,a,b);}
+enc paveb(MMREG a,MEM64 b){return x86(918,a,b);}
+enc paveb(MMREG a,MM64 b){return x86(918,a,b);}
+enc pavgb(MMREG a,MMREG b){return x86(919,a,b);}
+enc pavgb(MMREG a,MEM64 b){return x86(919,a,b);}
+enc pavgb(MMREG a,MM64 b){return x86(919,a,b);}
+enc pavgb(XMMREG a,XMMREG b){return x86(920,a,b);}
+enc pavgb(XMMREG a,MEM128 b){return x86(920,a,b);}
+enc pavgb(XMMREG a,R_M128 b){return x86(920,a,b);}
+enc pavgusb(MMREG a,MMREG b){return x86(921,a,b);}
+enc pavgusb(MMREG a,MEM64 b){return x86(921,a,b);}
+enc pavgusb(MMREG a,MM64 b){return x86(921,a,b);}
+enc pavgw(MMREG a,MMREG b){return x86(922,a,b);}
+enc pavgw(MMREG a,MEM64 b){return x86(922,a,b);}
+enc pavgw(MMREG a,MM64 b){return x86(922,a,b);}
+enc pavgw(XMMREG a,XMMREG b){return x86(923,a,b);}
+enc pavgw(XMMREG a,MEM128 b){return x86(923,a,b);}
+enc pavgw(XMMREG a,R_M128 b){return x86(923,a,b);}
+enc pcmpeqb(MMREG a,MMREG b){return x86(924,a,b);}
+enc pcmpeqb(MMREG a,MEM64 b){return x86(924,a,b);}
+enc pcmpeqb(MMREG a,MM64 b){return x86(924,a,b);}
+enc pcmpeqb(XMMREG a,XMMREG b){return x86(925,a,b);}
+enc pcmpeqb(XMMREG a,MEM128 b){return x86(925,a,b);}
+enc pcmpeqb(XMMREG a,R_M128 b){return x86(925,a,b);}
+enc pcmpeqd(MMREG a,MMREG b){return x86(926,a,b);}
+enc pcmpeqd(MMREG a,MEM64 b){return x86(926,a,b);}
+enc pcmpeqd(MMREG a,MM64 b){return x86(926,a,b);}
+enc pcmpeqd(XMMREG a,XMMREG b){return x86(927,a,b);}
+enc pcmpeqd(XMMREG a,MEM128 b){return x86(927,a,b);}
+enc pcmpeqd(XMMREG a,R_M128 b){return x86(927,a,b);}
+enc pcmpeqw(MMREG a,MMREG b){return x86(928,a,b);}
+enc pcmpeqw(MMREG a,MEM64 b){return x86(928,a,b);}
+enc pcmpeqw(MMREG a,MM64 b){return x86(928,a,b);}
+enc pcmpeqw(XMMREG a,XMMREG b){return x86(929,a,b);}
+enc pcmpeqw(XMMREG a,MEM128 b){return x86(929,a,b);}
+enc pcmpeqw(XMMREG a,R_M128 b){return x86(929,a,b);}
+enc pcmpgtb(MMREG a,MMREG b){return x86(930,a,b);}
+enc pcmpgtb(MMREG a,MEM64 b){return x86(930,a,b);}
+enc pcmpgtb(MMREG a,MM64 b){return x86(930,a,b);}
+enc pcmpgtb(XMMREG a,XMMREG b){return x86(931,a,b);}
+enc pcmpgtb(XMMREG a,MEM128 b){return x86(931,a,b);}
+enc pcmpgtb(XMMREG a,R_M128 b){return x86(931,a,b);}
+enc pcmpgtd(MMREG a,MMREG b){return x86(932,a,b);}
+enc pcmpgtd(MMREG a,MEM64 b){return x86(932,a,b);}
+enc pcmpgtd(MMREG a,MM64 b){return x86(932,a,b);}
+enc pcmpgtd(XMMREG a,XMMREG b){return x86(933,a,b);}
+enc pcmpgtd(XMMREG a,MEM128 b){return x86(933,a,b);}
+enc pcmpgtd(XMMREG a,R_M128 b){return x86(933,a,b);}
+enc pcmpgtw(MMREG a,MMREG b){return x86(934,a,b);}
+enc pcmpgtw(MMREG a,MEM64 b){return x86(934,a,b);}
+enc pcmpgtw(MMREG a,MM64 b){return x86(934,a,b);}
+enc pcmpgtw(XMMREG a,XMMREG b){return x86(935,a,b);}
+enc pcmpgtw(XMMREG a,MEM128 b){return x86(935,a,b);}
+enc pcmpgtw(XMMREG a,R_M128 b){return x86(935,a,b);}
+enc pdistib(MMREG a,MEM64 b){return x86(936,a,b);}
+enc pextrw(REG32 a,MMREG b,byte c){return x86(937,a,b,(IMM)c);}
+enc pextrw(EAX a,MMREG b,byte c){return x86(937,a,b,(IMM)c);}
+enc pextrw(ECX a,MMREG b,byte c){return x86(937,a,b,(IMM)c);}
+enc pextrw(REG32 a,XMMREG b,byte c){return x86(938,a,b,(IMM)c);}
+enc pextrw(EAX a,XMMREG b,byte c){return x86(938,a,b,(IMM)c);}
+enc pextrw(ECX a,XMMREG b,byte c){return x86(938,a,b,(IMM)c);}
+enc pf2id(MMREG a,MMREG b){return x86(939,a,b);}
+enc pf2id(MMREG a,MEM64 b){return x86(939,a,b);}
+enc pf2id(MMREG a,MM64 b){return x86(939,a,b);}
+enc pf2iw(MMREG a,MMREG b){return x86(940,a,b);}
+enc pf2iw(MMREG a,MEM64 b){return x86(940,a,b);}
+enc pf2iw(MMREG a,MM64 b){return x86(940,a,b);}
+enc pfacc(MMREG a,MMREG b){return x86(941,a,b);}
+enc pfacc(MMREG a,MEM64 b){return x86(941,a,b);}
+enc pfacc(MMREG a,MM64 b){return x86(941,a,b);}
+enc pfadd(MMREG a,MMREG b){return x86(942,a,b);}
+enc pfadd(MMREG a,MEM64 b){return x86(942,a,b);}
+enc pfadd(MMREG a,MM64 b){return x86(942,a,b);}
+enc pfcmpeq(MMREG a,MMREG b){return x86(943,a,b);}
+enc pfcmpeq(MMREG a,MEM64 b){return x86(943,a,b);}
+enc pfcmpeq(MMREG a,MM64 b){return x86(943,a,b);}
+enc pfcmpge(MMREG a,MMREG b){return x86(944,a,b);}
+enc pfcmpge(MMREG a,MEM64 b){return x86(944,a,b);}
+enc pfcmpge(MMREG a,MM64 b){return x86(944,a,b);}
+enc pfcmpgt(MMREG a,MMREG b){return x86(945,a,b);}
+enc pfcmpgt(MMREG a,MEM64 b){return x86(945,a,b);}
+enc pfcmpgt(MMREG a,MM64 b){return x86(945,a,b);}
+enc pfmax(MMREG a,MMREG b){return x86(946,a,b);}
+enc pfmax(MMREG a,MEM64 b){return x86(946,a,b);}
+enc pfmax(MMREG a,MM64 b){return x86(946,a,b);}
+enc pfmin(MMREG a,MMREG b){return x86(947,a,b);}
+enc pfmin(MMREG a,MEM64 b){return x86(947,a,b);}
+enc pfmin(MMREG a,MM64 b){return x86(947,a,b);}
+enc pfmul(MMREG a,MMREG b){return x86(948,a,b);}
+enc pfmul(MMREG a,MEM64 b){return x86(948,a,b);}
+enc pfmul(MMREG a,MM64 b){return x86(948,a,b);}
+enc pfnacc(MMREG a,MMREG b){return x86(949,a,b);}
+enc pfnacc(MMREG a,MEM64 b){return x86(949,a,b);}
+enc pfnacc(MMREG a,MM64 b){return x86(949,a,b);}
+enc pfpnacc(MMREG a,MMREG b){return x86(950,a,b);}
+enc pfpnacc(MMREG a,MEM64 b){return x86(950,a,b);}
+enc pfpnacc(MMREG a,MM64 b){return x86(950,a,b);}
+enc pfrcp(MMREG a,MMREG b){return x86(951,a,b);}
+enc pfrcp(MMREG a,MEM64 b){return x86(951,a,b);}
+enc pfrcp(MMREG a,MM64 b){return x86(951,a,b);}
+enc pfrcpit1(MMREG a,MMREG b){return x86(952,a,b);}
+enc pfrcpit1(MMREG a,MEM64 b){return x86(952,a,b);}
+enc pfrcpit1(MMREG a,MM64 b){return x86(952,a,b);}
+enc pfrcpit2(MMREG a,MMREG b){return x86(953,a,b);}
+enc pfrcpit2(MMREG a,MEM64 b){return x86(953,a,b);}
+enc pfrcpit2(MMREG a,MM64 b){return x86(953,a,b);}
+enc pfrsqit1(MMREG a,MMREG b){return x86(954,a,b);}
+enc pfrsqit1(MMREG a,MEM64 b){return x86(954,a,b);}
+enc pfrsqit1(MMREG a,MM64 b){return x86(954,a,b);}
+enc pfrsqrt(MMREG a,MMREG b){return x86(955,a,b);}
+enc pfrsqrt(MMREG a,MEM64 b){return x86(955,a,b);}
+enc pfrsqrt(MMREG a,MM64 b){return x86(955,a,b);}
+enc pfsub(MMREG a,MMREG b){return x86(956,a,b);}
+enc pfsub(MMREG a,MEM64 b){return x86(956,a,b);}
+enc pfsub(MMREG a,MM64 b){return x86(956,a,b);}
+enc pfsubr(MMREG a,MMREG b){return x86(957,a,b);}
+enc pfsubr(MMREG a,MEM64 b){return x86(957,a,b);}
+enc pfsubr(MMREG a,MM64 b){return x86(957,a,b);}
+enc pi2fd(MMREG a,MMREG b){return x86(958,a,b);}
+enc pi2fd(MMREG a,MEM64 b){return x86(958,a,b);}
+enc pi2fd(MMREG a,MM64 b){return x86(958,a,b);}
+enc pi2fw(MMREG a,MMREG b){return x86(959,a,b);}
+enc pi2fw(MMREG a,MEM64 b){return x86(959,a,b);}
+enc pi2fw(MMREG a,MM64 b){return x86(959,a,b);}
+enc pinsrw(MMREG a,REG16 b,byte c){return x86(960,a,b,(IMM)c);}
+enc pinsrw(MMREG a,AX b,byte c){return x86(960,a,b,(IMM)c);}
+enc pinsrw(MMREG a,DX b,byte c){return x86(960,a,b,(IMM)c);}
+enc pinsrw(MMREG a,CX b,byte c){return x86(960,a,b,(IMM)c);}
+enc pinsrw(MMREG a,MEM16 b,byte c){return x86(960,a,b,(IMM)c);}
+enc pinsrw(MMREG a,R_M16 b,byte c){return x86(960,a,b,(IMM)c);}
+enc pinsrw(XMMREG a,REG16 b,byte c){return x86(961,a,b,(IMM)c);}
+enc pinsrw(XMMREG a,AX b,byte c){return x86(961,a,b,(IMM)c);}
+enc pinsrw(XMMREG a,DX b,byte c){return x86(961,a,b,(IMM)c);}
+enc pinsrw(XMMREG a,CX b,byte c){return x86(961,a,b,(IMM)c);}
+enc pinsrw(XMMREG a,MEM16 b,byte c){return x86(961,a,b,(IMM)c);}
+enc pinsrw(XMMREG a,R_M16 b,byte c){return x86(961,a,b,(IMM)c);}
+enc pmachriw(MMREG a,MEM64 b){return x86(962,a,b);}
+enc pmaddwd(MMREG a,MMREG b){return x86(963,a,b);}
+enc pmaddwd(MMREG a,MEM64 b){return x86(963,a,b);}
+enc pmaddwd(MMREG a,MM64 b){return x86(963,a,b);}
+enc pmaddwd(XMMREG a,XMMREG b){return x86(964,a,b);}
+enc pmaddwd(XMMREG a,MEM128 b){return x86(964,a,b);}
+enc pmaddwd(XMMREG a,R_M128 b){return x86(964,a,b);}
+enc pmagw(MMREG a,MMREG b){return x86(965,a,b);}
+enc pmagw(MMREG a,MEM64 b){return x86(965,a,b);}
+enc pmagw(MMREG a,MM64 b){return x86(965,a,b);}
+enc pmaxsw(XMMREG a,XMMREG b){return x86(966,a,b);}
+enc pmaxsw(XMMREG a,MEM128 b){return x86(966,a,b);}
+enc pmaxsw(XMMREG a,R_M128 b){return x86(966,a,b);}
+enc pmaxsw(MMREG a,MMREG b){return x86(967,a,b);}
+enc pmaxsw(MMREG a,MEM64 b){return x86(967,a,b);}
+enc pmaxsw(MMREG a,MM64 b){return x86(967,a,b);}
+enc pmaxub(MMREG a,MMREG b){return x86(968,a,b);}
+enc pmaxub(MMREG a,MEM64 b){return x86(968,a,b);}
+enc pmaxub(MMREG a,MM64 b){return x86(968,a,b);}
+enc pmaxub(XMMREG a,XMMREG b){return x86(969,a,b);}
+enc pmaxub(XMMREG a,MEM128 b){return x86(969,a,b);}
+enc pmaxub(XMMREG a,R_M128 b){return x86(969,a,b);}
+enc pminsw(MMREG a,MMREG b){return x86(970,a,b);}
+enc pminsw(MMREG a,MEM64 b){return x86(970,a,b);}
+enc pminsw(MMREG a,MM64 b){return x86(970,a,b);}
+enc pminsw(XMMREG a,XMMREG b){return x86(971,a,b);}
+enc pminsw(XMMREG a,MEM128 b){return x86(971,a,b);}
+enc pminsw(XMMREG a,R_M128 b){return x86(971,a,b);}
+enc pminub(MMREG a,MMREG b){return x86(972,a,b);}
+enc pminub(MMREG a,MEM64 b){return x86(972,a,b);}
+enc pminub(MMREG a,MM64 b){return x86(972,a,b);}
+enc pminub(XMMREG a,XMMREG b){return x86(973,a,b);}
+enc pminub(XMMREG a,MEM128 b){return x86(973,a,b);}
+enc pminub(XMMREG a,R_M128 b){return x86(973,a,b);}
+enc pmovmskb(REG32 a,MMREG b){return x86(974,a,b);}
+enc pmovmskb(REG32 a,XMMREG b){return x86(975,a,b);}
+enc pmulhriw(MMREG a,MMREG b){return x86(976,a,b);}
+enc pmulhriw(MMREG a,MEM64 b){return x86(976,a,b);}
+enc pmulhriw(MMREG a,MM64 b){return x86(976,a,b);}
+enc pmulhrwa(MMREG a,MMREG b){return x86(977,a,b);}
+enc pmulhrwa(MMREG a,MEM64 b){return x86(977,a,b);}
+enc pmulhrwa(MMREG a,MM64 b){return x86(977,a,b);}
+enc pmulhrwc(MMREG a,MMREG b){return x86(978,a,b);}
+enc pmulhrwc(MMREG a,MEM64 b){return x86(978,a,b);}
+enc pmulhrwc(MMREG a,MM64 b){return x86(978,a,b);}
+enc pmulhuw(MMREG a,MMREG b){return x86(979,a,b);}
+enc pmulhuw(MMREG a,MEM64 b){return x86(979,a,b);}
+enc pmulhuw(MMREG a,MM64 b){return x86(979,a,b);}
+enc pmulhuw(XMMREG a,XMMREG b){return x86(980,a,b);}
+enc pmulhuw(XMMREG a,MEM128 b){return x86(980,a,b);}
+enc pmulhuw(XMMREG a,R_M128 b){return x86(980,a,b);}
+enc pmulhw(MMREG a,MMREG b){return x86(981,a,b);}
+enc pmulhw(MMREG a,MEM64 b){return x86(981,a,b);}
+enc pmulhw(MMREG a,MM64 b){return x86(981,a,b);}
+enc pmulhw(XMMREG a,XMMREG b){return x86(982,a,b);}
+enc pmulhw(XMMREG a,MEM128 b){return x86(982,a,b);}
+enc pmulhw(XMMREG a,R_M128 b){return x86(982,a,b);}
+enc pmullw(MMREG a,MMREG b){return x86(983,a,b);}
+enc pmullw(MMREG a,MEM64 b){return x86(983,a,b);}
+enc pmullw(MMREG a,MM64 b){return x86(983,a,b);}
+enc pmullw(XMMREG a,XMMREG b){return x86(984,a,b);}
+enc pmullw(XMMREG a,MEM128 b){return x86(984,a,b);}
+enc pmullw(XMMREG a,R_M128 b){return x86(984,a,b);}
+enc pmuludq(MMREG a,MMREG b){return x86(985,a,b);}
+enc pmuludq(MMREG a,MEM64 b){return x86(985,a,b);}
+enc pmuludq(MMREG a,MM64 b){return x86(985,a,b);}
+enc pmuludq(XMMREG a,XMMREG b){return x86(986,a,b);}
+enc pmuludq(XMMREG a,MEM128 b){return x86(986,a,b);}
+enc pmuludq(XMMREG a,R_M128 b){return x86(986,a,b);}
+enc pmvgezb(MMREG a,MEM64 b){return x86(987,a,b);}
+enc pmvlzb(MMREG a,MEM64 b){return x86(988,a,b);}
+enc pmvnzb(MMREG a,MEM64 b){return x86(989,a,b);}
+enc pmvzb(MMREG a,MEM64 b){return x86(990,a,b);}
+enc pop(REG16 a){return x86(991,a);}
+enc pop(REG32 a){return x86(992,a);}
+enc pop(REG64 a){return x86(993,a);}
+enc pop(MEM16 a){return x86(994,a);}
+enc pop(R_M16 a){return x86(994,a);}
+enc pop(MEM32 a){return x86(995,a);}
+enc pop(R_M32 a){return x86(995,a);}
+enc pop(MEM64 a){return x86(996,a);}
+enc pop(R_M64 a){return x86(996,a);}
+enc popa(){return x86(997);}
+enc popad(){return x86(998);}
+enc popaw(){return x86(999);}
+enc popf(){return x86(1000);}
+enc popfd(){return x86(1001);}
+enc popfq(){return x86(1002);}
+enc popfw(){return x86(1003);}
+enc por(MMREG a,MMREG b){return x86(1004,a,b);}
+enc por(MMREG a,MEM64 b){return x86(1004,a,b);}
+enc por(MMREG a,MM64 b){return x86(1004,a,b);}
+enc por(XMMREG a,XMMREG b){return x86(1005,a,b);}
+enc por(XMMREG a,MEM128 b){return x86(1005,a,b);}
+enc por(XMMREG a,R_M128 b){return x86(1005,a,b);}
+enc prefetch(MEM8 a){return x86(1006,a);}
+enc prefetch(MEM16 a){return x86(1006,a);}
+enc prefetch(MEM32 a){return x86(1006,a);}
+enc prefetch(MEM64 a){return x86(1006,a);}
+enc prefetch(MEM128 a){return x86(1006,a);}
+enc prefetchnta(MEM8 a){return x86(1007,a);}
+enc prefetchnta(MEM16 a){return x86(1007,a);}
+enc prefetchnta(MEM32 a){return x86(1007,a);}
+enc prefetchnta(MEM64 a){return x86(1007,a);}
+enc prefetchnta(MEM128 a){return x86(1007,a);}
+enc prefetcht0(MEM8 a){return x86(1008,a);}
+enc prefetcht0(MEM16 a){return x86(1008,a);}
+enc prefetcht0(MEM32 a){return x86(1008,a);}
+enc prefetcht0(MEM64 a){return x86(1008,a);}
+enc prefetcht0(MEM128 a){return x86(1008,a);}
+enc prefetcht1(MEM8 a){return x86(1009,a);}
+enc prefetcht1(MEM16 a){return x86(1009,a);}
+enc prefetcht1(MEM32 a){return x86(1009,a);}
+enc prefetcht1(MEM64 a){return x86(1009,a);}
+enc prefetcht1(MEM128 a){return x86(1009,a);}
+enc prefetcht2(MEM8 a){return x86(1010,a);}
+enc prefetcht2(MEM16 a){return x86(1010,a);}
+enc prefetcht2(MEM32 a){return x86(1010,a);}
+enc prefetcht2(MEM64 a){return x86(1010,a);}
+enc prefetcht2(MEM128 a){return x86(1010,a);}
+enc prefetchw(MEM8 a){return x86(1011,a);}
+enc prefetchw(MEM16 a){return x86(1011,a);}
+enc prefetchw(MEM32 a){return x86(1011,a);}
+enc prefetchw(MEM64 a){return x86(1011,a);}
+enc prefetchw(MEM128 a){return x86(1011,a);}
+enc psadbw(MMREG a,MMREG b){return x86(1012,a,b);}
+enc psadbw(MMREG a,MEM64 b){return x86(1012,a,b);}
+enc psadbw(MMREG a,MM64 b){return x86(1012,a,b);}
+enc psadbw(XMMREG a,XMMREG b){return x86(1013,a,b);}
+enc psadbw(XMMREG a,MEM128 b){return x86(1013,a,b);}
+enc psadbw(XMMREG a,R_M128 b){return x86(1013,a,b);}
+enc pshufd(XMMREG a,XMMREG b,byte c){return x86(1014,a,b,(IMM)c);}
+enc pshufd(XMMREG a,MEM128 b,byte c){return x86(1014,a,b,(IMM)c);}
+enc pshufd(XMMREG a,R_M128 b,byte c){return x86(1014,a,b,(IMM)c);}
+enc pshufhw(XMMREG a,XMMREG b,byte c){return x86(1015,a,b,(IMM)c);}
+enc pshufhw(XMMREG a,MEM128 b,byte c){return x86(1015,a,b,(IMM)c);}
+enc pshufhw(XMMREG a,R_M128 b,byte c){return x86(1015,a,b,(IMM)c);}
+enc pshuflw(XMMREG a,XMMREG b,byte c){return x86(1016,a,b,(IMM)c);}
+enc pshuflw(XMMREG a,MEM128 b,byte c){return x86(1016,a,b,(IMM)c);}
+enc pshuflw(XMMREG a,R_M128 b,byte c){return x86(1016,a,b,(IMM)c);}
+enc pshufw(MMREG a,MMREG b,byte c){return x86(1017,a,b,(IMM)c);}
+enc pshufw(MMREG a,MEM64 b,byte c){return x86(1017,a,b,(IMM)c);}
+enc pshufw(MMREG a,MM64 b,byte c){return x86(1017,a,b,(IMM)c);}
+enc pslld(MMREG a,MMREG b){return x86(1018,a,b);}
+enc pslld(MMREG a,MEM64 b){return x86(1018,a,b);}
+enc pslld(MMREG a,MM64 b){return x86(1018,a,b);}
+enc pslld(MMREG a,byte b){return x86(1019,a,(IMM)b);}
+enc pslld(XMMREG a,XMMREG b){return x86(1020,a,b);}
+enc pslld(XMMREG a,MEM128 b){return x86(1020,a,b);}
+enc pslld(XMMREG a,R_M128 b){return x86(1020,a,b);}
+enc pslld(XMMREG a,byte b){return x86(1021,a,(IMM)b);}
+enc psllq(MMREG a,MMREG b){return x86(1022,a,b);}
+enc psllq(MMREG a,MEM64 b){return x86(1022,a,b);}
+enc psllq(MMREG a,MM64 b){return x86(1022,a,b);}
+enc psllq(MMREG a,byte b){return x86(1023,a,(IMM)b);}
+enc psllq(XMMREG a,XMMREG b){return x86(1024,a,b);}
+enc psllq(XMMREG a,MEM128 b){return x86(1024,a,b);}
+enc psllq(XMMREG a,R_M128 b){return x86(1024,a,b);}
+enc psllq(XMMREG a,byte b){return x86(1025,a,(IMM)b);}
+enc psllw(MMREG a,MMREG b){return x86(1026,a,b);}
+enc psllw(MMREG a,MEM64 b){return x86(1026,a,b);}
+enc psllw(MMREG a,MM64 b){return x86(1026,a,b);}
+enc psllw(MMREG a,byte b){return x86(1027,a,(IMM)b);}
+enc psllw(XMMREG a,XMMREG b){return x86(1028,a,b);}
+enc psllw(XMMREG a,MEM128 b){return x86(1028,a,b);}
+enc psllw(XMMREG a,R_M128 b){return x86(1028,a,b);}
+enc psllw(XMMREG a,byte b){return x86(1029,a,(IMM)b);}
+enc psrad(MMREG a,MMREG b){return x86(1030,a,b);}
+enc psrad(MMREG a,MEM64 b){return x86(1030,a,b);}
+enc psrad(MMREG a,MM64 b){return x86(1030,a,b);}
+enc psrad(MMREG a,byte b){return x86(1031,a,(IMM)b);}
+enc psrad(XMMREG a,XMMREG b){return x86(1032,a,b);}
+enc psrad(XMMREG a,MEM128 b){return x86(1032,a,b);}
+enc psrad(XMMREG a,R_M128 b){return x86(1032,a,b);}
+enc psrad(XMMREG a,byte b){return x86(1033,a,(IMM)b);}
+enc psraw(MMREG a,MMREG b){return x86(1034,a,b);}
+enc psraw(MMREG a,MEM64 b){return x86(1034,a,b);}
+enc psraw(MMREG a,MM64 b){return x86(1034,a,b);}
+enc psraw(MMREG a,byte b){return x86(1035,a,(IMM)b);}
+enc psraw(XMMREG a,XMMREG b){return x86(1036,a,b);}
+enc psraw(XMMREG a,MEM128 b){return x86(1036,a,b);}
+enc psraw(XMMREG a,R_M128 b){return x86(1036,a,b);}
+enc psraw(XMMREG a,byte b){return x86(1037,a,(IMM)b);}
+enc psrld(MMREG a,MMREG b){return x86(1038,a,b);}
+enc psrld(MMREG a,MEM64 b){return x86(1038,a,b);}
+enc psrld(MMREG a,MM64 b){return x86(1038,a,b);}
+enc psrld(MMREG a,byte b){return x86(1039,a,(IMM)b);}
+enc psrld(XMMREG a,XMMREG b){return x86(1040,a,b);}
+enc psrld(XMMREG a,MEM128 b){return x86(1040,a,b);}
+enc psrld(XMMREG a,R_M128 b){return x86(1040,a,b);}
+enc psrld(XMMREG a,byte b){return x86(1041,a,(IMM)b);}
+enc psrldq(XMMREG a,byte b){return x86(1042,a,(IMM)b);}
+enc psrlq(MMREG a,MMREG b){return x86(1043,a,b);}
+enc psrlq(MMREG a,MEM64 b){return x86(1043,a,b);}
+enc psrlq(MMREG a,MM64 b){return x86(1043,a,b);}
+enc psrlq(MMREG a,byte b){return x86(1044,a,(IMM)b);}
+enc psrlq(XMMREG a,XMMREG b){return x86(1045,a,b);}
+enc psrlq(XMMREG a,MEM128 b){return x86(1045,a,b);}
+enc psrlq(XMMREG a,R_M128 b){return x86(1045,a,b);}
+enc psrlq(XMMREG a,byte b){return x86(1046,a,(IMM)b);}
+enc psrlw(MMREG a,MMREG b){return x86(1047,a,b);}
+enc psrlw(MMREG a,MEM64 b){return x86(1047,a,b);}
+enc psrlw(MMREG a,MM64 b){return x86(1047,a,b);}
+enc psrlw(MMREG a,byte b){return x86(1048,a,(IMM)b);}
+enc psrlw(XMMREG a,XMMREG b){return x86(1049,a,b);}
+enc psrlw(XMMREG a,MEM128 b){return x86(1049,a,b);}
+enc psrlw(XMMREG a,R_M128 b){return x86(1049,a,b);}
+enc psrlw(XMMREG a,byte b){return x86(1050,a,(IMM)b);}
+enc psubb(MMREG a,MMREG b){return x86(1051,a,b);}
+enc psubb(MMREG a,MEM64 b){return x86(1051,a,b);}
+enc psubb(MMREG a,MM64 b){return x86(1051,a,b);}
+enc psubb(XMMREG a,XMMREG b){return x86(1052,a,b);}
+enc psubb(XMMREG a,MEM128 b){return x86(1052,a,b);}
+enc psubb(XMMREG a,R_M128 b){return x86(1052,a,b);}
+enc psubd(MMREG a,MMREG b){return x86(1053,a,b);}
+enc psubd(MMREG a,MEM64 b){return x86(1053,a,b);}
+enc psubd(MMREG a,MM64 b){return x86(1053,a,b);}
+enc psubd(XMMREG a,XMMREG b){return x86(1054,a,b);}
+enc psubd(XMMREG a,MEM128 b){return x86(1054,a,b);}
+enc psubd(XMMREG a,R_M128 b){return x86(1054,a,b);}
+enc psubq(MMREG a,MMREG b){return x86(1055,a,b);}
+enc psubq(MMREG a,MEM64 b){return x86(1055,a,b);}
+enc psubq(MMREG a,MM64 b){return x86(1055,a,b);}
+enc psubq(XMMREG a,XMMREG b){return x86(1056,a,b);}
+enc psubq(XMMREG a,MEM128 b){return x86(1056,a,b);}
+enc psubq(XMMREG a,R_M128 b){return x86(1056,a,b);}
+enc psubsb(MMREG a,MMREG b){return x86(1057,a,b);}
+enc psubsb(MMREG a,MEM64 b){return x86(1057,a,b);}
+enc psubsb(MMREG a,MM64 b){return x86(1057,a,b);}
+enc psubsb(XMMREG a,XMMREG b){return x86(1058,a,b);}
+enc psubsb(XMMREG a,MEM128 b){return x86(1058,a,b);}
+enc psubsb(XMMREG a,R_M128 b){return x86(1058,a,b);}
+enc psubsiw(MMREG a,MMREG b){return x86(1059,a,b);}
+enc psubsiw(MMREG a,MEM64 b){return x86(1059,a,b);}
+enc psubsiw(MMREG a,MM64 b){return x86(1059,a,b);}
+enc psubsw(MMREG a,MMREG b){return x86(1060,a,b);}
+enc psubsw(MMREG a,MEM64 b){return x86(1060,a,b);}
+enc psubsw(MMREG a,MM64 b){return x86(1060,a,b);}
+enc psubsw(XMMREG a,XMMREG b){return x86(1061,a,b);}
+enc psubsw(XMMREG a,MEM128 b){return x86(1061,a,b);}
+enc psubsw(XMMREG a,R_M128 b){return x86(1061,a,b);}
+enc psubusb(MMREG a,MMREG b){return x86(1062,a,b);}
+enc psubusb(MMREG a,MEM64 b){return x86(1062,a,b);}
+enc psubusb(MMREG a,MM64 b){return x86(1062,a,b);}
+enc psubusb(XMMREG a,XMMREG b){return x86(1063,a,b);}
+enc psubusb(XMMREG a,MEM128 b){return x86(1063,a,b);}
+enc psubusb(XMMREG a,R_M128 b){return x86(1063,a,b);}
+enc psubusw(MMREG a,MMREG b){return x86(1064,a,b);}
+enc psubusw(MMREG a,MEM64 b){return x86(1064,a,b);}
+enc psubusw(MMREG a,MM64 b){return x86(1064,a,b);}
+enc psubusw(XMMREG a,XMMREG b){return x86(1065,a,b);}
+enc psubusw(XMMREG a,MEM128 b){return x86(1065,a,b);}
+enc psubusw(XMMREG a,R_M128 b){return x86(1065,a,b);}
+enc psubw(MMREG a,MMREG b){return x86(1066,a,b);}
+enc psubw(MMREG a,MEM64 b){return x86(1066,a,b);}
+enc psubw(MMREG a,MM64 b){return x86(1066,a,b);}
+enc psubw(XMMREG a,XMMREG b){return x86(1067,a,b);}
+enc psubw(XMMREG a,MEM128 b){return x86(1067,a,b);}
+enc psubw(XMMREG a,R_M128 b){return x86(1067,a,b);}
+enc pswapd(MMREG a,MMREG b){return x86(1068,a,b);}
+enc pswapd(MMREG a,MEM64 b){return x86(1068,a,b);}
+enc pswapd(MMREG a,MM64 b){return x86(1068,a,b);}
+enc punpckhbw(MMREG a,MMREG b){return x86(1069,a,b);}
+enc punpckhbw(MMREG a,MEM64 b){return x86(1069,a,b);}
+enc punpckhbw(MMREG a,MM64 b){return x86(1069,a,b);}
+enc punpckhbw(XMMREG a,XMMREG b){return x86(1070,a,b);}
+enc punpckhbw(XMMREG a,MEM128 b){return x86(1070,a,b);}
+enc punpckhbw(XMMREG a,R_M128 b){return x86(1070,a,b);}
+enc punpckhdq(MMREG a,MMREG b){return x86(1071,a,b);}
+enc punpckhdq(MMREG a,MEM64 b){return x86(1071,a,b);}
+enc punpckhdq(MMREG a,MM64 b){return x86(1071,a,b);}
+enc punpckhdq(XMMREG a,XMMREG b){return x86(1072,a,b);}
+enc punpckhdq(XMMREG a,MEM128 b){return x86(1072,a,b);}
+enc punpckhdq(XMMREG a,R_M128 b){return x86(1072,a,b);}
+enc punpckhqdq(XMMREG a,XMMREG b){return x86(1073,a,b);}
+enc punpckhqdq(XMMREG a,MEM128 b){return x86(1073,a,b);}
+enc punpckhqdq(XMMREG a,R_M128 b){return x86(1073,a,b);}
+enc punpckhwd(MMREG a,MMREG b){return x86(1074,a,b);}
+enc punpckhwd(MMREG a,MEM64 b){return x86(1074,a,b);}
+enc punpckhwd(MMREG a,MM64 b){return x86(1074,a,b);}
+enc punpckhwd(XMMREG a,XMMREG b){return x86(1075,a,b);}
+enc punpckhwd(XMMREG a,MEM128 b){return x86(1075,a,b);}
+enc punpckhwd(XMMREG a,R_M128 b){return x86(1075,a,b);}
+enc punpcklbw(MMREG a,MMREG b){return x86(1076,a,b);}
+enc punpcklbw(MMREG a,MEM64 b){return x86(1076,a,b);}
+enc punpcklbw(MMREG a,MM64 b){return x86(1076,a,b);}
+enc punpcklbw(XMMREG a,XMMREG b){return x86(1077,a,b);}
+enc punpcklbw(XMMREG a,MEM128 b){return x86(1077,a,b);}
+enc punpcklbw(XMMREG a,R_M128 b){return x86(1077,a,b);}
+enc punpckldq(MMREG a,MMREG b){return x86(1078,a,b);}
+enc punpckldq(MMREG a,MEM64 b){return x86(1078,a,b);}
+enc punpckldq(MMREG a,MM64 b){return x86(1078,a,b);}
+enc punpckldq(XMMREG a,XMMREG b){return x86(1079,a,b);}
+enc punpckldq(XMMREG a,MEM128 b){return x86(1079,a,b);}
+enc punpckldq(XMMREG a,R_M128 b){return x86(1079,a,b);}
+enc punpcklqdq(XMMREG a,XMMREG b){return x86(1080,a,b);}
+enc punpcklqdq(XMMREG a,MEM128 b){return x86(1080,a,b);}
+enc punpcklqdq(XMMREG a,R_M128 b){return x86(1080,a,b);}
+enc punpcklwd(MMREG a,MMREG b){return x86(1081,a,b);}
+enc punpcklwd(MMREG a,MEM64 b){return x86(1081,a,b);}
+enc punpcklwd(MMREG a,MM64 b){return x86(1081,a,b);}
+enc punpcklwd(XMMREG a,XMMREG b){return x86(1082,a,b);}
+enc punpcklwd(XMMREG a,MEM128 b){return x86(1082,a,b);}
+enc punpcklwd(XMMREG a,R_M128 b){return x86(1082,a,b);}
+enc push(REG16 a){return x86(1083,a);}
+enc push(REG32 a){return x86(1084,a);}
+enc push(REG64 a){return x86(1085,a);}
+enc push(MEM16 a){return x86(1086,a);}
+enc push(R_M16 a){return x86(1086,a);}
+enc push(MEM32 a){return x86(1087,a);}
+enc push(R_M32 a){return x86(1087,a);}
+enc push(MEM64 a){return x86(1088,a);}
+enc push(R_M64 a){return x86(1088,a);}
+enc push(byte a){return x86(1089,(IMM)a);}
+enc push(word a){return x86(1090,(IMM)a);}
+enc push(REF a){return x86(1091,a);}
+enc push(dword a){return x86(1091,(IMM)a);}
+enc pusha(){return x86(1093);}
+enc pushad(){return x86(1094);}
+enc pushaw(){return x86(1095);}
+enc pushf(){return x86(1096);}
+enc pushfd(){return x86(1097);}
+enc pushfw(){return x86(1098);}
+enc pxor(MMREG a,MMREG b){return x86(1099,a,b);}
+enc pxor(MMREG a,MEM64 b){return x86(1099,a,b);}
+enc pxor(MMREG a,MM64 b){return x86(1099,a,b);}
+enc pxor(XMMREG a,XMMREG b){return x86(1100,a,b);}
+enc pxor(XMMREG a,MEM128 b){return x86(1100,a,b);}
+enc pxor(XMMREG a,R_M128 b){return x86(1100,a,b);}
+enc rcl(REG8 a,CL b){return x86(1102,a,b);}
+enc rcl(MEM8 a,CL b){return x86(1102,a,b);}
+enc rcl(R_M8 a,CL b){return x86(1102,a,b);}
+enc rcl(REG8 a,byte b){return x86(1103,a,(IMM)b);}
+enc rcl(AL a,byte b){return x86(1103,a,(IMM)b);}
+enc rcl(CL a,byte b){return x86(1103,a,(IMM)b);}
+enc rcl(MEM8 a,byte b){return x86(1103,a,(IMM)b);}
+enc rcl(R_M8 a,byte b){return x86(1103,a,(IMM)b);}
+enc rcl(REG16 a,CL b){return x86(1105,a,b);}
+enc rcl(MEM16 a,CL b){return x86(1105,a,b);}
+enc rcl(R_M16 a,CL b){return x86(1105,a,b);}
+enc rcl(REG16 a,byte b){return x86(1106,a,(IMM)b);}
+enc rcl(MEM16 a,byte b){return x86(1106,a,(IMM)b);}
+enc rcl(R_M16 a,byte b){return x86(1106,a,(IMM)b);}
+enc rcl(REG32 a,CL b){return x86(1108,a,b);}
+enc rcl(MEM32 a,CL b){return x86(1108,a,b);}
+enc rcl(R_M32 a,CL b){return x86(1108,a,b);}
+enc rcl(REG32 a,byte b){return x86(1109,a,(IMM)b);}
+enc rcl(MEM32 a,byte b){return x86(1109,a,(IMM)b);}
+enc rcl(R_M32 a,byte b){return x86(1109,a,(IMM)b);}
+enc rcl(REG64 a,CL b){return x86(1111,a,b);}
+enc rcl(MEM64 a,CL b){return x86(1111,a,b);}
+enc rcl(R_M64 a,CL b){return x86(1111,a,b);}
+enc rcl(REG64 a,byte b){return x86(1112,a,(IMM)b);}
+enc rcl(RAX a,byte b){return x86(1112,a,(IMM)b);}
+enc rcl(MEM64 a,byte b){return x86(1112,a,(IMM)b);}
+enc rcl(R_M64 a,byte b){return x86(1112,a,(IMM)b);}
+enc rcpps(XMMREG a,XMMREG b){return x86(1113,a,b);}
+enc rcpps(XMMREG a,MEM128 b){return x86(1113,a,b);}
+enc rcpps(XMMREG a,R_M128 b){return x86(1113,a,b);}
+enc rcpss(XMMREG a,XMMREG b){return x86(1114,a,b);}
+enc rcpss(XMMREG a,MEM32 b){return x86(1114,a,b);}
+enc rcpss(XMMREG a,XMM32 b){return x86(1114,a,b);}
+enc rcr(REG8 a,CL b){return x86(1116,a,b);}
+enc rcr(MEM8 a,CL b){return x86(1116,a,b);}
+enc rcr(R_M8 a,CL b){return x86(1116,a,b);}
+enc rcr(REG8 a,byte b){return x86(1117,a,(IMM)b);}
+enc rcr(AL a,byte b){return x86(1117,a,(IMM)b);}
+enc rcr(CL a,byte b){return x86(1117,a,(IMM)b);}
+enc rcr(MEM8 a,byte b){return x86(1117,a,(IMM)b);}
+enc rcr(R_M8 a,byte b){return x86(1117,a,(IMM)b);}
+enc rcr(REG16 a,CL b){return x86(1119,a,b);}
+enc rcr(MEM16 a,CL b){return x86(1119,a,b);}
+enc rcr(R_M16 a,CL b){return x86(1119,a,b);}
+enc rcr(REG16 a,byte b){return x86(1120,a,(IMM)b);}
+enc rcr(MEM16 a,byte b){return x86(1120,a,(IMM)b);}
+enc rcr(R_M16 a,byte b){return x86(1120,a,(IMM)b);}
+enc rcr(REG32 a,CL b){return x86(1122,a,b);}
+enc rcr(MEM32 a,CL b){return x86(1122,a,b);}
+enc rcr(R_M32 a,CL b){return x86(1122,a,b);}
+enc rcr(REG32 a,byte b){return x86(1123,a,(IMM)b);}
+enc rcr(MEM32 a,byte b){return x86(1123,a,(IMM)b);}
+enc rcr(R_M32 a,byte b){return x86(1123,a,(IMM)b);}
+enc rdmsr(){return x86(1127);}
+enc rdpmc(){return x86(1128);}
+enc rdtsc(){return x86(1129);}
+enc rep_insb(){return x86(1130);}
+enc rep_insd(){return x86(1131);}
+enc rep_insw(){return x86(1132);}
+enc rep_lodsb(){return x86(1133);}
+enc rep_lodsd(){return x86(1134);}
+enc rep_lodsw(){return x86(1135);}
+enc rep_movsb(){return x86(1136);}
+enc rep_movsd(){return x86(1137);}
+enc rep_movsw(){return x86(1138);}
+enc rep_outsb(){return x86(1139);}
+enc rep_outsd(){return x86(1140);}
+enc rep_outsw(){return x86(1141);}
+enc rep_scasb(){return x86(1142);}
+enc rep_scasd(){return x86(1143);}
+enc rep_scasw(){return x86(1144);}
+enc rep_stosb(){return x86(1145);}
+enc rep_stosd(){return x86(1146);}
+enc rep_stosw(){return x86(1147);}
+enc repe_cmpsb(){return x86(1148);}
+enc repe_cmpsd(){return x86(1149);}
+enc repe_cmpsw(){return x86(1150);}
+enc repe_scasb(){return x86(1151);}
+enc repe_scasd(){return x86(1152);}
+enc repe_scasw(){return x86(1153);}
+enc repne_cmpsb(){return x86(1154);}
+enc repne_cmpsd(){return x86(1155);}
+enc repne_cmpsw(){return x86(1156);}
+enc repne_scasb(){return x86(1157);}
+enc repne_scasd(){return x86(1158);}
+enc repne_scasw(){return x86(1159);}
+enc repnz_cmpsb(){return x86(1160);}
+enc repnz_cmpsd(){return x86(1161);}
+enc repnz_cmpsw(){return x86(1162);}
+enc repnz_scasb(){return x86(1163);}
+enc repnz_scasd(){return x86(1164);}
+enc repnz_scasw(){return x86(1165);}
+enc repz_cmpsb(){return x86(1166);}
+enc repz_cmpsd(){return x86(1167);}
+enc repz_cmpsw(){return x86(1168);}
+enc repz_scasb(){return x86(1169);}
+enc repz_scasd(){return x86(1170);}
+enc repz_scasw(){return x86(1171);}
+enc ret(){return x86(1172);}
+enc ret(byte a){return x86(1173,(IMM)a);}
+enc ret(word a){return x86(1173,(IMM)a);}
+enc rol(REG8 a,CL b){return x86(1175,a,b);}
+enc rol(MEM8 a,CL b){return x86(1175,a,b);}
+enc rol(R_M8 a,CL b){return x86(1175,a,b);}
+enc rol(REG8 a,byte b){return x86(1176,a,(IMM)b);}
+enc rol(AL a,byte b){return x86(1176,a,(IMM)b);}
+enc rol(CL a,byte b){return x86(1176,a,(IMM)b);}
+enc rol(MEM8 a,byte b){return x86(1176,a,(IMM)b);}
+enc rol(R_M8 a,byte b){return x86(1176,a,(IMM)b);}
+enc rol(REG16 a,CL b){return x86(1178,a,b);}
+enc rol(MEM16 a,CL b){return x86(1178,a,b);}
+enc rol(R_M16 a,CL b){return x86(1178,a,b);}
+enc rol(REG16 a,byte b){return x86(1179,a,(IMM)b);}
+enc rol(MEM16 a,byte b){return x86(1179,a,(IMM)b);}
+enc rol(R_M16 a,byte b){return x86(1179,a,(IMM)b);}
+enc rol(REG32 a,CL b){return x86(1181,a,b);}
+enc rol(MEM32 a,CL b){return x86(1181,a,b);}
+enc rol(R_M32 a,CL b){return x86(1181,a,b);}
+enc rol(REG32 a,byte b){return x86(1182,a,(IMM)b);}
+enc rol(MEM32 a,byte b){return x86(1182,a,(IMM)b);}
+enc rol(R_M32 a,byte b){return x86(1182,a,(IMM)b);}
+enc ror(REG8 a,CL b){return x86(1187,a,b);}
+enc ror(MEM8 a,CL b){return x86(1187,a,b);}
+enc ror(R_M8 a,CL b){return x86(1187,a,b);}
+enc ror(REG8 a,byte b){return x86(1188,a,(IMM)b);}
+enc ror(AL a,byte b){return x86(1188,a,(IMM)b);}
+enc ror(CL a,byte b){return x86(1188,a,(IMM)b);}
+enc ror(MEM8 a,byte b){return x86(1188,a,(IMM)b);}
+enc ror(R_M8 a,byte b){return x86(1188,a,(IMM)b);}
+enc ror(REG16 a,CL b){return x86(1190,a,b);}
+enc ror(MEM16 a,CL b){return x86(1190,a,b);}
+enc ror(R_M16 a,CL b){return x86(1190,a,b);}
+enc ror(REG16 a,byte b){return x86(1191,a,(IMM)b);}
+enc ror(MEM16 a,byte b){return x86(1191,a,(IMM)b);}
+enc ror(R_M16 a,byte b){return x86(1191,a,(IMM)b);}
+enc ror(REG32 a,CL b){return x86(1193,a,b);}
+enc ror(MEM32 a,CL b){return x86(1193,a,b);}
+enc ror(R_M32 a,CL b){return x86(1193,a,b);}
+enc ror(REG32 a,byte b){return x86(1194,a,(IMM)b);}
+enc ror(MEM32 a,byte b){return x86(1194,a,(IMM)b);}
+enc ror(R_M32 a,byte b){return x86(1194,a,(IMM)b);}
+enc ror(REG64 a,CL b){return x86(1196,a,b);}
+enc ror(MEM64 a,CL b){return x86(1196,a,b);}
+enc ror(R_M64 a,CL b){return x86(1196,a,b);}
+enc ror(REG64 a,byte b){return x86(1197,a,(IMM)b);}
+enc ror(RAX a,byte b){return x86(1197,a,(IMM)b);}
+enc ror(MEM64 a,byte b){return x86(1197,a,(IMM)b);}
+enc ror(R_M64 a,byte b){return x86(1197,a,(IMM)b);}
+enc rsm(){return x86(1198);}
+enc rsqrtps(XMMREG a,XMMREG b){return x86(1199,a,b);}
+enc rsqrtps(XMMREG a,MEM128 b){return x86(1199,a,b);}
+enc rsqrtps(XMMREG a,R_M128 b){return x86(1199,a,b);}
+enc rsqrtss(XMMREG a,XMMREG b){return x86(1200,a,b);}
+enc rsqrtss(XMMREG a,MEM32 b){return x86(1200,a,b);}
+enc rsqrtss(XMMREG a,XMM32 b){return x86(1200,a,b);}
+enc sahf(){return x86(1201);}
+enc sal(REG8 a,CL b){return x86(1203,a,b);}
+enc sal(MEM8 a,CL b){return x86(1203,a,b);}
+enc sal(R_M8 a,CL b){return x86(1203,a,b);}
+enc sal(REG8 a,byte b){return x86(1204,a,(IMM)b);}
+enc sal(AL a,byte b){return x86(1204,a,(IMM)b);}
+enc sal(CL a,byte b){return x86(1204,a,(IMM)b);}
+enc sal(MEM8 a,byte b){return x86(1204,a,(IMM)b);}
+enc sal(R_M8 a,byte b){return x86(1204,a,(IMM)b);}
+enc sal(REG16 a,CL b){return x86(1206,a,b);}
+enc sal(MEM16 a,CL b){return x86(1206,a,b);}
+enc sal(R_M16 a,CL b){return x86(1206,a,b);}
+enc sal(REG16 a,byte b){return x86(1207,a,(IMM)b);}
+enc sal(MEM16 a,byte b){return x86(1207,a,(IMM)b);}
+enc sal(R_M16 a,byte b){return x86(1207,a,(IMM)b);}
+enc sal(REG32 a,CL b){return x86(1209,a,b);}
+enc sal(MEM32 a,CL b){return x86(1209,a,b);}
+enc sal(R_M32 a,CL b){return x86(1209,a,b);}
+enc sal(REG32 a,byte b){return x86(1210,a,(IMM)b);}
+enc sal(MEM32 a,byte b){return x86(1210,a,(IMM)b);}
+enc sal(R_M32 a,byte b){return x86(1210,a,(IMM)b);}
+enc sal(REG64 a,CL b){return x86(1212,a,b);}
+enc sal(MEM64 a,CL b){return x86(1212,a,b);}
+enc sal(R_M64 a,CL b){return x86(1212,a,b);}
+enc sal(REG64 a,byte b){return x86(1213,a,(IMM)b);}
+enc sal(RAX a,byte b){return x86(1213,a,(IMM)b);}
+enc sal(MEM64 a,byte b){return x86(1213,a,(IMM)b);}
+enc sal(R_M64 a,byte b){return x86(1213,a,(IMM)b);}
+enc sar(REG8 a,CL b){return x86(1215,a,b);}
+enc sar(MEM8 a,CL b){return x86(1215,a,b);}
+enc sar(R_M8 a,CL b){return x86(1215,a,b);}
+enc sar(REG8 a,byte b){return x86(1216,a,(IMM)b);}
+enc sar(AL a,byte b){return x86(1216,a,(IMM)b);}
+enc sar(CL a,byte b){return x86(1216,a,(IMM)b);}
+enc sar(MEM8 a,byte b){return x86(1216,a,(IMM)b);}
+enc sar(R_M8 a,byte b){return x86(1216,a,(IMM)b);}
+enc sar(REG16 a,CL b){return x86(1218,a,b);}
+enc sar(MEM16 a,CL b){return x86(1218,a,b);}
+enc sar(R_M16 a,CL b){return x86(1218,a,b);}
+enc sar(REG16 a,byte b){return x86(1219,a,(IMM)b);}
+enc sar(MEM16 a,byte b){return x86(1219,a,(IMM)b);}
+enc sar(R_M16 a,byte b){return x86(1219,a,(IMM)b);}
+enc sar(REG32 a,CL b){return x86(1221,a,b);}
+enc sar(MEM32 a,CL b){return x86(1221,a,b);}
+enc sar(R_M32 a,CL b){return x86(1221,a,b);}
+enc sar(REG32 a,byte b){return x86(1222,a,(IMM)b);}
+enc sar(MEM32 a,byte b){return x86(1222,a,(IMM)b);}
+enc sar(R_M32 a,byte b){return x86(1222,a,(IMM)b);}
+enc sar(REG64 a,CL b){return x86(1224,a,b);}
+enc sar(MEM64 a,CL b){return x86(1224,a,b);}
+enc sar(R_M64 a,CL b){return x86(1224,a,b);}
+enc sar(REG64 a,byte b){return x86(1225,a,(IMM)b);}
+enc sar(RAX a,byte b){return x86(1225,a,(IMM)b);}
+enc sar(MEM64 a,byte b){return x86(1225,a,(IMM)b);}
+enc sar(R_M64 a,byte b){return x86(1225,a,(IMM)b);}
+enc sbb(REG8 a,REG8 b){return x86(1226,a,b);}
+enc sbb(MEM8 a,REG8 b){return x86(1226,a,b);}
+enc sbb(R_M8 a,REG8 b){return x86(1226,a,b);}
+enc sbb(REG16 a,REG16 b){return x86(1227,a,b);}
+enc sbb(MEM16 a,REG16 b){return x86(1227,a,b);}
+enc sbb(R_M16 a,REG16 b){return x86(1227,a,b);}
+enc sbb(REG32 a,REG32 b){return x86(1228,a,b);}
+enc sbb(MEM32 a,REG32 b){return x86(1228,a,b);}
+enc sbb(R_M32 a,REG32 b){return x86(1228,a,b);}
+enc sbb(REG64 a,REG64 b){return x86(1229,a,b);}
+enc sbb(MEM64 a,REG64 b){return x86(1229,a,b);}
+enc sbb(R_M64 a,REG64 b){return x86(1229,a,b);}
+enc sbb(REG8 a,MEM8 b){return x86(1230,a,b);}
+enc sbb(REG8 a,R_M8 b){return x86(1230,a,b);}
+enc sbb(REG16 a,MEM16 b){return x86(1231,a,b);}
+enc sbb(REG16 a,R_M16 b){return x86(1231,a,b);}
+enc sbb(REG32 a,MEM32 b){return x86(1232,a,b);}
+enc sbb(REG32 a,R_M32 b){return x86(1232,a,b);}
+enc sbb(REG64 a,MEM64 b){return x86(1233,a,b);}
+enc sbb(REG64 a,R_M64 b){return x86(1233,a,b);}
+enc sbb(REG8 a,byte b){return x86(1234,a,(IMM)b);}
+enc sbb(AL a,byte b){return x86(1234,a,(IMM)b);}
+enc sbb(CL a,byte b){return x86(1234,a,(IMM)b);}
+enc sbb(MEM8 a,byte b){return x86(1234,a,(IMM)b);}
+enc sbb(R_M8 a,byte b){return x86(1234,a,(IMM)b);}
+enc sbb(REG16 a,byte b){return x86(1235,a,(IMM)b);}
+enc sbb(REG16 a,word b){return x86(1235,a,(IMM)b);}
+enc sbb(MEM16 a,byte b){return x86(1235,a,(IMM)b);}
+enc sbb(MEM16 a,word b){return x86(1235,a,(IMM)b);}
+enc sbb(R_M16 a,byte b){return x86(1235,a,(IMM)b);}
+enc sbb(R_M16 a,word b){return x86(1235,a,(IMM)b);}
+enc sbb(REG32 a,REF b){return x86(1236,a,b);}
+enc sbb(REG32 a,dword b){return x86(1236,a,(IMM)b);}
+enc sbb(MEM32 a,REF b){return x86(1236,a,b);}
+enc sbb(MEM32 a,dword b){return x86(1236,a,(IMM)b);}
+enc sbb(R_M32 a,REF b){return x86(1236,a,b);}
+enc sbb(R_M32 a,dword b){return x86(1236,a,(IMM)b);}
+enc sbb(REG64 a,REF b){return x86(1237,a,b);}
+enc sbb(REG64 a,dword b){return x86(1237,a,(IMM)b);}
+enc sbb(MEM64 a,REF b){return x86(1237,a,b);}
+enc sbb(MEM64 a,dword b){return x86(1237,a,(IMM)b);}
+enc sbb(R_M64 a,REF b){return x86(1237,a,b);}
+enc sbb(R_M64 a,dword b){return x86(1237,a,(IMM)b);}
+enc scasb(){return x86(1245);}
+enc scasd(){return x86(1246);}
+enc scasq(){return x86(1247);}
+enc scasw(){return x86(1248);}
+enc seta(REG8 a){return x86(1249,a);}
+enc seta(MEM8 a){return x86(1249,a);}
+enc seta(R_M8 a){return x86(1249,a);}
+enc setae(REG8 a){return x86(1250,a);}
+enc setae(MEM8 a){return x86(1250,a);}
+enc setae(R_M8 a){return x86(1250,a);}
+enc setb(REG8 a){return x86(1251,a);}
+enc setb(MEM8 a){return x86(1251,a);}
+enc setb(R_M8 a){return x86(1251,a);}
+enc setbe(REG8 a){return x86(1252,a);}
+enc setbe(MEM8 a){return x86(1252,a);}
+enc setbe(R_M8 a){return x86(1252,a);}
+enc setc(REG8 a){return x86(1253,a);}
+enc setc(MEM8 a){return x86(1253,a);}
+enc setc(R_M8 a){return x86(1253,a);}
+enc sete(REG8 a){return x86(1254,a);}
+enc sete(MEM8 a){return x86(1254,a);}
+enc sete(R_M8 a){return x86(1254,a);}
+enc setg(REG8 a){return x86(1255,a);}
+enc setg(MEM8 a){return x86(1255,a);}
+enc setg(R_M8 a){return x86(1255,a);}
+enc setge(REG8 a){return x86(1256,a);}
+enc setge(MEM8 a){return x86(1256,a);}
+enc setge(R_M8 a){return x86(1256,a);}
+enc setl(REG8 a){return x86(1257,a);}
+enc setl(MEM8 a){return x86(1257,a);}
+enc setl(R_M8 a){return x86(1257,a);}
+enc setle(REG8 a){return x86(1258,a);}
+enc setle(MEM8 a){return x86(1258,a);}
+enc setle(R_M8 a){return x86(1258,a);}
+enc setna(REG8 a){return x86(1259,a);}
+enc setna(MEM8 a){return x86(1259,a);}
+enc setna(R_M8 a){return x86(1259,a);}
+enc setnb(REG8 a){return x86(1260,a);}
+enc setnb(MEM8 a){return x86(1260,a);}
+enc setnb(R_M8 a){return x86(1260,a);}
+enc setnbe(REG8 a){return x86(1261,a);}
+enc setnbe(MEM8 a){return x86(1261,a);}
+enc setnbe(R_M8 a){return x86(1261,a);}
+enc setnc(REG8 a){return x86(1262,a);}
+enc setnc(MEM8 a){return x86(1262,a);}
+enc setnc(R_M8 a){return x86(1262,a);}
+enc setne(REG8 a){return x86(1263,a);}
+enc setne(MEM8 a){return x86(1263,a);}
+enc setne(R_M8 a){return x86(1263,a);}
+enc setnea(REG8 a){return x86(1264,a);}
+enc setnea(MEM8 a){return x86(1264,a);}
+enc setnea(R_M8 a){return x86(1264,a);}
+enc setng(REG8 a){return x86(1265,a);}
+enc setng(MEM8 a){return x86(1265,a);}
+enc setng(R_M8 a){return x86(1265,a);}
+enc setnge(REG8 a){return x86(1266,a);}
+enc setnge(MEM8 a){return x86(1266,a);}
+enc setnge(R_M8 a){return x86(1266,a);}
+enc setnl(REG8 a){return x86(1267,a);}
+enc setnl(MEM8 a){return x86(1267,a);}
+enc setnl(R_M8 a){return x86(1267,a);}
+enc setnle(REG8 a){return x86(1268,a);}
+enc setnle(MEM8 a){return x86(1268,a);}
+enc setnle(R_M8 a){return x86(1268,a);}
+enc setno(REG8 a){return x86(1269,a);}
+enc setno(MEM8 a){return x86(1269,a);}
+enc setno(R_M8 a){return x86(1269,a);}
+enc setnp(REG8 a){return x86(1270,a);}
+enc setnp(MEM8 a){return x86(1270,a);}
+enc setnp(R_M8 a){return x86(1270,a);}
+enc setns(REG8 a){return x86(1271,a);}
+enc setns(MEM8 a){return x86(1271,a);}
+enc setns(R_M8 a){return x86(1271,a);}
+enc setnz(REG8 a){return x86(1272,a);}
+enc setnz(MEM8 a){return x86(1272,a);}
+enc setnz(R_M8 a){return x86(1272,a);}
+enc seto(REG8 a){return x86(1273,a);}
+enc seto(MEM8 a){return x86(1273,a);}
+enc seto(R_M8 a){return x86(1273,a);}
+enc setp(REG8 a){return x86(1274,a);}
+enc setp(MEM8 a){return x86(1274,a);}
+enc setp(R_M8 a){return x86(1274,a);}
+enc setpe(REG8 a){return x86(1275,a);}
+enc setpe(MEM8 a){return x86(1275,a);}
+enc setpe(R_M8 a){return x86(1275,a);}
+enc setpo(REG8 a){return x86(1276,a);}
+enc setpo(MEM8 a){return x86(1276,a);}
+enc setpo(R_M8 a){return x86(1276,a);}
+enc sets(REG8 a){return x86(1277,a);}
+enc sets(MEM8 a){return x86(1277,a);}
+enc sets(R_M8 a){return x86(1277,a);}
+enc setz(REG8 a){return x86(1278,a);}
+enc setz(MEM8 a){return x86(1278,a);}
+enc setz(R_M8 a){return x86(1278,a);}
+enc sfence(){return x86(1279);}
+enc shl(REG8 a,CL b){return x86(1281,a,b);}
+enc shl(MEM8 a,CL b){return x86(1281,a,b);}
+enc shl(R_M8 a,CL b){return x86(1281,a,b);}
+enc shl(REG8 a,byte b){return x86(1282,a,(IMM)b);}
+enc shl(AL a,byte b){return x86(1282,a,(IMM)b);}
+enc shl(CL a,byte b){return x86(1282,a,(IMM)b);}
+enc shl(MEM8 a,byte b){return x86(1282,a,(IMM)b);}
+enc shl(R_M8 a,byte b){return x86(1282,a,(IMM)b);}
+enc shl(REG16 a,CL b){return x86(1284,a,b);}
+enc shl(MEM16 a,CL b){return x86(1284,a,b);}
+enc shl(R_M16 a,CL b){return x86(1284,a,b);}
+enc shl(REG16 a,byte b){return x86(1285,a,(IMM)b);}
+enc shl(MEM16 a,byte b){return x86(1285,a,(IMM)b);}
+enc shl(R_M16 a,byte b){return x86(1285,a,(IMM)b);}
+enc shl(REG32 a,CL b){return x86(1287,a,b);}
+enc shl(MEM32 a,CL b){return x86(1287,a,b);}
+enc shl(R_M32 a,CL b){return x86(1287,a,b);}
+enc shl(REG32 a,byte b){return x86(1288,a,(IMM)b);}
+enc shl(MEM32 a,byte b){return x86(1288,a,(IMM)b);}
+enc shl(R_M32 a,byte b){return x86(1288,a,(IMM)b);}
+enc shl(REG64 a,CL b){return x86(1290,a,b);}
+enc shl(MEM64 a,CL b){return x86(1290,a,b);}
+enc shl(R_M64 a,CL b){return x86(1290,a,b);}
+enc shl(REG64 a,byte b){return x86(1291,a,(IMM)b);}
+enc shl(RAX a,byte b){return x86(1291,a,(IMM)b);}
+enc shl(MEM64 a,byte b){return x86(1291,a,(IMM)b);}
+enc shl(R_M64 a,byte b){return x86(1291,a,(IMM)b);}
+enc shld(REG16 a,REG16 b,byte c){return x86(1292,a,b,(IMM)c);}
+enc shld(REG16 a,AX b,byte c){return x86(1292,a,b,(IMM)c);}
+enc shld(REG16 a,DX b,byte c){return x86(1292,a,b,(IMM)c);}
+enc shld(REG16 a,CX b,byte c){return x86(1292,a,b,(IMM)c);}
+enc shld(AX a,REG16 b,byte c){return x86(1292,a,b,(IMM)c);}
+enc shld(DX a,REG16 b,byte c){return x86(1292,a,b,(IMM)c);}
+enc shld(CX a,REG16 b,byte c){return x86(1292,a,b,(IMM)c);}
+enc shld(MEM16 a,REG16 b,byte c){return x86(1292,a,b,(IMM)c);}
+enc shld(MEM16 a,AX b,byte c){return x86(1292,a,b,(IMM)c);}
+enc shld(MEM16 a,DX b,byte c){return x86(1292,a,b,(IMM)c);}
+enc shld(MEM16 a,CX b,byte c){return x86(1292,a,b,(IMM)c);}
+enc shld(R_M16 a,REG16 b,byte c){return x86(1292,a,b,(IMM)c);}
+enc shld(R_M16 a,AX b,byte c){return x86(1292,a,b,(IMM)c);}
+enc shld(R_M16 a,DX b,byte c){return x86(1292,a,b,(IMM)c);}
+enc shld(R_M16 a,CX b,byte c){return x86(1292,a,b,(IMM)c);}
+enc shld(REG32 a,REG32 b,byte c){return x86(1293,a,b,(IMM)c);}
+enc shld(REG32 a,EAX b,byte c){return x86(1293,a,b,(IMM)c);}
+enc shld(REG32 a,ECX b,byte c){return x86(1293,a,b,(IMM)c);}
+enc shld(EAX a,REG32 b,byte c){return x86(1293,a,b,(IMM)c);}
+enc shld(ECX a,REG32 b,byte c){return x86(1293,a,b,(IMM)c);}
+enc shld(MEM32 a,REG32 b,byte c){return x86(1293,a,b,(IMM)c);}
+enc shld(MEM32 a,EAX b,byte c){return x86(1293,a,b,(IMM)c);}
+enc shld(MEM32 a,ECX b,byte c){return x86(1293,a,b,(IMM)c);}
+enc shld(R_M32 a,REG32 b,byte c){return x86(1293,a,b,(IMM)c);}
+enc shld(R_M32 a,EAX b,byte c){return x86(1293,a,b,(IMM)c);}
+enc shld(R_M32 a,ECX b,byte c){return x86(1293,a,b,(IMM)c);}
+enc shld(REG64 a,REG64 b,byte c){return x86(1294,a,b,(IMM)c);}
+enc shld(REG64 a,RAX b,byte c){return x86(1294,a,b,(IMM)c);}
+enc shld(RAX a,REG64 b,byte c){return x86(1294,a,b,(IMM)c);}
+enc shld(MEM64 a,REG64 b,byte c){return x86(1294,a,b,(IMM)c);}
+enc shld(MEM64 a,RAX b,byte c){return x86(1294,a,b,(IMM)c);}
+enc shld(R_M64 a,REG64 b,byte c){return x86(1294,a,b,(IMM)c);}
+enc shld(R_M64 a,RAX b,byte c){return x86(1294,a,b,(IMM)c);}
+enc shld(REG16 a,REG16 b,CL c){return x86(1295,a,b,c);}
+enc shld(MEM16 a,REG16 b,CL c){return x86(1295,a,b,c);}
+enc shld(R_M16 a,REG16 b,CL c){return x86(1295,a,b,c);}
+enc shld(REG32 a,REG32 b,CL c){return x86(1296,a,b,c);}
+enc shld(MEM32 a,REG32 b,CL c){return x86(1296,a,b,c);}
+enc shld(R_M32 a,REG32 b,CL c){return x86(1296,a,b,c);}
+enc shld(REG64 a,REG64 b,CL c){return x86(1297,a,b,c);}
+enc shld(MEM64 a,REG64 b,CL c){return x86(1297,a,b,c);}
+enc shld(R_M64 a,REG64 b,CL c){return x86(1297,a,b,c);}
+enc shr(REG8 a,CL b){return x86(1299,a,b);}
+enc shr(MEM8 a,CL b){return x86(1299,a,b);}
+enc shr(R_M8 a,CL b){return x86(1299,a,b);}
+enc shr(REG8 a,byte b){return x86(1300,a,(IMM)b);}
+enc shr(AL a,byte b){return x86(1300,a,(IMM)b);}
+enc shr(CL a,byte b){return x86(1300,a,(IMM)b);}
+enc shr(MEM8 a,byte b){return x86(1300,a,(IMM)b);}
+enc shr(R_M8 a,byte b){return x86(1300,a,(IMM)b);}
+enc shr(REG16 a,CL b){return x86(1302,a,b);}
+enc shr(MEM16 a,CL b){return x86(1302,a,b);}
+enc shr(R_M16 a,CL b){return x86(1302,a,b);}
+enc shr(REG16 a,byte b){return x86(1303,a,(IMM)b);}
+enc shr(MEM16 a,byte b){return x86(1303,a,(IMM)b);}
+enc shr(R_M16 a,byte b){return x86(1303,a,(IMM)b);}
+enc shr(REG32 a,CL b){return x86(1305,a,b);}
+enc shr(MEM32 a,CL b){return x86(1305,a,b);}
+enc shr(R_M32 a,CL b){return x86(1305,a,b);}
+enc shr(REG32 a,byte b){return x86(1306,a,(IMM)b);}
+enc shr(MEM32 a,byte b){return x86(1306,a,(IMM)b);}
+enc shr(R_M32 a,byte b){return x86(1306,a,(IMM)b);}
+enc shr(REG64 a,CL b){return x86(1308,a,b);}
+enc shr(MEM64 a,CL b){return x86(1308,a,b);}
+enc shr(R_M64 a,CL b){return x86(1308,a,b);}
+enc shr(REG64 a,byte b){return x86(1309,a,(IMM)b);}
+enc shr(RAX a,byte b){return x86(1309,a,(IMM)b);}
+enc shr(MEM64 a,byte b){return x86(1309,a,(IMM)b);}
+enc shr(R_M64 a,byte b){return x86(1309,a,(IMM)b);}
+enc shrd(REG16 a,REG16 b,byte c){return x86(1310,a,b,(IMM)c);}
+enc shrd(REG16 a,AX b,byte c){return x86(1310,a,b,(IMM)c);}
+enc shrd(REG16 a,DX b,byte c){return x86(1310,a,b,(IMM)c);}
+enc shrd(REG16 a,CX b,byte c){return x86(1310,a,b,(IMM)c);}
+enc shrd(AX a,REG16 b,byte c){return x86(1310,a,b,(IMM)c);}
+enc shrd(DX a,REG16 b,byte c){return x86(1310,a,b,(IMM)c);}
+enc shrd(CX a,REG16 b,byte c){return x86(1310,a,b,(IMM)c);}
+enc shrd(MEM16 a,REG16 b,byte c){return x86(1310,a,b,(IMM)c);}
+enc shrd(MEM16 a,AX b,byte c){return x86(1310,a,b,(IMM)c);}
+enc shrd(MEM16 a,DX b,byte c){return x86(1310,a,b,(IMM)c);}
+enc shrd(MEM16 a,CX b,byte c){return x86(1310,a,b,(IMM)c);}
+enc shrd(R_M16 a,REG16 b,byte c){return x86(1310,a,b,(IMM)c);}
+enc shrd(R_M16 a,AX b,byte c){return x86(1310,a,b,(IMM)c);}
+enc shrd(R_M16 a,DX b,byte c){return x86(1310,a,b,(IMM)c);}
+enc shrd(R_M16 a,CX b,byte c){return x86(1310,a,b,(IMM)c);}
+enc shrd(REG32 a,REG32 b,byte c){return x86(1311,a,b,(IMM)c);}
+enc shrd(REG32 a,EAX b,byte c){return x86(1311,a,b,(IMM)c);}
+enc shrd(REG32 a,ECX b,byte c){return x86(1311,a,b,(IMM)c);}
+enc shrd(EAX a,REG32 b,byte c){return x86(1311,a,b,(IMM)c);}
+enc shrd(ECX a,REG32 b,byte c){return x86(1311,a,b,(IMM)c);}
+enc shrd(MEM32 a,REG32 b,byte c){return x86(1311,a,b,(IMM)c);}
+enc shrd(MEM32 a,EAX b,byte c){return x86(1311,a,b,(IMM)c);}
+enc shrd(MEM32 a,ECX b,byte c){return x86(1311,a,b,(IMM)c);}
+enc shrd(R_M32 a,REG32 b,byte c){return x86(1311,a,b,(IMM)c);}
+enc shrd(R_M32 a,EAX b,byte c){return x86(1311,a,b,(IMM)c);}
+enc shrd(R_M32 a,ECX b,byte c){return x86(1311,a,b,(IMM)c);}
+enc shrd(REG64 a,REG64 b,byte c){return x86(1312,a,b,(IMM)c);}
+enc shrd(REG64 a,RAX b,byte c){return x86(1312,a,b,(IMM)c);}
+enc shrd(RAX a,REG64 b,byte c){return x86(1312,a,b,(IMM)c);}
+enc shrd(MEM64 a,REG64 b,byte c){return x86(1312,a,b,(IMM)c);}
+enc shrd(MEM64 a,RAX b,byte c){return x86(1312,a,b,(IMM)c);}
+enc shrd(R_M64 a,REG64 b,byte c){return x86(1312,a,b,(IMM)c);}
+enc shrd(R_M64 a,RAX b,byte c){return x86(1312,a,b,(IMM)c);}
+enc shrd(REG16 a,REG16 b,CL c){return x86(1313,a,b,c);}
+enc shrd(MEM16 a,REG16 b,CL c){return x86(1313,a,b,c);}
+enc shrd(R_M16 a,REG16 b,CL c){return x86(1313,a,b,c);}
+enc shrd(REG32 a,REG32 b,CL c){return x86(1314,a,b,c);}
+enc shrd(MEM32 a,REG32 b,CL c){return x86(1314,a,b,c);}
+enc shrd(R_M32 a,REG32 b,CL c){return x86(1314,a,b,c);}
+enc shrd(REG64 a,REG64 b,CL c){return x86(1315,a,b,c);}
+enc shrd(MEM64 a,REG64 b,CL c){return x86(1315,a,b,c);}
+enc shrd(R_M64 a,REG64 b,CL c){return x86(1315,a,b,c);}
+enc shufpd(XMMREG a,XMMREG b,byte c){return x86(1316,a,b,(IMM)c);}
+enc shufpd(XMMREG a,MEM128 b,byte c){return x86(1316,a,b,(IMM)c);}
+enc shufpd(XMMREG a,R_M128 b,byte c){return x86(1316,a,b,(IMM)c);}
+enc shufps(XMMREG a,XMMREG b,byte c){return x86(1317,a,b,(IMM)c);}
+enc shufps(XMMREG a,MEM128 b,byte c){return x86(1317,a,b,(IMM)c);}
+enc shufps(XMMREG a,R_M128 b,byte c){return x86(1317,a,b,(IMM)c);}
+enc smint(){return x86(1318);}
+enc smintold(){return x86(1319);}
+enc sqrtpd(XMMREG a,XMMREG b){return x86(1320,a,b);}
+enc sqrtpd(XMMREG a,MEM128 b){return x86(1320,a,b);}
+enc sqrtpd(XMMREG a,R_M128 b){return x86(1320,a,b);}
+enc sqrtps(XMMREG a,XMMREG b){return x86(1321,a,b);}
+enc sqrtps(XMMREG a,MEM128 b){return x86(1321,a,b);}
+enc sqrtps(XMMREG a,R_M128 b){return x86(1321,a,b);}
+enc sqrtsd(XMMREG a,XMMREG b){return x86(1322,a,b);}
+enc sqrtsd(XMMREG a,MEM64 b){return x86(1322,a,b);}
+enc sqrtsd(XMMREG a,XMM64 b){return x86(1322,a,b);}
+enc sqrtss(XMMREG a,XMMREG b){return x86(1323,a,b);}
+enc sqrtss(XMMREG a,MEM32 b){return x86(1323,a,b);}
+enc sqrtss(XMMREG a,XMM32 b){return x86(1323,a,b);}
+enc stc(){return x86(1324);}
+enc std(){return x86(1325);}
+enc sti(){return x86(1326);}
+enc stmxcsr(MEM32 a){return x86(1327,a);}
+enc stosb(){return x86(1328);}
+enc stosd(){return x86(1329);}
+enc stosq(){return x86(1330);}
+enc stosw(){return x86(1331);}
+enc sub(REG8 a,REG8 b){return x86(1332,a,b);}
+enc sub(MEM8 a,REG8 b){return x86(1332,a,b);}
+enc sub(R_M8 a,REG8 b){return x86(1332,a,b);}
+enc sub(REG16 a,REG16 b){return x86(1333,a,b);}
+enc sub(MEM16 a,REG16 b){return x86(1333,a,b);}
+enc sub(R_M16 a,REG16 b){return x86(1333,a,b);}
+enc sub(REG32 a,REG32 b){return x86(1334,a,b);}
+enc sub(MEM32 a,REG32 b){return x86(1334,a,b);}
+enc sub(R_M32 a,REG32 b){return x86(1334,a,b);}
+enc sub(REG64 a,REG64 b){return x86(1335,a,b);}
+enc sub(MEM64 a,REG64 b){return x86(1335,a,b);}
+enc sub(R_M64 a,REG64 b){return x86(1335,a,b);}
+enc sub(REG8 a,MEM8 b){return x86(1336,a,b);}
+enc sub(REG8 a,R_M8 b){return x86(1336,a,b);}
+enc sub(REG16 a,MEM16 b){return x86(1337,a,b);}
+enc sub(REG16 a,R_M16 b){return x86(1337,a,b);}
+enc sub(REG32 a,MEM32 b){return x86(1338,a,b);}
+enc sub(REG32 a,R_M32 b){return x86(1338,a,b);}
+enc sub(REG64 a,MEM64 b){return x86(1339,a,b);}
+enc sub(REG64 a,R_M64 b){return x86(1339,a,b);}
+enc sub(REG8 a,byte b){return x86(1340,a,(IMM)b);}
+enc sub(AL a,byte b){return x86(1340,a,(IMM)b);}
+enc sub(CL a,byte b){return x86(1340,a,(IMM)b);}
+enc sub(MEM8 a,byte b){return x86(1340,a,(IMM)b);}
+enc sub(R_M8 a,byte b){return x86(1340,a,(IMM)b);}
+enc sub(REG16 a,byte b){return x86(1341,a,(IMM)b);}
+enc sub(REG16 a,word b){return x86(1341,a,(IMM)b);}
+enc sub(MEM16 a,byte b){return x86(1341,a,(IMM)b);}
+enc sub(MEM16 a,word b){return x86(1341,a,(IMM)b);}
+enc sub(R_M16 a,byte b){return x86(1341,a,(IMM)b);}
+enc sub(R_M16 a,word b){return x86(1341,a,(IMM)b);}
+enc sub(REG32 a,REF b){return x86(1342,a,b);}
+enc sub(REG32 a,dword b){return x86(1342,a,(IMM)b);}
+enc sub(MEM32 a,REF b){return x86(1342,a,b);}
+enc sub(MEM32 a,dword b){return x86(1342,a,(IMM)b);}
+enc sub(R_M32 a,REF b){return x86(1342,a,b);}
+enc sub(R_M32 a,dword b){return x86(1342,a,(IMM)b);}
+enc sub(REG64 a,REF b){return x86(1343,a,b);}
+enc sub(REG64 a,dword b){return x86(1343,a,(IMM)b);}
+enc sub(MEM64 a,REF b){return x86(1343,a,b);}
+enc sub(MEM64 a,dword b){return x86(1343,a,(IMM)b);}
+enc sub(R_M64 a,REF b){return x86(1343,a,b);}
+enc sub(R_M64 a,dword b){return x86(1343,a,(IMM)b);}
+enc subpd(XMMREG a,XMMREG b){return x86(1351,a,b);}
+enc subpd(XMMREG a,MEM128 b){return x86(1351,a,b);}
+enc subpd(XMMREG a,R_M128 b){return x86(1351,a,b);}
+enc subps(XMMREG a,XMMREG b){return x86(1352,a,b);}
+enc subps(XMMREG a,MEM128 b){return x86(1352,a,b);}
+enc subps(XMMREG a,R_M128 b){return x86(1352,a,b);}
+enc subsd(XMMREG a,XMMREG b){return x86(1353,a,b);}
+enc subsd(XMMREG a,MEM64 b){return x86(1353,a,b);}
+enc subsd(XMMREG a,XMM64 b){return x86(1353,a,b);}
+enc subss(XMMREG a,XMMREG b){return x86(1354,a,b);}
+enc subss(XMMREG a,MEM32 b){return x86(1354,a,b);}
+enc subss(XMMREG a,XMM32 b){return x86(1354,a,b);}
+enc sysenter(){return x86(1355);}
+enc test(REG8 a,REG8 b){return x86(1356,a,b);}
+enc test(MEM8 a,REG8 b){return x86(1356,a,b);}
+enc test(R_M8 a,REG8 b){return x86(1356,a,b);}
+enc test(REG16 a,REG16 b){return x86(1357,a,b);}
+enc test(MEM16 a,REG16 b){return x86(1357,a,b);}
+enc test(R_M16 a,REG16 b){return x86(1357,a,b);}
+enc test(REG32 a,REG32 b){return x86(1358,a,b);}
+enc test(MEM32 a,REG32 b){return x86(1358,a,b);}
+enc test(R_M32 a,REG32 b){return x86(1358,a,b);}
+enc test(REG64 a,REG64 b){return x86(1359,a,b);}
+enc test(MEM64 a,REG64 b){return x86(1359,a,b);}
+enc test(R_M64 a,REG64 b){return x86(1359,a,b);}
+enc test(REG8 a,byte b){return x86(1360,a,(IMM)b);}
+enc test(AL a,byte b){return x86(1360,a,(IMM)b);}
+enc test(CL a,byte b){return x86(1360,a,(IMM)b);}
+enc test(MEM8 a,byte b){return x86(1360,a,(IMM)b);}
+enc test(R_M8 a,byte b){return x86(1360,a,(IMM)b);}
+enc test(REG16 a,byte b){return x86(1361,a,(IMM)b);}
+enc test(REG16 a,word b){return x86(1361,a,(IMM)b);}
+enc test(MEM16 a,byte b){return x86(1361,a,(IMM)b);}
+enc test(MEM16 a,word b){return x86(1361,a,(IMM)b);}
+enc test(R_M16 a,byte b){return x86(1361,a,(IMM)b);}
+enc test(R_M16 a,word b){return x86(1361,a,(IMM)b);}
+enc test(REG32 a,REF b){return x86(1362,a,b);}
+enc test(REG32 a,dword b){return x86(1362,a,(IMM)b);}
+enc test(MEM32 a,REF b){return x86(1362,a,b);}
+enc test(MEM32 a,dword b){return x86(1362,a,(IMM)b);}
+enc test(R_M32 a,REF b){return x86(1362,a,b);}
+enc test(R_M32 a,dword b){return x86(1362,a,(IMM)b);}
+enc test(REG64 a,REF b){return x86(1363,a,b);}
+enc test(REG64 a,dword b){return x86(1363,a,(IMM)b);}
+enc test(MEM64 a,REF b){return x86(1363,a,b);}
+enc test(MEM64 a,dword b){return x86(1363,a,(IMM)b);}
+enc test(R_M64 a,REF b){return x86(1363,a,b);}
+enc test(R_M64 a,dword b){return x86(1363,a,(IMM)b);}
+enc ucomisd(XMMREG a,XMMREG b){return x86(1368,a,b);}
+enc ucomisd(XMMREG a,MEM64 b){return x86(1368,a,b);}
+enc ucomisd(XMMREG a,XMM64 b){return x86(1368,a,b);}
+enc ucomiss(XMMREG a,XMMREG b){return x86(1369,a,b);}
+enc ucomiss(XMMREG a,MEM32 b){return x86(1369,a,b);}
+enc ucomiss(XMMREG a,XMM32 b){return x86(1369,a,b);}
+enc ud2(){return x86(1370);}
+enc unpckhpd(XMMREG a,XMMREG b){return x86(1371,a,b);}
+enc unpckhpd(XMMREG a,MEM128 b){return x86(1371,a,b);}
+enc unpckhpd(XMMREG a,R_M128 b){return x86(1371,a,b);}
+enc unpckhps(XMMREG a,XMMREG b){return x86(1372,a,b);}
+enc unpckhps(XMMREG a,MEM128 b){return x86(1372,a,b);}
+enc unpckhps(XMMREG a,R_M128 b){return x86(1372,a,b);}
+enc unpcklpd(XMMREG a,XMMREG b){return x86(1373,a,b);}
+enc unpcklpd(XMMREG a,MEM128 b){return x86(1373,a,b);}
+enc unpcklpd(XMMREG a,R_M128 b){return x86(1373,a,b);}
+enc unpcklps(XMMREG a,XMMREG b){return x86(1374,a,b);}
+enc unpcklps(XMMREG a,MEM128 b){return x86(1374,a,b);}
+enc unpcklps(XMMREG a,R_M128 b){return x86(1374,a,b);}
+enc wait(){return x86(1375);}
+enc wrmsr(){return x86(1376);}
+enc xadd(REG8 a,REG8 b){return x86(1377,a,b);}
+enc xadd(MEM8 a,REG8 b){return x86(1377,a,b);}
+enc xadd(R_M8 a,REG8 b){return x86(1377,a,b);}
+enc xadd(REG16 a,REG16 b){return x86(1378,a,b);}
+enc xadd(MEM16 a,REG16 b){return x86(1378,a,b);}
+enc xadd(R_M16 a,REG16 b){return x86(1378,a,b);}
+enc xadd(REG32 a,REG32 b){return x86(1379,a,b);}
+enc xadd(MEM32 a,REG32 b){return x86(1379,a,b);}
+enc xadd(R_M32 a,REG32 b){return x86(1379,a,b);}
+enc xadd(REG64 a,REG64 b){return x86(1380,a,b);}
+enc xadd(MEM64 a,REG64 b){return x86(1380,a,b);}
+enc xadd(R_M64 a,REG64 b){return x86(1380,a,b);}
+enc xchg(REG8 a,REG8 b){return x86(1381,a,b);}
+enc xchg(REG8 a,MEM8 b){return x86(1381,a,b);}
+enc xchg(REG8 a,R_M8 b){return x86(1381,a,b);}
+enc xchg(REG16 a,REG16 b){return x86(1382,a,b);}
+enc xchg(REG16 a,MEM16 b){return x86(1382,a,b);}
+enc xchg(REG16 a,R_M16 b){return x86(1382,a,b);}
+enc xchg(REG32 a,REG32 b){return x86(1383,a,b);}
+enc xchg(REG32 a,MEM32 b){return x86(1383,a,b);}
+enc xchg(REG32 a,R_M32 b){return x86(1383,a,b);}
+enc xchg(REG64 a,REG64 b){return x86(1384,a,b);}
+enc xchg(REG64 a,MEM64 b){return x86(1384,a,b);}
+enc xchg(REG64 a,R_M64 b){return x86(1384,a,b);}
+enc xchg(MEM8 a,REG8 b){return x86(1385,a,b);}
+enc xchg(R_M8 a,REG8 b){return x86(1385,a,b);}
+enc xchg(MEM16 a,REG16 b){return x86(1386,a,b);}
+enc xchg(R_M16 a,REG16 b){return x86(1386,a,b);}
+enc xchg(MEM32 a,REG32 b){return x86(1387,a,b);}
+enc xchg(R_M32 a,REG32 b){return x86(1387,a,b);}
+enc xchg(MEM64 a,REG64 b){return x86(1388,a,b);}
+enc xchg(R_M64 a,REG64 b){return x86(1388,a,b);}
+enc xlatb(){return x86(1395);}
+enc xor(REG8 a,REG8 b){return x86(1396,a,b);}
+enc xor(MEM8 a,REG8 b){return x86(1396,a,b);}
+enc xor(R_M8 a,REG8 b){return x86(1396,a,b);}
+enc xor(REG16 a,REG16 b){return x86(1397,a,b);}
+enc xor(MEM16 a,REG16 b){return x86(1397,a,b);}
+enc xor(R_M16 a,REG16 b){return x86(1397,a,b);}
+enc xor(REG32 a,REG32 b){return x86(1398,a,b);}
+enc xor(MEM32 a,REG32 b){return x86(1398,a,b);}
+enc xor(R_M32 a,REG32 b){return x86(1398,a,b);}
+enc xor(REG64 a,REG64 b){return x86(1399,a,b);}
+enc xor(MEM64 a,REG64 b){return x86(1399,a,b);}
+enc xor(R_M64 a,REG64 b){return x86(1399,a,b);}
+enc xor(REG8 a,MEM8 b){return x86(1400,a,b);}
+enc xor(REG8 a,R_M8 b){return x86(1400,a,b);}
+enc xor(REG16 a,MEM16 b){return x86(1401,a,b);}
+enc xor(REG16 a,R_M16 b){return x86(1401,a,b);}
+enc xor(REG32 a,MEM32 b){return x86(1402,a,b);}
+enc xor(REG32 a,R_M32 b){return x86(1402,a,b);}
+enc xor(REG64 a,MEM64 b){return x86(1403,a,b);}
+enc xor(REG64 a,R_M64 b){return x86(1403,a,b);}
+enc xor(REG8 a,byte b){return x86(1404,a,(IMM)b);}
+enc xor(AL a,byte b){return x86(1404,a,(IMM)b);}
+enc xor(CL a,byte b){return x86(1404,a,(IMM)b);}
+enc xor(MEM8 a,byte b){return x86(1404,a,(IMM)b);}
+enc xor(R_M8 a,byte b){return x86(1404,a,(IMM)b);}
+enc xor(REG16 a,byte b){return x86(1405,a,(IMM)b);}
+enc xor(REG16 a,word b){return x86(1405,a,(IMM)b);}
+enc xor(MEM16 a,byte b){return x86(1405,a,(IMM)b);}
+enc xor(MEM16 a,word b){return x86(1405,a,(IMM)b);}
+enc xor(R_M16 a,byte b){return x86(1405,a,(IMM)b);}
+enc xor(R_M16 a,word b){return x86(1405,a,(IMM)b);}
+enc xor(REG32 a,REF b){return x86(1406,a,b);}
+enc xor(REG32 a,dword b){return x86(1406,a,(IMM)b);}
+enc xor(MEM32 a,REF b){return x86(1406,a,b);}
+enc xor(MEM32 a,dword b){return x86(1406,a,(IMM)b);}
+enc xor(R_M32 a,REF b){return x86(1406,a,b);}
+enc xor(R_M32 a,dword b){return x86(1406,a,(IMM)b);}
+enc xor(REG64 a,REF b){return x86(1407,a,b);}
+enc xor(REG64 a,dword b){return x86(1407,a,(IMM)b);}
+enc xor(MEM64 a,REF b){return x86(1407,a,b);}
+enc xor(MEM64 a,dword b){return x86(1407,a,(IMM)b);}
+enc xor(R_M64 a,REF b){return x86(1407,a,b);}
+enc xor(R_M64 a,dword b){return x86(1407,a,(IMM)b);}
+enc xorps(XMMREG a,XMMREG b){return x86(1415,a,b);}
+enc xorps(XMMREG a,MEM128 b){return x86(1415,a,b);}
+enc xorps(XMMREG a,R_M128 b){return x86(1415,a,b);}
 
 #undef enc
 
@@ -3,17 +3,124 @@
 #include "Encoding.hpp"
 #include "Error.hpp"
 #include "Linker.hpp"
+#include "DebugInfo.hpp"
+#include "Disassembler.hpp"
+#include "Statistics.hpp"
+#include "String.hpp"
 
 #include <string.h>
+#include <stdlib.h>
 
 #ifdef WIN32
 	#include <windows.h>
+	#include <io.h>
 #elif __unix__
 	#include <sys/mman.h>
+	#include <unistd.h>
+	#include <time.h>
+	#include <pthread.h>
+#endif
+
+#ifdef __linux__
+	#include <sys/syscall.h>
 #endif
 
 namespace SoftWire
 {
+	bool Loader::perfMap = false;
+	FILE *Loader::perfMapFile = 0;
+	int Loader::perfMapProcess = 0;
+	bool Loader::jitDump = false;
+	FILE *Loader::jitDumpFile = 0;
+	FILE *Loader::annotationFile = 0;
+	int Loader::annotationLine = 0;
+	int Loader::jitDumpProcess = 0;
+	unsigned __int64 Loader::codeIndex = 0;
+	bool Loader::debugger = false;
+	bool Loader::hugePages = false;
+	bool Loader::dualMapping = false;
+	Link<Loader::Arena> *Loader::arenas = 0;
+	Link<Loader::Mapping> *Loader::mappings = 0;
+	int Loader::codeBytes = 0;
+	int Loader::codePages = 0;
+	int Loader::arenaPages = 0;
+	int Loader::explicitPages = 0;
+
+	static const int hugePageSize = 2 * 1024 * 1024;
+
+	// Arenas and dual mappings are shared by loaders on all threads
+	#ifdef WIN32
+		static SRWLOCK codeLock = SRWLOCK_INIT;
+
+		static void lockCode() {AcquireSRWLockExclusive(&codeLock);}
+		static void unlockCode() {ReleaseSRWLockExclusive(&codeLock);}
+	#elif __unix__
+		static pthread_mutex_t codeLock = PTHREAD_MUTEX_INITIALIZER;
+
+		static void lockCode() {pthread_mutex_lock(&codeLock);}
+		static void unlockCode() {pthread_mutex_unlock(&codeLock);}
+	#else
+		static void lockCode() {}
+		static void unlockCode() {}
+	#endif
+
+	// Mapped code stays within 1 GB of the image, so RIP-relative references to its statics reach
+	static const int nearAttempts = 32;
+	static const size_t nearStep = 64 * 1024 * 1024;
+
+	static bool nearImage(const void *memory, size_t size)
+	{
+		__int64 start = (__int64)(size_t)memory - (__int64)(size_t)&hugePageSize;
+		__int64 end = start + (__int64)size;
+
+		return sizeof(void*) == 4 || (start > -(1 << 30) && end < (1 << 30));
+	}
+
+	static void *nearHint(int attempt, size_t size)   // 0 for any address
+	{
+		if(sizeof(void*) == 4) return 0;
+
+		size_t image = (size_t)&hugePageSize & ~(nearStep - 1);
+		size_t distance = (attempt / 2 + 1) * nearStep;
+
+		if(attempt % 2 == 0)   // Below the image first, the heap grows above it
+		{
+			return image > distance + size ? (void*)(image - distance - size) : 0;
+		}
+
+		return (void*)(image + distance);
+	}
+
+	#ifdef WIN32
+		static void *allocateNear(size_t size, DWORD type)   // 0 on failure
+		{
+			for(int attempt = 0; attempt < nearAttempts; attempt++)
+			{
+				void *memory = VirtualAlloc(nearHint(attempt, size), size, type, PAGE_EXECUTE_READWRITE);
+
+				if(memory && nearImage(memory, size)) return memory;
+				if(memory) VirtualFree(memory, 0, MEM_RELEASE);
+			}
+
+			return 0;
+		}
+	#elif __unix__
+		static void *mapNear(size_t size, int protection, int flags)   // MAP_FAILED on failure
+		{
+			for(int attempt = 0; attempt < nearAttempts; attempt++)
+			{
+				void *memory = mmap(nearHint(attempt, size), size, protection, flags, -1, 0);
+
+				if(memory == MAP_FAILED) return MAP_FAILED;
+				if(nearImage(memory, size)) return memory;
+
+				munmap(memory, size);
+			}
+
+			return MAP_FAILED;
+		}
+	#endif
+
 	Loader::Loader(const Linker &linker, bool x64) : linker(linker), x64(x64)
 	{
 		machineCode = 0;
@@ -21,6 +128,26 @@ namespace SoftWire
 		listing = 0;
 		possession = true;
 
+		loopAlignment = 0;
+		loopCrossing = false;
+		retain = false;
+		coldRoutine = false;
+
+		debugInfo = 0;
+		sourceFile = 0;
+
+		statistics = 0;
+
+		directCapacity = 0;
+		directEncoding = 0;
+		directLabels = 0;
+		fixups = 0;
+
+		relocations = 0;
+
+		labels = 0;
+		labelCount = 0;
+
 		reset();
 	}
 
@@ -28,7 +155,7 @@ namespace SoftWire
 	{
 		if(possession)
 		{
-			delete[] machineCode;
+			freeCode(machineCode);
 			machineCode = 0;
 		}
 
@@ -37,13 +164,31 @@ namespace SoftWire
 
 		delete[] listing;
 		listing = 0;
+
+		if(possession)
+		{
+			delete debugInfo;   // Acquired code stays registered
+		}
+
+		debugInfo = 0;
+
+		delete[] sourceFile;
+		sourceFile = 0;
+
+		freeDirect();
+		freeRelocations();
+		freeLabels();
 	}
 
 	void (*Loader::callable(const char *entryLabel))()
 	{
 		if(finalized) throw Error("Cannot retrieve callable from finalized code");
 
-		if(!machineCode)
+		if(directCapacity)
+		{
+			loadDirect();
+		}
+		else if(!machineCode)
 		{
 			loadCode();
 		}
@@ -53,7 +198,7 @@ namespace SoftWire
 			return (void(*)())machineCode;
 		}
 
-		const unsigned char *entryPoint = resolveLocal(entryLabel, 0);
+		const unsigned char *entryPoint = resolveLocal(entryLabel, -1);
 
 		if(!entryPoint)
 		{
@@ -65,25 +210,37 @@ namespace SoftWire
 
 	void (*Loader::finalize(const char *entryLabel))()
 	{
-		if(!machineCode)
+		if(directCapacity)
+		{
+			loadDirect();
+		}
+		else if(!machineCode)
 		{
 			loadCode();
 		}
 
 		finalized = true;
 
-		delete instructions;
-		instructions = 0;
+		if(debugger && !debugInfo)
+		{
+			registerDebugInfo();
+		}
 
-		delete[] listing;
-		listing = 0;
+		if(!retain)
+		{
+			delete instructions;
+			instructions = 0;
+
+			delete[] listing;
+			listing = 0;
+		}
 
 		if(!entryLabel)
 		{
 			return (void(*)())machineCode;
 		}
 
-		const unsigned char *entryPoint = resolveLocal(entryLabel, 0);
+		const unsigned char *entryPoint = resolveLocal(entryLabel, -1);
 
 		if(!entryPoint)
 		{
@@ -102,28 +259,74 @@ namespace SoftWire
 
 	Encoding *Loader::appendEncoding(const Encoding &encoding)
 	{
-		if(!instructions) instructions = new Instruction();
+		if(directCapacity)
+		{
+			return appendDirect(encoding);
+		}
+
+		if(!instructions)
+		{
+			instructions = new Instruction();
+		}
+
+		Encoding *tail = instructions->append(encoding);
+		tail->setCold(coldRegion);
+
+		// Node and copied strings
+		Statistics::allocation(sizeof(Instruction));
+		if(tail->getLabel()) Statistics::allocation((int)strlen(tail->getLabel()) + 1);
+		if(tail->getReference()) Statistics::allocation((int)strlen(tail->getReference()) + 1);
 
-		instructions->append(encoding);
+		if(coldRegion)
+		{
+			coldCode = true;
+		}
+
+		return tail;
+	}
 
-		return instructions->tail();
+	void Loader::cold()
+	{
+		coldRegion = true;
+	}
+
+	void Loader::hot()
+	{
+		coldRegion = false;
 	}
 
 	void Loader::loadCode(const char *entryLabel)
 	{
-		int length = codeLength() + 64;   // NOTE: Code length is not accurate due to alignment issues
+		Statistics::Scope scope(statistics, Statistics::PHASE_LOADING);
+
+		if(coldCode)
+		{
+			arrangeColdCode();
+		}
+
+		indexLabels();
+
+		int headers = 0;
+
+		if(loopAlignment)
+		{
+			headers = alignLoops();
+		}
 
-		machineCode = new unsigned char[length];
+		int length = codeLength() + 64 + headers * loopAlignment;   // NOTE: Code length is not accurate due to alignment issues
+		length += farBranches() * 16 + 16;
+
+		machineCode = allocateCode(length);
+		veneerEnd = (unsigned char*)((__int64)(machineCode + length) & ~15);
+		veneers = veneerEnd;
 		unsigned char *currentCode = machineCode;
+		int emitted = 0;
+		int eliminated = 0;
 
-		#ifdef WIN32
-			unsigned long oldProtection;
-			VirtualProtect(machineCode, length, PAGE_EXECUTE_READWRITE, &oldProtection);
-		#elif __unix__
-			mprotect(machineCode, length, PROT_READ | PROT_WRITE | PROT_EXEC);
-		#endif
+		locateLabels();
 
-		Instruction *instruction = instructions;
+		Instruction *instruction = firstInstruction();
+		int position = 0;
 
 		while(instruction)
 		{
@@ -132,184 +335,1810 @@ namespace SoftWire
 			const char *reference = encoding.getReference();
 			const char *label = encoding.getLabel();
 
-			if(reference)
-			{
-				if(encoding.relativeReference())
-				{
-					int offset = resolveReference(reference, instruction) - currentCode - encoding.length(currentCode);
-					encoding.setJumpOffset(offset);
-				}
-				else
-				{
-					int address = (int)resolveReference(reference, instruction);
+			relocate(encoding, currentCode, reference ? resolveReference(reference, position) : 0);
 
-					// Encoded as memory reference or immediate?
-					if(encoding.hasDisplacement())
-					{
-						encoding.addDisplacement(address);
-					}
-					else if(encoding.hasImmediate())
-					{
-						encoding.setImmediate(address);
-					}
-					else
-					{
-						INTERNAL_ERROR;
-					}
-				}
-			}
-			else if(encoding.hasImmediate() && encoding.relativeReference())
-			{
-				__int64 offset = encoding.getImmediate() - (__int64)currentCode - encoding.length(currentCode);
-				encoding.setCallOffset(offset);
-			}
+			int size = encoding.writeCode(currentCode + writeOffset);
 
-			if(x64 && encoding.isRipRelative())
+			if(encoding.getLabel() && size)
 			{
-				__int64 displacement = encoding.getDisplacement() - (__int64)currentCode - encoding.length(currentCode);
-				encoding.setDisplacement(displacement);
+				paddingBytes += size;
+				alignedLoops++;
 			}
 
-			currentCode += encoding.writeCode(currentCode);
+			currentCode += size;
 
-			instruction = instruction->next();
-		}
-	}
+			if(!encoding.isEmitting()) eliminated++;
+			else if(!label) emitted++;
 
-	const unsigned char *Loader::resolveReference(const char *name, const Instruction *position) const
-	{
-		const unsigned char *reference = resolveLocal(name, position);
-		
-		if(reference)
-		{
-			return reference;
+			instruction = nextInstruction(instruction);
+			position++;
 		}
-		else
+
+		codeEnd = currentCode;
+
+		if(veneers == veneerEnd)   // No stubs at the end
 		{
-			reference = resolveExternal(name);
+			trimCode(machineCode, length, codeEnd);
+			veneers = codeEnd;
+			veneerEnd = codeEnd;
 		}
 
-		if(reference)
+		countCode(machineCode, (int)(codeEnd - machineCode));
+
+		if(statistics)
 		{
-			return reference;
+			statistics->countCode(emitted, eliminated, (int)(currentCode - machineCode));
 		}
-		else
+
+		if(perfMap || jitDump)
 		{
-			throw Error("Unresolved identifier '%s'", name);
+			writeSymbols(currentCode);
 		}
 	}
 
-	const unsigned char *Loader::resolveLocal(const char *name, const Instruction *position) const
+	void Loader::writeSymbols(const unsigned char *end) const
 	{
-		const Instruction *instruction = instructions;
-
-		unsigned char *target = machineCode;
-		unsigned char *local = 0;   // Closest match before, or after position
+		lockCode();   // Records of concurrent loads must not interleave
 
-		while(instruction)
-		{
-			if(local && (instruction == position || position == 0))
-			{
-				return local;
-			}
-			else if(instruction == position)
+		#ifdef __linux__
+			if(jitDump && jitDumpProcess != getpid())
 			{
-				position = 0;   // Return first match following position
-			}
+				if(jitDumpFile) fclose(jitDumpFile);
+				if(annotationFile) fclose(annotationFile);
 
-			if(instruction->getLabel() && strcmp(instruction->getLabel(), name) == 0)
-			{
-				local = target;
+				jitDumpFile = 0;
+				annotationFile = 0;
+				annotationLine = 0;
+				jitDumpProcess = getpid();
 			}
-			else
+		#endif
+
+		char listingFile[64] = "";
+		Link<SourceLine> *lines = jitDump ? writeAnnotation(listingFile) : 0;
+
+		// Each label starts a symbol, running up to the next label producing code
+		const unsigned char *start = machineCode;
+		const char *name = "SoftWire";
+
+		for(Instruction *instruction = firstInstruction(); instruction; instruction = nextInstruction(instruction))
+		{
+			const char *label = instruction->getLabel();
+
+			if(label)
 			{
-				target += instruction->length(target);
-			}
+				const unsigned char *address = instruction->getAddress() + instruction->length(instruction->getAddress());   // After padding
 
-			instruction = instruction->next();
+				if(address > start)
+				{
+					writeSymbol(start, address, name, listingFile, lines);
+				}
+
+				start = address;
+				name = label;
+			}
 		}
 
-		if(local)
+		if(end > start)
 		{
-			return local;
+			writeSymbol(start, end, name, listingFile, lines);
 		}
 
-		return 0;
+		delete lines;
+
+		unlockCode();
 	}
 
-	const unsigned char *Loader::resolveExternal(const char *name) const
+	Link<Loader::SourceLine> *Loader::writeAnnotation(char *listingFile) const
 	{
-		return (unsigned char*)linker.resolveExternal(name);
+		#ifdef __linux__
+			snprintf(listingFile, 64, "/tmp/jit-%d.s", getpid());
+
+			if(!annotationFile)
+			{
+				annotationFile = fopen(listingFile, "w");
+			}
+
+			Annotation annotation;
+			annotation.file = annotationFile;
+			annotation.line = annotationLine;   // Routines follow each other in the file
+			annotation.lines = 0;
+
+			if(annotation.file)
+			{
+				streamListing(annotateLine, &annotation);
+				fflush(annotation.file);
+			}
+
+			annotationLine = annotation.line;
+
+			return annotation.lines;
+		#else
+			return 0;
+		#endif
 	}
 
-	int Loader::codeLength() const
+	void Loader::annotateLine(const unsigned char *address, int length, const char *text, void *data)
 	{
-		const Instruction *instruction = instructions;
-		unsigned char *end = machineCode;
+		Annotation &annotation = *(Annotation*)data;
 
-		while(instruction)
+		fprintf(annotation.file, length ? "\t%s\n" : "%s\n", text);
+		annotation.line++;
+
+		if(length)
 		{
-			end += instruction->length(end);
+			SourceLine line = {address, annotation.line};
 
-			instruction = instruction->next();
+			if(!annotation.lines) annotation.lines = new Link<SourceLine>();
+			annotation.lines->append(line);
 		}
-
-		return end - machineCode;
 	}
 
-	const char *Loader::getListing()
+	void Loader::registerDebugInfo()
 	{
-		if(!machineCode)
-		{
-			return 0;
-		}
+		const int wordSize = x64 ? 8 : 4;
+		const unsigned char *end = machineCode + codeLength();
 
-		if(listing)
+		debugInfo = new DebugInfo(x64);
+
+		// Symbols split at labels, like for perf
+		const unsigned char *start = machineCode;
+		const char *name = "SoftWire";
+
+		// Track stack pointer offset from the return address for unwinding
+		int stack = 0;
+		int frame = -1;
+		bool saved[16] = {false};
+		bool reachable = true;
+		Link<StackState> *branchStates = 0;
+
+		for(Instruction *instruction = firstInstruction(); instruction; instruction = nextInstruction(instruction))
 		{
-			return listing;
-		}
+			const unsigned char *address = instruction->getAddress();
+			const unsigned char *next = address + instruction->length(address);
+			const char *label = instruction->getLabel();
 
-		listing = new char[codeLength() * 4];
-		char *buffer = listing;
+			if(label)
+			{
+				if(next > start)
+				{
+					debugInfo->addSymbol(name, start, next);
+				}
 
-		for(Instruction *instruction = instructions; instruction; instruction = instruction->next())
+				start = next;
+				name = label;
+
+				if(!reachable)   // Only reached by jumps, take stack from the first one seen
+				{
+					for(Link<StackState> *state = branchStates; state; state = state->next())
+					{
+						if(state->label && strcmp(state->label, label) == 0)
+						{
+							if(state->stack != stack) debugInfo->addFrame(next, state->stack);
+							stack = state->stack;
+							reachable = true;
+							break;
+						}
+					}
+				}
+
+				continue;
+			}
+
+			if(!instruction->isEmitting())
+			{
+				continue;
+			}
+
+			if(instruction->getLine())
+			{
+				debugInfo->addLine(address, instruction->getLine());
+			}
+
+			if(instruction->getReference() && instruction->relativeReference())
+			{
+				StackState state = {instruction->getReference(), stack};
+
+				if(!branchStates) branchStates = new Link<StackState>();
+				branchStates->append(state);
+				Statistics::allocation(sizeof(Link<StackState>));
+			}
+
+			int previous = stack;
+			instruction->trackStack(stack, frame, wordSize);
+
+			int reg = instruction->pushedRegister();
+
+			if(reg != -1 && !saved[reg])
+			{
+				debugInfo->addSavedRegister(next, reg, stack);
+				saved[reg] = true;
+			}
+
+			if(stack != previous)
+			{
+				debugInfo->addFrame(next, stack);
+			}
+
+			reachable = instruction->fallsThrough();
+		}
+
+		if(end > start)
 		{
-			buffer += instruction->printCode(buffer);
+			debugInfo->addSymbol(name, start, end);
 		}
 
-		*(buffer - 1) = '\0';
+		delete branchStates;
 
-		return listing;
+		debugInfo->registerCode(machineCode, end, sourceFile);
 	}
 
-	void Loader::clearListing()
+	void Loader::writeSymbol(const unsigned char *start, const unsigned char *end, const char *name, const char *listingFile, const Link<SourceLine> *lines) const
 	{
-		delete[] listing;
-		listing = 0;
-	}
+		#ifdef __linux__
+			int pid = getpid();
 
-	void Loader::reset()
-	{
-		if(possession)
-		{
-			delete[] machineCode;
-			machineCode = 0;
-		}
+			if(perfMap)
+			{
+				if(perfMapFile && perfMapProcess != pid)
+				{
+					fclose(perfMapFile);
+					perfMapFile = 0;
+				}
 
-		machineCode = 0;
+				if(!perfMapFile)
+				{
+					char fileName[64];
+					snprintf(fileName, 64, "/tmp/perf-%d.map", pid);
 
-		delete instructions;
-		instructions = 0;
+					perfMapFile = fopen(fileName, "a");
+					perfMapProcess = pid;
+				}
 
-		delete[] listing;
-		listing = 0;
+				if(perfMapFile)
+				{
+					fprintf(perfMapFile, "%lx %lx %s\n", (unsigned long)start, (unsigned long)(end - start), name);
+					fflush(perfMapFile);   // perf may read it while running
+				}
+			}
 
-		possession = true;
-		finalized = false;
-	}
+			if(jitDump)
+			{
+				struct timespec time;
+				clock_gettime(CLOCK_MONOTONIC, &time);
+				unsigned __int64 timestamp = (unsigned __int64)time.tv_sec * 1000000000 + time.tv_nsec;
+
+				if(!jitDumpFile)
+				{
+					char fileName[64];
+					snprintf(fileName, 64, "/tmp/jit-%d.dump", pid);
+
+					jitDumpFile = fopen(fileName, "w+");
+
+					if(!jitDumpFile)
+					{
+						return;
+					}
+
+					// perf finds the dump through an executable mapping of it
+					mmap(0, sysconf(_SC_PAGESIZE), PROT_READ | PROT_EXEC, MAP_PRIVATE, fileno(jitDumpFile), 0);
+
+					struct
+					{
+						unsigned int magic;
+						unsigned int version;
+						unsigned int totalSize;
+						unsigned int elfMachine;
+						unsigned int pad;
+						unsigned int pid;
+						unsigned __int64 timestamp;
+						unsigned __int64 flags;
+					} header = {0x4A695444, 1, sizeof(header), x64 ? 62u : 3u, 0, (unsigned int)pid, timestamp, 0};   // EM_X86_64 or EM_386
+
+					fwrite(&header, sizeof(header), 1, jitDumpFile);
+				}
+
+				// Map instructions to the disassembly listing, must precede the code load
+				int entries = 0;
+				int fileSize = (int)strlen(listingFile) + 1;
+
+				for(const Link<SourceLine> *line = lines; line; line = line->next())
+				{
+					if(line->address >= start && line->address < end) entries++;
+				}
+
+				if(entries)
+				{
+					struct
+					{
+						unsigned int id;
+						unsigned int totalSize;
+						unsigned __int64 timestamp;
+						unsigned __int64 codeAddress;
+						unsigned __int64 entries;
+					} debugRecord = {2, 0, timestamp, (unsigned long)start, (unsigned __int64)entries};   // JIT_CODE_DEBUG_INFO
+
+					struct
+					{
+						unsigned __int64 address;
+						int line;
+						int discriminator;
+					} entry;
+
+					debugRecord.totalSize = sizeof(debugRecord) + entries * (sizeof(entry) + fileSize);
+					fwrite(&debugRecord, sizeof(debugRecord), 1, jitDumpFile);
+
+					for(const Link<SourceLine> *line = lines; line; line = line->next())
+					{
+						if(line->address >= start && line->address < end)
+						{
+							entry.address = (unsigned long)line->address;
+							entry.line = line->line;
+							entry.discriminator = 0;
+
+							fwrite(&entry, sizeof(entry), 1, jitDumpFile);
+							fwrite(listingFile, fileSize, 1, jitDumpFile);
+						}
+					}
+				}
+
+				int nameSize = (int)strlen(name) + 1;
+				int codeSize = (int)(end - start);
+
+				struct
+				{
+					unsigned int id;
+					unsigned int totalSize;
+					unsigned __int64 timestamp;
+					unsigned int pid;
+					unsigned int tid;
+					unsigned __int64 vma;
+					unsigned __int64 codeAddress;
+					unsigned __int64 codeSize;
+					unsigned __int64 codeIndex;
+				} record = {0, 0, timestamp, (unsigned int)pid, (unsigned int)syscall(SYS_gettid), (unsigned long)start, (unsigned long)start, (unsigned __int64)codeSize, codeIndex++};   // JIT_CODE_LOAD
+
+				record.totalSize = sizeof(record) + nameSize + codeSize;
+
+				fwrite(&record, sizeof(record), 1, jitDumpFile);
+				fwrite(name, nameSize, 1, jitDumpFile);
+				fwrite(start, codeSize, 1, jitDumpFile);
+				fflush(jitDumpFile);
+			}
+		#endif
+	}
+
+	int Loader::alignLoops()
+	{
+		int headers = 0;
+
+		// Targets of backward branches are loop headers
+		int position = 0;
+
+		for(Instruction *branch = firstInstruction(); branch; branch = nextInstruction(branch), position++)
+		{
+			const char *reference = branch->getReference();
+
+			if(!reference || !branch->relativeReference() || !branch->isEmitting())
+			{
+				continue;
+			}
+
+			const Label *definition = findLabel(reference, position);
+
+			if(!definition || definition->position > position)
+			{
+				continue;   // Forward branch
+			}
+
+			Instruction *header = definition->instruction;   // Closest preceding definition
+
+			int span = 0;
+
+			if(loopCrossing)
+			{
+				for(Instruction *instruction = header; instruction != branch; instruction = nextInstruction(instruction))
+				{
+					span += instruction->length(0);
+				}
+
+				span += branch->length(0);
+
+				if(span > 64)
+				{
+					continue;   // Can't fit in a cache line anyway
+				}
+			}
+
+			if(!header->getAlignment())
+			{
+				headers++;
+			}
+
+			header->setAlignment(loopAlignment, span);   // Outermost branch comes last
+		}
+
+		return headers;
+	}
+
+	void Loader::relocate(Encoding &encoding, unsigned char *currentCode, const unsigned char *target)
+	{
+		if(encoding.getReference())
+		{
+			if(encoding.relativeReference())
+			{
+				const unsigned char *next = currentCode + encoding.length(currentCode);
+				__int64 offset = target - next;
+
+				if(target < machineCode || target >= veneerEnd)
+				{
+					addRelocation(next, encoding.getReference(), target);
+				}
+
+				if(x64 && offset != (int)offset)
+				{
+					offset = veneer(target, next) - next;
+				}
+
+				encoding.setJumpOffset((int)offset);
+			}
+			else
+			{
+				__int64 address = (__int64)target;
+
+				if(target >= machineCode && target < veneerEnd && !(x64 && encoding.isRipRelative()))
+				{
+					positionDependent = true;
+				}
+
+				// Encoded as memory reference or immediate?
+				if(encoding.hasDisplacement())
+				{
+					encoding.addDisplacement(address);
+				}
+				else if(encoding.hasImmediate())
+				{
+					// Zero-extension only holds for 32-bit operands, 64-bit operands sign-extend imm32
+					bool fits = address == (int)address || (address == (unsigned int)address && !encoding.signExtendsImmediate());
+
+					if(x64 && !encoding.hasQuadImmediate() && !fits)
+					{
+						throw Error("Address of '%s' does not fit in 32-bit immediate, use a 64-bit immediate", encoding.getReference());
+					}
+
+					encoding.setImmediate(address);
+				}
+				else
+				{
+					INTERNAL_ERROR;
+				}
+			}
+		}
+		else if(encoding.hasImmediate() && encoding.relativeReference())
+		{
+			const unsigned char *next = currentCode + encoding.length(currentCode);
+			const unsigned char *destination = (const unsigned char*)encoding.getImmediate();
+			__int64 offset = destination - next;
+
+			if(destination < machineCode || destination >= veneerEnd)
+			{
+				addRelocation(next, 0, destination);
+			}
+
+			if(x64 && offset != (int)offset)
+			{
+				offset = veneer(destination, next) - next;
+			}
+
+			encoding.setCallOffset((int)offset);
+		}
+
+		if(x64 && encoding.isRipRelative())
+		{
+			const unsigned char *address = (const unsigned char*)encoding.getDisplacement();
+			__int64 displacement = encoding.getDisplacement() - (__int64)currentCode - encoding.length(currentCode);
+
+			if(address < machineCode || address >= veneerEnd)
+			{
+				positionDependent = true;
+			}
+
+			if(displacement != (int)displacement)
+			{
+				throw Error("Memory reference out of RIP-relative range, load the address with a 64-bit immediate");
+			}
+
+			encoding.setDisplacement(displacement);
+		}
+		else if(x64 && encoding.hasDisplacement() && encoding.getDisplacement() != (int)encoding.getDisplacement())
+		{
+			throw Error("Memory reference does not fit in 32-bit displacement, load the address with a 64-bit immediate");
+		}
+	}
+
+	void Loader::addRelocation(const unsigned char *next, const char *reference, const unsigned char *target)
+	{
+		Relocation relocation;
+		relocation.offset = (int)(next - 4 - machineCode);
+		relocation.reference = reference ? strdup(reference) : 0;
+		relocation.target = target;
+
+		if(!relocations) relocations = new Link<Relocation>();
+		relocations->append(relocation);
+
+		Statistics::allocation(sizeof(Link<Relocation>) + (reference ? (int)strlen(reference) + 1 : 0));
+	}
+
+	void Loader::freeRelocations()
+	{
+		for(Link<Relocation> *relocation = relocations; relocation; relocation = relocation->next())
+		{
+			delete[] relocation->reference;
+			relocation->reference = 0;
+		}
+
+		delete relocations;
+		relocations = 0;
+	}
+
+	int Loader::compareLabels(const void *a, const void *b)
+	{
+		const Label *first = (const Label*)a;
+		const Label *second = (const Label*)b;
+		int order = strcmp(first->name, second->name);
+
+		return order != 0 ? order : first->position - second->position;
+	}
+
+	void Loader::indexLabels()
+	{
+		freeLabels();
+
+		for(Instruction *instruction = firstInstruction(); instruction; instruction = nextInstruction(instruction))
+		{
+			if(instruction->getLabel()) labelCount++;
+		}
+
+		labels = new Label[labelCount];
+		Statistics::allocation(labelCount * sizeof(Label));
+		int n = 0;
+		int position = 0;
+
+		for(Instruction *instruction = firstInstruction(); instruction; instruction = nextInstruction(instruction), position++)
+		{
+			if(instruction->getLabel())
+			{
+				labels[n].name = strdup(instruction->getLabel());
+				Statistics::allocation((int)strlen(labels[n].name) + 1);
+				labels[n].position = position;
+				labels[n].instruction = instruction;
+				labels[n].address = 0;
+				n++;
+			}
+		}
+
+		qsort(labels, labelCount, sizeof(Label), compareLabels);
+	}
+
+	void Loader::locateLabels()
+	{
+		unsigned char *target = machineCode;
+		int position = 0;
+
+		for(Instruction *instruction = firstInstruction(); instruction; instruction = nextInstruction(instruction), position++)
+		{
+			target += instruction->length(target);   // Labels only take space when aligned
+
+			if(instruction->getLabel())
+			{
+				labels[lowerLabel(instruction->getLabel(), position)].address = target;
+			}
+		}
+	}
+
+	int Loader::lowerLabel(const char *name, int position) const
+	{
+		int low = 0;
+		int high = labelCount;
+
+		while(low < high)
+		{
+			int middle = (low + high) / 2;
+			int order = strcmp(labels[middle].name, name);
+
+			if(order < 0 || (order == 0 && labels[middle].position < position))
+			{
+				low = middle + 1;
+			}
+			else
+			{
+				high = middle;
+			}
+		}
+
+		return low;
+	}
+
+	const Loader::Label *Loader::findLabel(const char *name, int position) const
+	{
+		int index = lowerLabel(name, position);
+
+		if(index > 0 && strcmp(labels[index - 1].name, name) == 0)
+		{
+			return &labels[index - 1];
+		}
+
+		if(index < labelCount && strcmp(labels[index].name, name) == 0)
+		{
+			return &labels[index];
+		}
+
+		return 0;
+	}
+
+	void Loader::freeLabels()
+	{
+		for(int i = 0; i < labelCount; i++)
+		{
+			delete[] labels[i].name;
+		}
+
+		delete[] labels;
+		labels = 0;
+		labelCount = 0;
+	}
+
+	int Loader::farBranches() const
+	{
+		if(!x64)
+		{
+			return 0;
+		}
+
+		int count = 0;
+
+		for(Instruction *instruction = firstInstruction(); instruction; instruction = nextInstruction(instruction))
+		{
+			Encoding &encoding = *instruction;
+
+			if(encoding.isEmitting() && encoding.relativeReference())
+			{
+				const char *reference = encoding.getReference();
+
+				if(!reference || resolveExternal(reference))   // Absolute target or external
+				{
+					count++;
+				}
+			}
+		}
+
+		return count;
+	}
+
+	const unsigned char *Loader::veneer(const unsigned char *target, const unsigned char *limit)
+	{
+		veneerCalls++;
+
+		for(unsigned char *stub = veneers; stub < veneerEnd; stub += 16)
+		{
+			if(*(const unsigned char**)(stub + 8) == target)
+			{
+				return stub;
+			}
+		}
+
+		if(directCapacity && limit < directCode)
+		{
+			limit = directCode;   // Patching a forward reference
+		}
+
+		if(veneers - 16 < limit)
+		{
+			throw Error("No room for branch veneer");
+		}
+
+		static const unsigned char jump[8] = {0xFF, 0x25, 0x02, 0x00, 0x00, 0x00, 0xCC, 0xCC};   // JMP [RIP+2]
+
+		veneers -= 16;
+		memcpy(veneers + writeOffset, jump, 8);
+		*(const unsigned char**)(veneers + writeOffset + 8) = target;
+
+		return veneers;
+	}
+
+	void Loader::beginDirect()
+	{
+		if(!machineCode)
+		{
+			machineCode = allocateCode(directCapacity);
+			directCode = machineCode;
+			directLoaded = machineCode;
+			veneerEnd = (unsigned char*)((__int64)(machineCode + directCapacity) & ~15);
+			veneers = veneerEnd;
+
+			countCode(machineCode, directCapacity);
+		}
+	}
+
+	Encoding *Loader::appendDirect(const Encoding &encoding)
+	{
+		beginDirect();
+
+		if(!directEncoding)
+		{
+			directEncoding = new Encoding();
+		}
+
+		Encoding &current = *directEncoding;
+		current = encoding;
+		current.setAddress(directCode);
+
+		const char *label = current.getLabel();
+		const char *reference = current.getReference();
+		const unsigned char *target = reference ? resolveDirect(reference, false) : 0;
+
+		if(directCode + current.length(directCode) > veneers)
+		{
+			throw Error("Direct code exceeds %d bytes", directCapacity);
+		}
+
+		if(reference && !target)   // Forward reference
+		{
+			Fixup fixup = {new Encoding(current), directCode};
+
+			if(!fixups) fixups = new Link<Fixup>();
+			fixups->append(fixup);
+
+			Statistics::allocation(sizeof(Encoding) + sizeof(Link<Fixup>));
+		}
+		else
+		{
+			relocate(current, directCode, target);
+		}
+
+		directCode += current.writeCode(directCode + writeOffset);
+
+		if(label)
+		{
+			DirectLabel definition = {strdup(label), directCode};
+
+			if(!directLabels) directLabels = new Link<DirectLabel>();
+			directLabels->append(definition);
+
+			Statistics::allocation(sizeof(Link<DirectLabel>) + (int)strlen(label) + 1);
+
+			// Patch forward references to the first definition following them
+			for(Link<Fixup> *fixup = fixups; fixup; fixup = fixup->next())
+			{
+				if(fixup->encoding && strcmp(fixup->encoding->getReference(), label) == 0)
+				{
+					relocate(*fixup->encoding, fixup->address, directCode);
+					fixup->encoding->writeCode(fixup->address + writeOffset);
+
+					delete fixup->encoding;
+					fixup->encoding = 0;
+				}
+			}
+		}
+		else if(current.isEmitting())
+		{
+			directInstructions++;
+		}
+
+		return &current;
+	}
+
+	void Loader::appendCode(const unsigned char *code, int length)
+	{
+		if(!isDirect()) throw INTERNAL_ERROR;
+
+		beginDirect();
+
+		if(directCode + length > veneers)
+		{
+			throw Error("Direct code exceeds %d bytes", directCapacity);
+		}
+
+		memcpy(directCode + writeOffset, code, length);
+		directCode += length;
+		directInstructions++;
+	}
+
+	void Loader::loadDirect()
+	{
+		beginDirect();
+
+		for(Link<Fixup> *fixup = fixups; fixup; fixup = fixup->next())
+		{
+			if(fixup->encoding)
+			{
+				const char *reference = fixup->encoding->getReference();
+				const unsigned char *target = resolveExternal(reference);
+
+				if(!target)
+				{
+					throw Error("Unresolved identifier '%s'", reference);
+				}
+
+				relocate(*fixup->encoding, fixup->address, target);
+				fixup->encoding->writeCode(fixup->address + writeOffset);
+
+				delete fixup->encoding;
+				fixup->encoding = 0;
+			}
+		}
+
+		if(directCode == directLoaded)
+		{
+			return;
+		}
+
+		if(statistics)
+		{
+			statistics->countCode(directInstructions - directCounted, 0, (int)(directCode - directLoaded));
+		}
+
+		if(perfMap || jitDump)
+		{
+			writeSymbols(directCode);
+		}
+
+		directLoaded = directCode;
+		directCounted = directInstructions;
+	}
+
+	const unsigned char *Loader::resolveDirect(const char *name, bool first) const
+	{
+		const unsigned char *address = 0;
+
+		for(const Link<DirectLabel> *label = directLabels; label; label = label->next())
+		{
+			if(strcmp(label->name, name) == 0)
+			{
+				address = label->address;
+
+				if(first) break;
+			}
+		}
+
+		return address;
+	}
+
+	void Loader::freeDirect()
+	{
+		for(Link<DirectLabel> *label = directLabels; label; label = label->next())
+		{
+			delete[] label->name;
+			label->name = 0;
+		}
+
+		delete directLabels;
+		directLabels = 0;
+
+		for(Link<Fixup> *fixup = fixups; fixup; fixup = fixup->next())
+		{
+			delete fixup->encoding;
+			fixup->encoding = 0;
+		}
+
+		delete fixups;
+		fixups = 0;
+
+		delete directEncoding;
+		directEncoding = 0;
+
+		directCode = 0;
+		directLoaded = 0;
+		directInstructions = 0;
+		directCounted = 0;
+	}
+
+	void Loader::setDirect(int capacity)
+	{
+		if(instructions || machineCode)
+		{
+			throw Error("Direct emission must be set before the first instruction");
+		}
+
+		directCapacity = capacity;
+	}
+
+	bool Loader::isDirect() const
+	{
+		return directCapacity != 0;
+	}
+
+	unsigned char *Loader::allocateCode(int length)
+	{
+		writeOffset = 0;
+
+		#ifndef __linux__
+			if(dualMapping)
+			{
+				throw Error("Dual mapped code requires Linux");
+			}
+		#endif
+
+		if(hugePages || dualMapping)
+		{
+			unsigned char *code = hugePages ? allocateArena(length, coldRoutine) : allocateMapping(length);
+
+			if(code)
+			{
+				writeOffset = viewOffset(code);
+
+				return code;
+			}
+
+			if(dualMapping)   // Heap memory would have to be writable and executable
+			{
+				throw Error("Could not map %d bytes of code twice near the image", length);
+			}
+
+			// No arena memory left near the image, use the heap
+		}
+
+		unsigned char *code = new unsigned char[length];
+		Statistics::allocation(length);
+
+		#ifdef WIN32
+			unsigned long oldProtection;
+			VirtualProtect(code, length, PAGE_EXECUTE_READWRITE, &oldProtection);
+		#elif __unix__
+			// Whole pages, heap memory is not page aligned
+			size_t pageSize = sysconf(_SC_PAGESIZE);
+			size_t first = (size_t)code & ~(pageSize - 1);
+			size_t last = ((size_t)code + length + pageSize - 1) & ~(pageSize - 1);
+			mprotect((void*)first, last - first, PROT_READ | PROT_WRITE | PROT_EXEC);
+		#endif
+
+		return code;
+	}
+
+	unsigned char *Loader::allocateArena(int length, bool cold)
+	{
+		length = (length + 15) & ~15;
+
+		lockCode();
+
+		Arena *current = 0;   // Last one of the same hotness
+
+		for(Link<Arena> *arena = arenas; arena; arena = arena->next())
+		{
+			if(arena->cold == cold) current = arena;
+		}
+
+		if(!current || current->used + length > current->size)
+		{
+			Arena arena;
+			arena.size = (length + hugePageSize - 1) & ~(hugePageSize - 1);
+			arena.used = 0;
+			arena.cold = cold;
+			arena.writeOffset = 0;
+
+			if(dualMapping)
+			{
+				arena.base = mapTwice(arena.size, true, arena.writeOffset);
+			}
+			else
+			{
+				arena.base = mapArena(arena.size);
+			}
+
+			if(!arena.base)
+			{
+				unlockCode();
+
+				return 0;
+			}
+
+			arenaPages += arena.size / hugePageSize;
+
+			if(!arenas) arenas = new Link<Arena>();
+			current = arenas->append(arena);
+		}
+
+		unsigned char *code = current->base + current->used;
+		current->used += length;
+
+		unlockCode();
+
+		return code;
+	}
+
+	unsigned char *Loader::mapArena(int size)
+	{
+		unsigned char *base = 0;
+
+		#ifdef WIN32
+			SIZE_T largePage = GetLargePageMinimum();
+
+			if(largePage && size % largePage == 0)
+			{
+				base = (unsigned char*)allocateNear(size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES);   // Requires SeLockMemoryPrivilege
+			}
+
+			if(base)
+			{
+				explicitPages += size / hugePageSize;
+			}
+			else
+			{
+				base = (unsigned char*)allocateNear(size, MEM_RESERVE | MEM_COMMIT);
+			}
+		#elif __unix__
+			#ifdef MAP_HUGETLB
+				void *memory = mapNear(size, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB);
+
+				if(memory != MAP_FAILED)
+				{
+					base = (unsigned char*)memory;
+					explicitPages += size / hugePageSize;
+				}
+			#endif
+
+			if(!base)   // Transparent huge pages need 2 MB alignment
+			{
+				void *memory = mapNear(size + hugePageSize, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS);
+
+				if(memory != MAP_FAILED)
+				{
+					unsigned char *unaligned = (unsigned char*)memory;
+					base = (unsigned char*)(((size_t)unaligned + hugePageSize - 1) & ~(size_t)(hugePageSize - 1));
+
+					if(base > unaligned) munmap(unaligned, base - unaligned);
+					munmap(base + size, unaligned + hugePageSize - base);
+
+					#ifdef MADV_HUGEPAGE
+						madvise(base, size, MADV_HUGEPAGE);
+					#endif
+				}
+			}
+		#else
+			base = new unsigned char[size];
+		#endif
+
+		return base;
+	}
+
+	unsigned char *Loader::allocateMapping(int length)
+	{
+		Mapping mapping;
+		mapping.size = (length + 4095) & ~4095;
+		mapping.code = mapTwice(mapping.size, false, mapping.writeOffset);
+
+		if(!mapping.code)
+		{
+			return 0;
+		}
+
+		lockCode();
+
+		Link<Mapping> *freed = mappings;
+
+		while(freed && freed->code)
+		{
+			freed = freed->next();
+		}
+
+		if(freed)
+		{
+			*(Mapping*)freed = mapping;
+		}
+		else
+		{
+			if(!mappings) mappings = new Link<Mapping>();
+			mappings->append(mapping);
+		}
+
+		unlockCode();
+
+		return mapping.code;
+	}
+
+	unsigned char *Loader::mapTwice(int size, bool huge, __int64 &writeOffset)
+	{
+		#ifdef __linux__
+			#ifdef MFD_HUGETLB
+				if(huge)   // Mapping fails if the system reserved no huge pages
+				{
+					int descriptor = memfd_create("SoftWire", MFD_CLOEXEC | MFD_HUGETLB);
+					unsigned char *code = descriptor >= 0 ? mapDescriptor(descriptor, size, hugePageSize, writeOffset) : 0;
+
+					if(code)
+					{
+						explicitPages += size / hugePageSize;
+
+						return code;
+					}
+				}
+			#endif
+
+			int descriptor = memfd_create("SoftWire", MFD_CLOEXEC);
+			int alignment = huge ? hugePageSize : (int)sysconf(_SC_PAGESIZE);
+			unsigned char *code = descriptor >= 0 ? mapDescriptor(descriptor, size, alignment, writeOffset) : 0;
+
+			#ifdef MADV_HUGEPAGE
+				if(code && huge)
+				{
+					madvise(code, size, MADV_HUGEPAGE);
+				}
+			#endif
+
+			return code;
+		#else
+			return 0;
+		#endif
+	}
+
+	unsigned char *Loader::mapDescriptor(int descriptor, int size, int alignment, __int64 &writeOffset)
+	{
+		unsigned char *code = 0;
+
+		#ifdef __linux__
+			if(ftruncate(descriptor, size) == 0)
+			{
+				void *view = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+
+				// Reserve address space near the image to align the executable view
+				void *reserved = mapNear(size + alignment, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE);
+
+				if(view != MAP_FAILED && reserved != MAP_FAILED)
+				{
+					unsigned char *unaligned = (unsigned char*)reserved;
+					code = (unsigned char*)(((size_t)unaligned + alignment - 1) & ~(size_t)(alignment - 1));
+
+					if(mmap(code, size, PROT_READ | PROT_EXEC, MAP_SHARED | MAP_FIXED, descriptor, 0) == MAP_FAILED)
+					{
+						code = 0;
+					}
+					else
+					{
+						if(code > unaligned) munmap(unaligned, code - unaligned);
+						munmap(code + size, unaligned + alignment - code);
+
+						writeOffset = (unsigned char*)view - code;
+					}
+				}
+
+				if(!code)
+				{
+					if(view != MAP_FAILED) munmap(view, size);
+					if(reserved != MAP_FAILED) munmap(reserved, size + alignment);
+				}
+			}
+
+			close(descriptor);   // Mappings keep the memory
+		#endif
+
+		return code;
+	}
+
+	__int64 Loader::viewOffset(const unsigned char *code)
+	{
+		__int64 offset = 0;
+
+		lockCode();
+
+		const Arena *arena = findArena(code);
+
+		if(arena)
+		{
+			offset = arena->writeOffset;
+		}
+
+		for(Link<Mapping> *mapping = mappings; mapping && !arena; mapping = mapping->next())
+		{
+			if(mapping->code && code >= mapping->code && code < mapping->code + mapping->size)
+			{
+				offset = mapping->writeOffset;
+			}
+		}
+
+		unlockCode();
+
+		return offset;
+	}
+
+	unsigned char *Loader::writable(const void *address)
+	{
+		const unsigned char *code = (const unsigned char*)address;
+
+		return (unsigned char*)code + viewOffset(code);
+	}
+
+	void Loader::trimCode(unsigned char *code, int length, const unsigned char *end)
+	{
+		lockCode();
+
+		for(Link<Arena> *arena = arenas; arena; arena = arena->next())
+		{
+			if(arena->base + arena->used == code + ((length + 15) & ~15))   // Last allocation
+			{
+				arena->used = (int)(((end - arena->base) + 15) & ~15);
+
+				break;
+			}
+		}
+
+		unlockCode();
+	}
+
+	void Loader::freeCode(unsigned char *code)
+	{
+		lockCode();
+
+		if(findArena(code))
+		{
+			unlockCode();
+
+			return;   // Arena memory is not reclaimed
+		}
+
+		for(Link<Mapping> *mapping = mappings; mapping; mapping = mapping->next())
+		{
+			if(code && mapping->code == code)
+			{
+				#ifdef __unix__
+					munmap(code, mapping->size);
+					munmap(code + mapping->writeOffset, mapping->size);
+				#endif
+
+				mapping->code = 0;
+
+				unlockCode();
+
+				return;
+			}
+		}
+
+		unlockCode();
+
+		delete[] code;
+	}
+
+	void Loader::countCode(const unsigned char *code, int length)
+	{
+		lockCode();
+
+		codeBytes += length;
+
+		if(length > 0 && !findArena(code))   // Arena pages are counted by how full it is
+		{
+			codePages += (int)(((size_t)(code + length - 1) / 4096) - ((size_t)code / 4096) + 1);
+		}
+
+		unlockCode();
+	}
+
+	const Loader::Arena *Loader::findArena(const unsigned char *code)
+	{
+		for(Link<Arena> *arena = arenas; arena; arena = arena->next())
+		{
+			if(code >= arena->base && code < arena->base + arena->size)
+			{
+				return arena;
+			}
+		}
+
+		return 0;
+	}
+
+	void Loader::arrangeColdCode()
+	{
+		// Hot code falling through into a cold block gets a jump to it, and a cold block falling
+		// through into hot code gets a jump back. Both are only needed once cold code is moved to
+		// the end, so remove them where the preceding instruction doesn't fall through, or where a
+		// conditional branch over the cold block can be inverted to branch into it instead.
+		Instruction *previous = 0;   // Last instruction producing code, 0 after a label
+
+		for(Instruction *instruction = instructions; instruction; instruction = instruction->next())
+		{
+			Instruction *target = instruction->next();
+
+			if(instruction->isEmitting() && instruction->relativeReference() && !instruction->fallsThrough() &&
+			   instruction->getReference() && target && target->getLabel() &&
+			   strcmp(instruction->getReference(), target->getLabel()) == 0 &&
+			   instruction->isCold() != target->isCold())
+			{
+				if(previous && !previous->fallsThrough())
+				{
+					instruction->reserve();
+				}
+				else if(previous && !instruction->isCold() && previous->getReference())
+				{
+					// Skip to the hot code following the cold block
+					Instruction *continuation = target;
+
+					while(continuation && continuation->isCold())
+					{
+						continuation = continuation->next();
+					}
+
+					for(; continuation && continuation->getLabel(); continuation = continuation->next())
+					{
+						if(strcmp(continuation->getLabel(), previous->getReference()) == 0)
+						{
+							if(previous->invertBranch())
+							{
+								previous->setReference(target->getLabel());
+								instruction->reserve();
+							}
+
+							break;
+						}
+					}
+				}
+			}
+
+			if(instruction->getLabel())
+			{
+				previous = 0;   // Branch target, the jump is reached from elsewhere too
+			}
+			else if(instruction->isEmitting())
+			{
+				previous = instruction;
+			}
+		}
+	}
+
+	Loader::Instruction *Loader::firstInstruction() const
+	{
+		if(!coldCode)
+		{
+			return instructions;
+		}
+
+		for(Instruction *instruction = instructions; instruction; instruction = instruction->next())
+		{
+			if(!instruction->isCold())
+			{
+				return instruction;
+			}
+		}
+
+		return instructions;   // Only cold code
+	}
+
+	Loader::Instruction *Loader::nextInstruction(const Instruction *instruction) const
+	{
+		if(!coldCode)
+		{
+			return instruction->next();
+		}
+
+		bool cold = instruction->isCold();
+		Instruction *next = instruction->next();
+
+		while(next && next->isCold() != cold)
+		{
+			next = next->next();
+		}
+
+		if(!next && !cold)   // Hot code done, continue with cold code
+		{
+			for(next = instructions; next && !next->isCold(); next = next->next())
+			{
+			}
+		}
+
+		return next;
+	}
+
+	const unsigned char *Loader::resolveReference(const char *name, int position) const
+	{
+		const unsigned char *reference = resolveLocal(name, position);
+		
+		if(reference)
+		{
+			return reference;
+		}
+		else
+		{
+			reference = resolveExternal(name);
+		}
+
+		if(reference)
+		{
+			return reference;
+		}
+		else
+		{
+			throw Error("Unresolved identifier '%s'", name);
+		}
+	}
+
+	const unsigned char *Loader::resolveLocal(const char *name, int position) const
+	{
+		if(directCapacity)
+		{
+			return resolveDirect(name, true);
+		}
+
+		const Label *label = findLabel(name, position < 0 ? 0 : position);   // Closest match before, or after position
+
+		return label ? label->address : 0;
+	}
+
+	const unsigned char *Loader::resolveExternal(const char *name) const
+	{
+		return (unsigned char*)linker.resolveExternal(name);
+	}
+
+	int Loader::codeLength() const
+	{
+		if(directCapacity)
+		{
+			return (int)(directCode - machineCode);
+		}
+
+		const Instruction *instruction = firstInstruction();
+		unsigned char *end = machineCode;
+
+		while(instruction)
+		{
+			end += instruction->length(end);
+
+			instruction = nextInstruction(instruction);
+		}
+
+		return end - machineCode;
+	}
+
+	const char *Loader::getListing()
+	{
+		if(!machineCode || directCapacity)
+		{
+			return 0;
+		}
+
+		if(listing)
+		{
+			return listing;
+		}
+
+		Statistics::Scope scope(statistics, Statistics::PHASE_LISTING);
+
+		Disassembler disassembler(x64);
+		char line[256];
+
+		// Measure first so the listing is allocated at its exact size
+		int listingSize = 1;
+
+		for(Instruction *instruction = firstInstruction(); instruction; instruction = nextInstruction(instruction))
+		{
+			listingSize += printLine(instruction, disassembler, line);
+		}
+
+		listing = new char[listingSize];
+		Statistics::allocation(listingSize);
+		char *buffer = listing;
+
+		for(Instruction *instruction = firstInstruction(); instruction; instruction = nextInstruction(instruction))
+		{
+			buffer += printLine(instruction, disassembler, buffer);
+		}
+
+		*(buffer - 1) = '\0';
+
+		return listing;
+	}
+
+	int Loader::printLine(Instruction *instruction, Disassembler &disassembler, char *buffer)
+	{
+		const int textSize = 64;
+
+		int length = instruction->printCode(buffer);
+		const unsigned char *address = instruction->getAddress();
+		int size = instruction->length(address);
+
+		if(length > 1 && !instruction->isPseudo() && disassembler.disassemble(address, size, buffer + length, textSize) == size)
+		{
+			buffer[length - 1] = '\t';   // Decoded instruction before the newline
+			length += (int)strlen(buffer + length);
+			buffer[length++] = '\n';
+		}
+
+		return length;
+	}
+
+	void Loader::clearListing()
+	{
+		delete[] listing;
+		listing = 0;
+	}
+
+	void Loader::streamListing(ListingCallback callback, void *data) const
+	{
+		if(!machineCode || directCapacity)
+		{
+			return;
+		}
+
+		Statistics::Scope scope(statistics, Statistics::PHASE_LISTING);
+
+		Disassembler disassembler(x64);
+		char text[256];
+
+		for(Instruction *instruction = firstInstruction(); instruction; instruction = nextInstruction(instruction))
+		{
+			if(!instruction->isEmitting())
+			{
+				continue;
+			}
+
+			const unsigned char *address = instruction->getAddress();
+			int length = instruction->length(address);
+			const char *label = instruction->getLabel();
+			const char *mnemonic = instruction->getMnemonic();
+			const char *reference = instruction->getReference();
+
+			if(label)
+			{
+				if(length)
+				{
+					callback(address, length, "nop", data);   // Alignment padding
+				}
+
+				snprintf(text, 256, "%s:", label);
+				callback(address + length, 0, text, data);
+			}
+			else
+			{
+				if(!instruction->isPseudo() && disassembler.disassemble(address, length, text, 256) == length)
+				{
+					int n = (int)strlen(text);
+					if(reference) snprintf(text + n, 256 - n, " <%s>", reference);
+				}
+				else
+				{
+					if(reference) snprintf(text, 256, "%s\t%s", mnemonic ? mnemonic : "", reference);
+					else snprintf(text, 256, "%s", mnemonic ? mnemonic : "");
+				}
+
+				callback(address, length, text, data);
+			}
+		}
+	}
+
+	void Loader::writeListing(int fd) const
+	{
+		streamListing(writeLine, &fd);
+	}
+
+	void Loader::writeLine(const unsigned char *address, int length, const char *text, void *data)
+	{
+		char line[512];
+		int n = 0;
+
+		if(length)
+		{
+			n += snprintf(line + n, 64, "%p  ", address);
+
+			for(int i = 0; i < 16; i++)
+			{
+				n += snprintf(line + n, 4, i < length ? "%.2X " : "   ", i < length ? address[i] : 0);
+			}
+
+			snprintf(line + n, 256, "\t%s\n", text);
+		}
+		else
+		{
+			snprintf(line, 256, "%s\n", text);
+		}
+
+		#ifdef WIN32
+			_write(*(int*)data, line, (unsigned int)strlen(line));
+		#else
+			write(*(int*)data, line, strlen(line));
+		#endif
+	}
+
+	void Loader::retainListing(bool retain)
+	{
+		this->retain = retain;
+	}
+
+	void Loader::reset()
+	{
+		if(possession)
+		{
+			freeCode(machineCode);
+			machineCode = 0;
+		}
+
+		machineCode = 0;
+
+		delete instructions;
+		instructions = 0;
+
+		delete[] listing;
+		listing = 0;
+
+		freeDirect();
+		freeRelocations();
+		freeLabels();
+
+		if(possession)
+		{
+			delete debugInfo;
+		}
+
+		debugInfo = 0;
+
+		possession = true;
+		finalized = false;
+		coldRegion = false;
+		coldCode = false;
+
+		paddingBytes = 0;
+		alignedLoops = 0;
+
+		veneers = 0;
+		veneerEnd = 0;
+		veneerCalls = 0;
+
+		codeEnd = 0;
+		writeOffset = 0;
+		positionDependent = false;
+	}
+
+	void Loader::setLoopAlignment(int alignment, bool crossingOnly)
+	{
+		if(alignment != 0 && alignment != 16 && alignment != 32 && alignment != 64)
+		{
+			throw Error("Loop alignment should be 16, 32 or 64 bytes");
+		}
+
+		loopAlignment = alignment;
+		loopCrossing = crossingOnly;
+	}
+
+	void Loader::enablePerfMap(bool enable)
+	{
+		perfMap = enable;
+	}
+
+	void Loader::enableJitDump(bool enable)
+	{
+		jitDump = enable;
+	}
+
+	void Loader::enableDebugInfo(bool enable)
+	{
+		debugger = enable;
+	}
+
+	void Loader::enableHugePages(bool enable)
+	{
+		hugePages = enable;
+	}
+
+	void Loader::enableDualMapping(bool enable)
+	{
+		dualMapping = enable;
+	}
+
+	void Loader::setColdRoutine(bool cold)
+	{
+		coldRoutine = cold;
+	}
+
+	int Loader::getCodeBytes()
+	{
+		return codeBytes;
+	}
+
+	int Loader::getCodePages()
+	{
+		lockCode();
+
+		int pages = codePages;
+
+		for(Link<Arena> *arena = arenas; arena; arena = arena->next())
+		{
+			pages += (arena->used + 4095) / 4096;
+		}
+
+		unlockCode();
+
+		return pages;
+	}
+
+	int Loader::getHugePages()
+	{
+		return arenaPages;
+	}
+
+	int Loader::getExplicitHugePages()
+	{
+		return explicitPages;
+	}
+
+	void Loader::setSourceFile(const char *sourceFile)
+	{
+		delete[] this->sourceFile;
+		this->sourceFile = strdup(sourceFile);
+	}
+
+	void Loader::setStatistics(Statistics *statistics)
+	{
+		this->statistics = statistics;
+	}
+
+	int Loader::getPaddingBytes() const
+	{
+		return paddingBytes;
+	}
+
+	int Loader::getAlignedLoops() const
+	{
+		return alignedLoops;
+	}
+
+	int Loader::getVeneerCalls() const
+	{
+		return veneerCalls;
+	}
+
+	bool Loader::isPositionIndependent() const
+	{
+		return !positionDependent;
+	}
+
+	const unsigned char *Loader::getCode() const
+	{
+		return machineCode;
+	}
+
+	int Loader::getCodeLength() const
+	{
+		if(!machineCode)
+		{
+			return 0;
+		}
+
+		return (int)((directCapacity ? directCode : codeEnd) - machineCode);
+	}
+
+	int Loader::getRelocationCount() const
+	{
+		int count = 0;
+
+		for(Link<Relocation> *relocation = relocations; relocation; relocation = relocation->next())
+		{
+			count++;
+		}
+
+		return count;
+	}
+
+	int Loader::getRelocation(int index, const char **reference, const unsigned char **target) const
+	{
+		Link<Relocation> *relocation = relocations;
+
+		for(int i = 0; relocation && i < index; i++)
+		{
+			relocation = relocation->next();
+		}
+
+		if(index < 0 || !relocation)
+		{
+			throw INTERNAL_ERROR;
+		}
+
+		*reference = relocation->reference;
+		*target = relocation->target;
+
+		return relocation->offset;
+	}
+
+	int Loader::instructionCount()
+	{
+		if(directCapacity)
+		{
+			return directInstructions;
+		}
 
-	int Loader::instructionCount()
-	{
 		Instruction *instruction = instructions;
 
 		int count = 0;
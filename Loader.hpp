@@ -3,10 +3,18 @@
 
 #include "Link.hpp"
 
+#include <stdio.h>
+
 namespace SoftWire
 {
 	class Linker;
 	class Encoding;
+	class DebugInfo;
+	class Statistics;
+	class Disassembler;
+
+	// Called per instruction in layout order, label definitions have length 0
+	typedef void (*ListingCallback)(const unsigned char *address, int length, const char *text, void *data);
 
 	class Loader
 	{
@@ -21,8 +29,66 @@ namespace SoftWire
 
 		Encoding *appendEncoding(const Encoding &encoding);
 
+		// Code placement
+		void cold();   // Following code is rarely executed
+		void hot();    // Default
+
+		// Encode into a fixed code buffer as instructions are appended, forward references are patched
+		// once defined, or resolved externally when loaded. Instructions reserved afterwards stay in.
+		void setDirect(int capacity);   // Bytes, 0 for layout by loadCode
+		bool isDirect() const;
+		void appendCode(const unsigned char *code, int length);   // Encoded instruction, direct mode only
+
+		// Pad loop headers to alignment boundary, 0 to disable
+		void setLoopAlignment(int alignment, bool crossingOnly);
+		int getPaddingBytes() const;
+		int getAlignedLoops() const;
+
+		// Branches out of rel32 range in x86-64 mode go through a stub jumping to the full address,
+		// placed at the end of the code buffer and shared by all branches to the same target
+		int getVeneerCalls() const;
+
+		// Moving loaded code elsewhere, like into a shared cache, requires patching branches which leave it.
+		// Absolute addresses outside the code are kept as is.
+		bool isPositionIndependent() const;   // No absolute references into the code, no RIP-relative ones out of it
+		const unsigned char *getCode() const;
+		int getCodeLength() const;   // Including literals, excluding veneers
+		int getRelocationCount() const;
+		int getRelocation(int index, const char **reference, const unsigned char **target) const;   // Offset of rel32, reference 0 if absolute
+
+		// Symbols for Linux perf, written when code is loaded
+		static void enablePerfMap(bool enable);   // /tmp/perf-<pid>.map
+		static void enableJitDump(bool enable);   // /tmp/jit-<pid>.dump, requires perf record -k 1
+
+		// Executable memory from 2 MB pages shared by all routines loaded afterwards, explicit huge pages if the
+		// system reserved them, else transparent huge pages. Routines are packed densely, hot and cold ones
+		// apart, and their memory is never freed.
+		static void enableHugePages(bool enable);
+		void setColdRoutine(bool cold);   // Before loading
+
+		// Code buffers mapped twice from a Linux memfd, writable for emission and executable for running, so
+		// no page is both. Addresses in the code are those of the executable view. Also applies to the arena.
+		// Loading throws when no such mapping can be made, instead of falling back to the heap.
+		static void enableDualMapping(bool enable);
+		static unsigned char *writable(const void *address);   // Writable view of code, unchanged if single mapped
+
+		// All routines loaded so far, for i-TLB coverage
+		static int getCodeBytes();
+		static int getCodePages();   // 4 KB pages spanned, counted per routine outside the arena
+		static int getHugePages();   // Of the arena, explicit or transparent
+		static int getExplicitHugePages();
+
+		// GDB JIT interface registration on finalize
+		static void enableDebugInfo(bool enable);
+		void setSourceFile(const char *sourceFile);   // Echo file listing
+
+		void setStatistics(Statistics *statistics);   // Loading and listing phases, 0 to disable
+
 		const char *getListing();
 		void clearListing();
+		void streamListing(ListingCallback callback, void *data) const;
+		void writeListing(int fd) const;   // Address, bytes and mnemonic per line
+		void retainListing(bool retain);   // Keep instructions after finalize
 		void reset();
 		int instructionCount();
 
@@ -37,12 +103,169 @@ namespace SoftWire
 		const bool x64;   // Long mode
 		bool possession;
 		bool finalized;
+		bool retain;
+		bool coldRegion;   // Currently appending cold code
+		bool coldCode;     // Any cold code present
+		bool coldRoutine;  // Placed with rarely executed routines in the arena
+
+		int loopAlignment;
+		bool loopCrossing;   // Only align loops which would straddle a cache line
+		int paddingBytes;
+		int alignedLoops;
+
+		unsigned char *veneers;   // Lowest stub, allocated downward from veneerEnd
+		unsigned char *veneerEnd;
+		int veneerCalls;
+
+		struct Relocation
+		{
+			int offset;   // Of rel32 field
+			char *reference;
+			const unsigned char *target;
+		};
+
+		unsigned char *codeEnd;   // Layout mode
+		__int64 writeOffset;      // Of writable view from executable view, 0 if single mapped
+		Link<Relocation> *relocations;
+		bool positionDependent;
+
+		struct Label
+		{
+			char *name;
+			int position;   // In layout order
+			Instruction *instruction;   // While loading
+			const unsigned char *address;   // 0 until the code is allocated
+		};
+
+		Label *labels;   // Sorted by name and position, built once per load
+		int labelCount;
+
+		static bool perfMap;
+		static FILE *perfMapFile;
+		static int perfMapProcess;   // Reopened in forked children
+		static bool jitDump;
+		static FILE *jitDumpFile;
+		static FILE *annotationFile;   // Disassembly of all routines, the source for perf annotate
+		static int annotationLine;
+		static int jitDumpProcess;   // Both reopened in forked children
+		static unsigned __int64 codeIndex;
+
+		struct Arena
+		{
+			unsigned char *base;
+			int size;
+			int used;
+			bool cold;
+			__int64 writeOffset;
+		};
+
+		struct Mapping   // Dual mapped buffer outside the arena
+		{
+			unsigned char *code;   // 0 once freed
+			int size;
+			__int64 writeOffset;
+		};
+
+		static bool hugePages;
+		static bool dualMapping;
+		static Link<Arena> *arenas;
+		static Link<Mapping> *mappings;
+		static int codeBytes;
+		static int codePages;
+		static int arenaPages;
+		static int explicitPages;
+
+		static bool debugger;
+		DebugInfo *debugInfo;
+		char *sourceFile;
+
+		Statistics *statistics;
+
+		struct DirectLabel
+		{
+			char *name;
+			const unsigned char *address;
+		};
+
+		struct Fixup
+		{
+			Encoding *encoding;   // Unresolved copy, 0 once patched
+			unsigned char *address;
+		};
+
+		int directCapacity;
+		unsigned char *directCode;     // Next instruction
+		unsigned char *directLoaded;   // End of code already made available
+		int directInstructions;
+		int directCounted;
+		Encoding *directEncoding;   // Last appended
+		Link<DirectLabel> *directLabels;
+		Link<Fixup> *fixups;
+
+		struct StackState
+		{
+			const char *label;
+			int stack;
+		};
+
+		struct SourceLine
+		{
+			const unsigned char *address;
+			int line;
+		};
+
+		struct Annotation
+		{
+			FILE *file;
+			int line;
+			Link<SourceLine> *lines;
+		};
 
 		void loadCode(const char *entryLabel = 0);
-		const unsigned char *resolveReference(const char *name, const Instruction *position) const;
-		const unsigned char *resolveLocal(const char *name, const Instruction *position) const;
+		void relocate(Encoding &encoding, unsigned char *address, const unsigned char *target);   // Target of reference
+		int farBranches() const;   // Possibly needing a veneer
+		const unsigned char *veneer(const unsigned char *target, const unsigned char *limit);   // Stub above limit
+		void addRelocation(const unsigned char *next, const char *reference, const unsigned char *target);   // Branch ending at next
+		void freeRelocations();
+		static int compareLabels(const void *a, const void *b);   // By name and position
+		void indexLabels();
+		void locateLabels();
+		int lowerLabel(const char *name, int position) const;   // First not ordered before name and position
+		const Label *findLabel(const char *name, int position) const;   // Closest before position, or first after
+		void freeLabels();
+		void beginDirect();
+		Encoding *appendDirect(const Encoding &encoding);
+		void loadDirect();
+		const unsigned char *resolveDirect(const char *name, bool first) const;   // Latest or first definition
+		void freeDirect();
+		void arrangeColdCode();
+		int alignLoops();
+		void writeSymbols(const unsigned char *end) const;
+		void writeSymbol(const unsigned char *start, const unsigned char *end, const char *name, const char *listingFile, const Link<SourceLine> *lines) const;
+		Link<SourceLine> *writeAnnotation(char *listingFile) const;   // Appends disassembly as source for perf annotate
+		void registerDebugInfo();
+		Instruction *firstInstruction() const;   // In layout order
+		Instruction *nextInstruction(const Instruction *instruction) const;
+		const unsigned char *resolveReference(const char *name, int position) const;
+		const unsigned char *resolveLocal(const char *name, int position) const;   // Position in layout order, -1 for first definition
 		const unsigned char *resolveExternal(const char *name) const;
 		int codeLength() const;
+
+		unsigned char *allocateCode(int length);   // Executable
+		static unsigned char *allocateArena(int length, bool cold);   // 0 when out of memory near the image
+		static unsigned char *allocateMapping(int length);
+		static unsigned char *mapArena(int size);   // Single mapped, 0 on failure
+		static unsigned char *mapTwice(int size, bool huge, __int64 &writeOffset);   // Executable view, 0 on failure
+		static unsigned char *mapDescriptor(int descriptor, int size, int alignment, __int64 &writeOffset);   // Closes descriptor, 0 on failure
+		static __int64 viewOffset(const unsigned char *code);   // Of writable view
+		static void trimCode(unsigned char *code, int length, const unsigned char *end);   // Return unused tail to arena
+		static void freeCode(unsigned char *code);
+		static void countCode(const unsigned char *code, int length);
+		static const Arena *findArena(const unsigned char *code);
+
+		static int printLine(Instruction *instruction, Disassembler &disassembler, char *buffer);   // At most 128 characters
+		static void writeLine(const unsigned char *address, int length, const char *text, void *data);
+		static void annotateLine(const unsigned char *address, int length, const char *text, void *data);
 	};
 }
 
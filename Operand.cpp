@@ -83,6 +83,10 @@ namespace SoftWire
 			{
 				return reference;
 			}
+			else if(type == OPERAND_IMM64)
+			{
+				snprintf(string, 255, "0x%0.8X%0.8X", (unsigned int)(quad >> 32), (unsigned int)quad);
+			}
 			else
 			{
 				if(value <= 127 && value >= -128)
@@ -176,11 +180,15 @@ namespace SoftWire
 				{
 					if(displacement <= 32767 && displacement >= -32768)
 					{
-						snprintf(string, 255, "%s%d", string, displacement);
+						snprintf(string, 255, "%s%d", string, (int)displacement);
+					}
+					else if(displacement >> 32 && displacement >> 32 != -1)
+					{
+						snprintf(string, 255, "%s0x%X%0.8X", string, (unsigned int)(displacement >> 32), (unsigned int)displacement);
 					}
 					else
 					{					
-						snprintf(string, 255, "%s0x%0.8X", string, displacement);
+						snprintf(string, 255, "%s0x%0.8X", string, (unsigned int)displacement);
 					}
 				}
 			}
@@ -202,7 +210,7 @@ namespace SoftWire
 
 	bool Operand::isImm(Type type)
 	{
-		return (type & OPERAND_IMM) == type;
+		return (type & OPERAND_IMM) == type || type == OPERAND_IMM64;
 	}
 
 	bool Operand::isReg(Type type)
@@ -220,6 +228,25 @@ namespace SoftWire
 		return (type & OPERAND_R_M) == type;
 	}
 
+	bool Operand::isImplicit(Type type)
+	{
+		switch(type)
+		{
+		case OPERAND_AL:
+		case OPERAND_CL:
+		case OPERAND_AX:
+		case OPERAND_DX:
+		case OPERAND_CX:
+		case OPERAND_EAX:
+		case OPERAND_ECX:
+		case OPERAND_RAX:
+		case OPERAND_ST0:
+			return true;
+		default:
+			return false;
+		}
+	}
+
 	bool Operand::isVoid(const Operand &operand)
 	{
 		return isVoid(operand.type);
@@ -344,7 +371,7 @@ namespace SoftWire
 		{OPERAND_IMM8,		"imm8"},
 		{OPERAND_IMM16,		"imm16"},
 		{OPERAND_IMM32,		"imm32"},
-	//	{OPERAND_IMM64,		"imm64"},
+		{OPERAND_IMM64,		"imm64"},
 
 		{OPERAND_AL,		"AL"},
 		{OPERAND_AX,		"AX"},
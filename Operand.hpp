@@ -58,6 +58,7 @@ namespace SoftWire
 			OPERAND_IMM16	= 0x00000020 | OPERAND_IMM8 | OPERAND_EXT8 | OPERAND_ONE,
 			OPERAND_IMM32	= 0x00000040 | OPERAND_REF | OPERAND_IMM16 | OPERAND_IMM8 | OPERAND_EXT8 | OPERAND_ONE,
 			OPERAND_IMM		= OPERAND_IMM32 | OPERAND_IMM16 | OPERAND_IMM8 | OPERAND_EXT8 | OPERAND_ONE,
+			OPERAND_IMM64	= 0x02000000,   // Only for MOV reg64,imm64, never implied by a smaller immediate
 
 			OPERAND_AL		= 0x00000080,
 			OPERAND_CL		= 0x00000100,
@@ -131,11 +132,12 @@ namespace SoftWire
 			int value;     // For immediates
 			int reg;       // For registers
 			int baseReg;   // For memory references;
+			__int64 quad;  // For 64-bit immediates
 		};
 
 		int indexReg;
 		int scale;
-		int displacement;
+		__int64 displacement;   // Full address in x86-64 mode
 
 		bool operator==(Operand &op);
 		bool operator!=(Operand &op);
@@ -150,6 +152,7 @@ namespace SoftWire
 		static bool isReg(Type type);
 		static bool isMem(Type type);
 		static bool isR_M(Type type);
+		static bool isImplicit(Type type);   // Register fixed by the syntax, like AL or ST0
 
 		static bool isVoid(const Operand &operand);
 		static bool isImm(const Operand &operand);
@@ -191,6 +194,20 @@ namespace SoftWire
 		}
 	};
 
+	struct OperandREF;
+
+	struct OperandIMM64 : virtual Operand
+	{
+		explicit OperandIMM64(__int64 imm = 0)
+		{
+			type = OPERAND_IMM64;
+			quad = imm;
+			reference = 0;
+		}
+
+		explicit OperandIMM64(const OperandREF &ref);   // Pointer or label, labels resolved at load time
+	};
+
 	struct OperandREF : virtual Operand
 	{
 		OperandREF(const void *ref = 0)
@@ -199,7 +216,7 @@ namespace SoftWire
 			baseReg = Encoding::REG_UNKNOWN;
 			indexReg = Encoding::REG_UNKNOWN;
 			scale = 0;
-			displacement = (int)ref;
+			displacement = (__int64)ref;
 			reference = 0;
 		}
 
@@ -230,7 +247,7 @@ namespace SoftWire
 			returnReg.baseReg = baseReg;
 			returnReg.indexReg = indexReg;
 			returnReg.scale = scale;
-			returnReg.displacement = displacement + (int)disp;
+			returnReg.displacement = displacement + (__int64)disp;
 
 			return returnReg;
 		}
@@ -273,6 +290,13 @@ namespace SoftWire
 		}
 	};
 
+	inline OperandIMM64::OperandIMM64(const OperandREF &ref)
+	{
+		type = OPERAND_IMM64;
+		quad = ref.displacement;
+		reference = ref.reference;
+	}
+
 	struct OperandMEM : virtual Operand
 	{
 		OperandMEM()
@@ -1221,7 +1245,7 @@ namespace SoftWire
 		returnReg.baseReg = ref.baseReg;
 		returnReg.indexReg = ref.indexReg;
 		returnReg.scale = ref.scale;
-		returnReg.displacement = ref.displacement + (int)disp;
+		returnReg.displacement = ref.displacement + (__int64)disp;
 
 		return returnReg;
 	}
@@ -1294,7 +1318,7 @@ namespace SoftWire
 		returnReg.baseReg = ref.baseReg;
 		returnReg.indexReg = ref.indexReg;
 		returnReg.scale = ref.scale;
-		returnReg.displacement = ref.displacement + (int)disp;
+		returnReg.displacement = ref.displacement + (__int64)disp;
 
 		return returnReg;
 	}
@@ -1374,7 +1398,7 @@ namespace SoftWire
 		returnReg.baseReg = ref.baseReg;
 		returnReg.indexReg = ref.indexReg;
 		returnReg.scale = ref.scale;
-		returnReg.displacement = ref.displacement + (int)disp;
+		returnReg.displacement = ref.displacement + (__int64)disp;
 
 		return returnReg;
 	}
@@ -1,6 +1,7 @@
 #include "RegisterAllocator.hpp"
 
 #include "Error.hpp"
+#include "Statistics.hpp"
 
 namespace SoftWire
 {
@@ -43,6 +44,8 @@ namespace SoftWire
 
 	const OperandREG8 RegisterAllocator::r8(const OperandREF &ref, bool copy)
 	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
 		OperandREG32 reg = r32(ref, copy);
 
 		// Make sure we only have al, cl, dl or bl
@@ -88,6 +91,8 @@ namespace SoftWire
 
 	OperandREG32 RegisterAllocator::r32(const OperandREF &ref, bool copy, int partial)
 	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
 		if(ref == 0 && copy) throw Error("Cannot dereference 0");
 
 		// Check if already allocated
@@ -197,6 +202,8 @@ namespace SoftWire
 
 	OperandR_M32 RegisterAllocator::m32(const OperandREF &ref, int partial)
 	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
 		if(ref == 0) throw Error("Cannot dereference 0");
 
 		// Check if already allocated
@@ -256,7 +263,10 @@ namespace SoftWire
 		{
 			     if(partial == 1) loadInstruction = mov(OperandREG8(i), byte_ptr [ref]);
 			else if(partial == 2) loadInstruction = mov(OperandREG16(i), word_ptr [ref]); 
+			else if(partial == 8) loadInstruction = mov(OperandREG64(i), qword_ptr [ref]);
 			else                  loadInstruction = mov(OperandREG32(i), dword_ptr [ref]);
+
+			if(statistics) statistics->countReload();
 		}
 
 		GPR[i].loadInstruction = loadInstruction;
@@ -329,7 +339,10 @@ namespace SoftWire
 		{
 			     if(GPR[i].partial == 1) spillInstruction = mov(byte_ptr [GPR[i].reference], OperandREG8(i));
 			else if(GPR[i].partial == 2) spillInstruction = mov(word_ptr [GPR[i].reference], OperandREG16(i));
+			else if(GPR[i].partial == 8) spillInstruction = mov(qword_ptr [GPR[i].reference], OperandREG64(i));
 			else                         spillInstruction = mov(dword_ptr [GPR[i].reference], OperandREG32(i));
+
+			if(statistics) statistics->countSpill();
 		}
 
 		GPR[i].free();
@@ -339,16 +352,22 @@ namespace SoftWire
 
 	void RegisterAllocator::free(const OperandREG32 &r32)
 	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
 		free32(r32.reg);
 	}
 
 	void RegisterAllocator::spill(const OperandREG32 &r32)
 	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
 		spill32(r32.reg);
 	}
 
 	OperandMMREG RegisterAllocator::r64(const OperandREF &ref, bool copy)
 	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
 		if(ref == 0 && copy) throw Error("Cannot dereference 0");
 
 		// Check if already allocated
@@ -448,6 +467,8 @@ namespace SoftWire
 
 	OperandMM64 RegisterAllocator::m64(const OperandREF &ref)
 	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
 		if(ref == 0) throw Error("Cannot dereference 0");
 
 		// Check if already allocated
@@ -501,6 +522,8 @@ namespace SoftWire
 		if(copy)
 		{
 			loadInstruction = movq(OperandMMREG(i), qword_ptr [ref]);
+
+			if(statistics) statistics->countReload();
 		}
 
 		MMX[i].loadInstruction = loadInstruction;
@@ -592,6 +615,8 @@ namespace SoftWire
 		if(MMX[i].reference != 0 && (MMX[i].modified || !dropUnmodified))
 		{
 			spillInstruction = movq(qword_ptr [MMX[i].reference], OperandMMREG(i));
+
+			if(statistics) statistics->countSpill();
 		}
 
 		MMX[i].free();
@@ -601,16 +626,22 @@ namespace SoftWire
 
 	void RegisterAllocator::free(const OperandMMREG &r64)
 	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
 		free64(r64.reg);
 	}
 
 	void RegisterAllocator::spill(const OperandMMREG &r64)
 	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
 		spill64(r64.reg);
 	}
 
 	OperandXMMREG RegisterAllocator::r128(const OperandREF &ref, bool copy, bool ss)
 	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
 		if(ref == 0 && copy) throw Error("Cannot dereference 0");
 
 		// Check if already allocated
@@ -710,6 +741,8 @@ namespace SoftWire
 
 	OperandR_M128 RegisterAllocator::m128(const OperandREF &ref, bool ss)
 	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
 		if(ref == 0) throw Error("Cannot dereference 0");
 
 		// Check if already allocated
@@ -765,6 +798,8 @@ namespace SoftWire
 		{
 			if(ss) loadInstruction = movss(OperandXMMREG(i), dword_ptr [ref]);
 			else   loadInstruction = movaps(OperandXMMREG(i), xword_ptr [ref]);
+
+			if(statistics) statistics->countReload();
 		}
 
 		XMM[i].loadInstruction = loadInstruction;
@@ -835,6 +870,8 @@ namespace SoftWire
 		{
 			if(XMM[i].partial) spillInstruction = movss(dword_ptr [XMM[i].reference], OperandXMMREG(i));
 			else               spillInstruction = movaps(xword_ptr [XMM[i].reference], OperandXMMREG(i));
+
+			if(statistics) statistics->countSpill();
 		}
 		
 		XMM[i].free();
@@ -844,11 +881,15 @@ namespace SoftWire
 
 	void RegisterAllocator::free(const OperandXMMREG &r128)
 	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
 		free128(r128.reg);
 	}
 
 	void RegisterAllocator::spill(const OperandXMMREG &r128)
 	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
 		spill128(r128.reg);
 	}
 
@@ -864,6 +905,8 @@ namespace SoftWire
 
 	void RegisterAllocator::free(const OperandREF &ref)
 	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
 		for(int i = 0; i < 8; i++)
 		{
 			if(i == Encoding::ESP || i == Encoding::EBP) continue;
@@ -893,6 +936,8 @@ namespace SoftWire
 
 	void RegisterAllocator::spill(const OperandREF &ref)
 	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
 		for(int i = 0; i < 8; i++)
 		{
 			if(i == Encoding::ESP || i == Encoding::EBP) continue;
@@ -922,6 +967,8 @@ namespace SoftWire
 
 	void RegisterAllocator::freeAll()
 	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
 		for(int i = 0; i < 8; i++)
 		{
 			if(i == Encoding::ESP || i == Encoding::EBP) continue;
@@ -942,6 +989,8 @@ namespace SoftWire
 
 	void RegisterAllocator::spillAll()
 	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
 		for(int i = 0; i < 8; i++)
 		{
 			// Prevent optimizations
@@ -968,6 +1017,8 @@ namespace SoftWire
 
 	void RegisterAllocator::spillMMX()
 	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
 		for(int i = 0; i < 8; i++)
 		{
 			spill64(i);
@@ -976,6 +1027,8 @@ namespace SoftWire
 
 	void RegisterAllocator::spillMMXcept(const OperandMMREG &r64)
 	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
 		for(int i = 0; i < 8; i++)
 		{
 			if(r64.reg != i)
@@ -1017,6 +1070,8 @@ namespace SoftWire
 
 	void RegisterAllocator::restore(const State &state)
 	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
 		if(!minimalRestore)
 		{
 			spillAll();
@@ -1070,10 +1125,40 @@ namespace SoftWire
 
 	void RegisterAllocator::exclude(const OperandREG32 &r32)
 	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
 		spill(r32);
 		prioritize32(r32.reg);
 	}
 
+	void RegisterAllocator::assign(const OperandREG32 &r32, const OperandREF &ref, int partial)
+	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
+		free(ref);
+		spill32(r32.reg);
+
+		GPR[r32.reg].reference = ref;
+		GPR[r32.reg].partial = partial;
+		GPR[r32.reg].modified = true;   // Not in memory yet
+
+		prioritize32(r32.reg);
+	}
+
+	void RegisterAllocator::assign(const OperandXMMREG &r128, const OperandREF &ref, bool ss)
+	{
+		Statistics::Scope scope(statistics, Statistics::PHASE_ALLOCATION);
+
+		free(ref);
+		spill128(r128.reg);
+
+		XMM[r128.reg].reference = ref;
+		XMM[r128.reg].partial = ss ? 4 : 0;
+		XMM[r128.reg].modified = true;   // Not in memory yet
+
+		prioritize128(r128.reg);
+	}
+
 	Encoding *RegisterAllocator::mov(OperandREG32 r32i, OperandREG32 r32j)
 	{
 		if(r32i == r32j) return 0;
@@ -1102,8 +1187,8 @@ namespace SoftWire
 			return mov;
 		}
 
-		// Attempt copy propagation
-		if(mov && copyPropagation)
+		// Attempt copy propagation, not for pointers which a 32-bit copy truncates
+		if(mov && copyPropagation && GPR[r32i.reg].partial != 8 && GPR[r32j.reg].partial != 8)
 		{
 			swap32(r32i.reg, r32j.reg);
 			GPR[r32i.reg].copyInstruction = mov;
@@ -1319,6 +1404,102 @@ namespace SoftWire
 		}
 	}
 
+	Encoding *RegisterAllocator::movss(OperandXMMREG r128i, OperandXMMREG r128j)
+	{
+		if(r128i == r128j) return 0;
+
+		// Register overwritten, when not used, eliminate load instruction
+		if(XMM[r128i.reg].loadInstruction && loadElimination)
+		{
+			XMM[r128i.reg].loadInstruction->reserve();
+			XMM[r128i.reg].loadInstruction = 0;
+		}
+
+		// Register overwritten, when not used, eliminate copy instruction
+		if(XMM[r128i.reg].copyInstruction && copyPropagation)
+		{
+			XMM[r128i.reg].copyInstruction->reserve();
+			XMM[r128i.reg].copyInstruction = 0;
+		}
+
+		Encoding *spillInstruction = XMM[r128i.reg].spillInstruction;
+		AllocationData spillAllocation = XMM[r128i.reg].spill;
+
+		Encoding *movss = Assembler::movss(r128i, r128j);
+
+		if(XMM[r128i.reg].reference == 0 || XMM[r128j.reg].reference == 0)   // Return if not in allocation table
+		{
+			return movss;
+		}
+
+		// Only the low dword is copied, so both sides have to be scalar to share a register
+		if(XMM[r128i.reg].partial == 0 || XMM[r128j.reg].partial == 0)
+		{
+			return movss;
+		}
+
+		// Attempt copy propagation
+		if(movss && copyPropagation)
+		{
+			swap128(r128i.reg, r128j.reg);
+			XMM[r128i.reg].copyInstruction = movss;
+		}
+
+		XMM[r128i.reg].spillInstruction = spillInstruction;
+		XMM[r128i.reg].spill = spillAllocation;
+
+		return movss;
+	}
+
+	Encoding *RegisterAllocator::movss(OperandXMMREG r128, OperandMEM32 m32)
+	{
+		// Register overwritten, when not used, eliminate load instruction
+		if(XMM[r128.reg].loadInstruction && loadElimination)
+		{
+			XMM[r128.reg].loadInstruction->reserve();
+			XMM[r128.reg].loadInstruction = 0;
+		}
+
+		// Register overwritten, when not used, eliminate copy instruction
+		if(XMM[r128.reg].copyInstruction && copyPropagation)
+		{
+			XMM[r128.reg].copyInstruction->reserve();
+			XMM[r128.reg].copyInstruction = 0;
+		}
+
+		Encoding *spillInstruction = XMM[r128.reg].spillInstruction;
+		AllocationData spillAllocation = XMM[r128.reg].spill;
+
+		Encoding *movss = Assembler::movss(r128, m32);
+
+		XMM[r128.reg].spillInstruction = spillInstruction;
+		XMM[r128.reg].spill = spillAllocation;
+
+		return movss;
+	}
+
+	Encoding *RegisterAllocator::movss(OperandXMMREG r128, OperandXMM32 r_m32)
+	{
+		if(r_m32.isSubtypeOf(Operand::OPERAND_XMMREG))
+		{
+			return movss(r128, (OperandXMMREG)r_m32);
+		}
+		else
+		{
+			return movss(r128, (OperandMEM32)r_m32);
+		}
+	}
+
+	void RegisterAllocator::emitDirect(int capacity)
+	{
+		if(capacity)
+		{
+			throw Error("Direct emission can't be used with register allocation");
+		}
+
+		Assembler::emitDirect(0);
+	}
+
 	void RegisterAllocator::enableAutoEMMS()
 	{
 		autoEMMS = true;
@@ -28,7 +28,7 @@ namespace SoftWire
 
 			OperandREF reference;
 			unsigned int priority;
-			int partial;   // Number of bytes used, 0/1/2 for general-purpose, 0/4 for SSE, 0 means all
+			int partial;   // Number of bytes used, 0/1/2/8 for general-purpose, 0/4 for SSE, 0 means all
 
 			Encoding *copyInstruction;
 			Encoding *loadInstruction;
@@ -104,6 +104,10 @@ namespace SoftWire
 		// Temporarily exclude register from allocation (spill, then prioritize)
 		void exclude(const OperandREG32 &r32);
 
+		// Associate register contents with a reference without loading, like arguments passed in registers
+		void assign(const OperandREG32 &r32, const OperandREF &ref, int partial = 0);
+		void assign(const OperandXMMREG &r128, const OperandREF &ref, bool ss = false);
+
 		using Assembler::mov;
 		Encoding *mov(OperandREG32 r32i, OperandREG32 r32j);
 		Encoding *mov(OperandREG32 r32, OperandMEM32 m32);
@@ -119,6 +123,14 @@ namespace SoftWire
 		Encoding *movaps(OperandXMMREG r128, OperandMEM128 m128);
 		Encoding *movaps(OperandXMMREG r128, OperandR_M128 r_m128);
 
+		using Assembler::movss;
+		Encoding *movss(OperandXMMREG r128i, OperandXMMREG r128j);
+		Encoding *movss(OperandXMMREG r128, OperandMEM32 m32);
+		Encoding *movss(OperandXMMREG r128, OperandXMM32 r_m32);
+
+		// Spills, eliminations and stack frames patch instructions after they are emitted
+		void emitDirect(int capacity = 4096);   // Throws unless capacity is 0
+
 		// Automatically emit emms when all MMX registers freed
 		void enableAutoEMMS();   // Default off
 		void disableAutoEMMS();
@@ -0,0 +1,480 @@
+#ifndef SoftWire_Static_hpp
+#define SoftWire_Static_hpp
+
+#include "CodeGenerator.hpp"
+
+namespace SoftWire
+{
+	template<class Derived, class Base>
+	struct Inherits
+	{
+		struct Other {char c[2];};
+
+		static char test(const Base*);
+		static Other test(...);
+
+		enum {value = sizeof(test((const Derived*)0)) == sizeof(char)};
+	};
+
+	// Run-time intrinsics with operands by reference and no virtual dispatch, assembled by the x86 method of Layer
+	template<class Layer>
+	class StaticIntrinsics : public Layer
+	{
+	public:
+		StaticIntrinsics(bool x64) : Layer(x64)
+		{
+		}
+
+		#define SOFTWIRE_STATIC_INTRINSICS
+		#include "Intrinsics.hpp"
+		#undef SOFTWIRE_STATIC_INTRINSICS
+
+	protected:
+		// Signatures differ from the virtual one, so calls bind to Layer at compile time
+		Encoding *x86(int instructionID)
+		{
+			return Layer::x86(instructionID, Operand::OPERAND_VOID, Operand::OPERAND_VOID, Operand::OPERAND_VOID);
+		}
+
+		Encoding *x86(int instructionID, const Operand &firstOperand)
+		{
+			return Layer::x86(instructionID, firstOperand, Operand::OPERAND_VOID, Operand::OPERAND_VOID);
+		}
+
+		Encoding *x86(int instructionID, const Operand &firstOperand, const Operand &secondOperand)
+		{
+			return Layer::x86(instructionID, firstOperand, secondOperand, Operand::OPERAND_VOID);
+		}
+
+		template<class Third>
+		Encoding *x86(int instructionID, const Operand &firstOperand, const Operand &secondOperand, const Third &thirdOperand)
+		{
+			return Layer::x86(instructionID, firstOperand, secondOperand, thirdOperand);
+		}
+	};
+
+	// Assembler stack composed at compile time, like Static<CodeGenerator> instead of CodeGenerator. Intrinsics resolve
+	// statically and inline into client code. Those that Layer overrides for register allocation or SSE emulation
+	// are forwarded to it when it derives from RegisterAllocator or Emulator, and emulation is enabled.
+	template<class Layer>
+	class Static : public StaticIntrinsics<Layer>
+	{
+		typedef StaticIntrinsics<Layer> Base;
+
+	public:
+		Static(bool x64) : Base(x64)
+		{
+		}
+
+		using Base::addps;
+		Encoding *addps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::addps(a, b) : Base::addps(a, b);}
+		Encoding *addps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::addps(a, b) : Base::addps(a, b);}
+		Encoding *addps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::addps(a, b) : Base::addps(a, b);}
+
+		using Base::addss;
+		Encoding *addss(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::addss(a, b) : Base::addss(a, b);}
+		Encoding *addss(const OperandXMMREG &a, const OperandMEM32 &b) {return emulate() ? Layer::addss(a, b) : Base::addss(a, b);}
+		Encoding *addss(const OperandXMMREG &a, const OperandXMM32 &b) {return emulate() ? Layer::addss(a, b) : Base::addss(a, b);}
+
+		using Base::andnps;
+		Encoding *andnps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::andnps(a, b) : Base::andnps(a, b);}
+		Encoding *andnps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::andnps(a, b) : Base::andnps(a, b);}
+		Encoding *andnps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::andnps(a, b) : Base::andnps(a, b);}
+
+		using Base::andps;
+		Encoding *andps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::andps(a, b) : Base::andps(a, b);}
+		Encoding *andps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::andps(a, b) : Base::andps(a, b);}
+		Encoding *andps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::andps(a, b) : Base::andps(a, b);}
+
+		using Base::cmpeqps;
+		Encoding *cmpeqps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::cmpeqps(a, b) : Base::cmpeqps(a, b);}
+		Encoding *cmpeqps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::cmpeqps(a, b) : Base::cmpeqps(a, b);}
+		Encoding *cmpeqps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::cmpeqps(a, b) : Base::cmpeqps(a, b);}
+
+		using Base::cmpeqss;
+		Encoding *cmpeqss(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::cmpeqss(a, b) : Base::cmpeqss(a, b);}
+		Encoding *cmpeqss(const OperandXMMREG &a, const OperandMEM32 &b) {return emulate() ? Layer::cmpeqss(a, b) : Base::cmpeqss(a, b);}
+		Encoding *cmpeqss(const OperandXMMREG &a, const OperandXMM32 &b) {return emulate() ? Layer::cmpeqss(a, b) : Base::cmpeqss(a, b);}
+
+		using Base::cmpleps;
+		Encoding *cmpleps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::cmpleps(a, b) : Base::cmpleps(a, b);}
+		Encoding *cmpleps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::cmpleps(a, b) : Base::cmpleps(a, b);}
+		Encoding *cmpleps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::cmpleps(a, b) : Base::cmpleps(a, b);}
+
+		using Base::cmpless;
+		Encoding *cmpless(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::cmpless(a, b) : Base::cmpless(a, b);}
+		Encoding *cmpless(const OperandXMMREG &a, const OperandMEM32 &b) {return emulate() ? Layer::cmpless(a, b) : Base::cmpless(a, b);}
+		Encoding *cmpless(const OperandXMMREG &a, const OperandXMM32 &b) {return emulate() ? Layer::cmpless(a, b) : Base::cmpless(a, b);}
+
+		using Base::cmpltps;
+		Encoding *cmpltps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::cmpltps(a, b) : Base::cmpltps(a, b);}
+		Encoding *cmpltps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::cmpltps(a, b) : Base::cmpltps(a, b);}
+		Encoding *cmpltps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::cmpltps(a, b) : Base::cmpltps(a, b);}
+
+		using Base::cmpltss;
+		Encoding *cmpltss(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::cmpltss(a, b) : Base::cmpltss(a, b);}
+		Encoding *cmpltss(const OperandXMMREG &a, const OperandMEM32 &b) {return emulate() ? Layer::cmpltss(a, b) : Base::cmpltss(a, b);}
+		Encoding *cmpltss(const OperandXMMREG &a, const OperandXMM32 &b) {return emulate() ? Layer::cmpltss(a, b) : Base::cmpltss(a, b);}
+
+		using Base::cmpneqps;
+		Encoding *cmpneqps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::cmpneqps(a, b) : Base::cmpneqps(a, b);}
+		Encoding *cmpneqps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::cmpneqps(a, b) : Base::cmpneqps(a, b);}
+		Encoding *cmpneqps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::cmpneqps(a, b) : Base::cmpneqps(a, b);}
+
+		using Base::cmpneqss;
+		Encoding *cmpneqss(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::cmpneqss(a, b) : Base::cmpneqss(a, b);}
+		Encoding *cmpneqss(const OperandXMMREG &a, const OperandMEM32 &b) {return emulate() ? Layer::cmpneqss(a, b) : Base::cmpneqss(a, b);}
+		Encoding *cmpneqss(const OperandXMMREG &a, const OperandXMM32 &b) {return emulate() ? Layer::cmpneqss(a, b) : Base::cmpneqss(a, b);}
+
+		using Base::cmpnleps;
+		Encoding *cmpnleps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::cmpnleps(a, b) : Base::cmpnleps(a, b);}
+		Encoding *cmpnleps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::cmpnleps(a, b) : Base::cmpnleps(a, b);}
+		Encoding *cmpnleps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::cmpnleps(a, b) : Base::cmpnleps(a, b);}
+
+		using Base::cmpnless;
+		Encoding *cmpnless(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::cmpnless(a, b) : Base::cmpnless(a, b);}
+		Encoding *cmpnless(const OperandXMMREG &a, const OperandMEM32 &b) {return emulate() ? Layer::cmpnless(a, b) : Base::cmpnless(a, b);}
+		Encoding *cmpnless(const OperandXMMREG &a, const OperandXMM32 &b) {return emulate() ? Layer::cmpnless(a, b) : Base::cmpnless(a, b);}
+
+		using Base::cmpnltps;
+		Encoding *cmpnltps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::cmpnltps(a, b) : Base::cmpnltps(a, b);}
+		Encoding *cmpnltps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::cmpnltps(a, b) : Base::cmpnltps(a, b);}
+		Encoding *cmpnltps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::cmpnltps(a, b) : Base::cmpnltps(a, b);}
+
+		using Base::cmpnltss;
+		Encoding *cmpnltss(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::cmpnltss(a, b) : Base::cmpnltss(a, b);}
+		Encoding *cmpnltss(const OperandXMMREG &a, const OperandMEM32 &b) {return emulate() ? Layer::cmpnltss(a, b) : Base::cmpnltss(a, b);}
+		Encoding *cmpnltss(const OperandXMMREG &a, const OperandXMM32 &b) {return emulate() ? Layer::cmpnltss(a, b) : Base::cmpnltss(a, b);}
+
+		using Base::cmpordps;
+		Encoding *cmpordps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::cmpordps(a, b) : Base::cmpordps(a, b);}
+		Encoding *cmpordps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::cmpordps(a, b) : Base::cmpordps(a, b);}
+		Encoding *cmpordps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::cmpordps(a, b) : Base::cmpordps(a, b);}
+
+		using Base::cmpordss;
+		Encoding *cmpordss(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::cmpordss(a, b) : Base::cmpordss(a, b);}
+		Encoding *cmpordss(const OperandXMMREG &a, const OperandMEM32 &b) {return emulate() ? Layer::cmpordss(a, b) : Base::cmpordss(a, b);}
+		Encoding *cmpordss(const OperandXMMREG &a, const OperandXMM32 &b) {return emulate() ? Layer::cmpordss(a, b) : Base::cmpordss(a, b);}
+
+		using Base::cmpps;
+		Encoding *cmpps(const OperandXMMREG &a, const OperandXMMREG &b, unsigned char c) {return emulate() ? Layer::cmpps(a, b, c) : Base::cmpps(a, b, c);}
+		Encoding *cmpps(const OperandXMMREG &a, const OperandMEM128 &b, unsigned char c) {return emulate() ? Layer::cmpps(a, b, c) : Base::cmpps(a, b, c);}
+		Encoding *cmpps(const OperandXMMREG &a, const OperandR_M128 &b, unsigned char c) {return emulate() ? Layer::cmpps(a, b, c) : Base::cmpps(a, b, c);}
+
+		using Base::cmpss;
+		Encoding *cmpss(const OperandXMMREG &a, const OperandXMMREG &b, unsigned char c) {return emulate() ? Layer::cmpss(a, b, c) : Base::cmpss(a, b, c);}
+		Encoding *cmpss(const OperandXMMREG &a, const OperandMEM32 &b, unsigned char c) {return emulate() ? Layer::cmpss(a, b, c) : Base::cmpss(a, b, c);}
+		Encoding *cmpss(const OperandXMMREG &a, const OperandXMM32 &b, unsigned char c) {return emulate() ? Layer::cmpss(a, b, c) : Base::cmpss(a, b, c);}
+
+		using Base::cmpunordps;
+		Encoding *cmpunordps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::cmpunordps(a, b) : Base::cmpunordps(a, b);}
+		Encoding *cmpunordps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::cmpunordps(a, b) : Base::cmpunordps(a, b);}
+		Encoding *cmpunordps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::cmpunordps(a, b) : Base::cmpunordps(a, b);}
+
+		using Base::cmpunordss;
+		Encoding *cmpunordss(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::cmpunordss(a, b) : Base::cmpunordss(a, b);}
+		Encoding *cmpunordss(const OperandXMMREG &a, const OperandMEM32 &b) {return emulate() ? Layer::cmpunordss(a, b) : Base::cmpunordss(a, b);}
+		Encoding *cmpunordss(const OperandXMMREG &a, const OperandXMM32 &b) {return emulate() ? Layer::cmpunordss(a, b) : Base::cmpunordss(a, b);}
+
+		using Base::comiss;
+		Encoding *comiss(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::comiss(a, b) : Base::comiss(a, b);}
+		Encoding *comiss(const OperandXMMREG &a, const OperandMEM32 &b) {return emulate() ? Layer::comiss(a, b) : Base::comiss(a, b);}
+		Encoding *comiss(const OperandXMMREG &a, const OperandXMM32 &b) {return emulate() ? Layer::comiss(a, b) : Base::comiss(a, b);}
+
+		using Base::cvtpi2ps;
+		Encoding *cvtpi2ps(const OperandXMMREG &a, const OperandMMREG &b) {return emulate() ? Layer::cvtpi2ps(a, b) : Base::cvtpi2ps(a, b);}
+		Encoding *cvtpi2ps(const OperandXMMREG &a, const OperandMEM64 &b) {return emulate() ? Layer::cvtpi2ps(a, b) : Base::cvtpi2ps(a, b);}
+		Encoding *cvtpi2ps(const OperandXMMREG &a, const OperandMM64 &b) {return emulate() ? Layer::cvtpi2ps(a, b) : Base::cvtpi2ps(a, b);}
+
+		using Base::cvtps2pi;
+		Encoding *cvtps2pi(const OperandMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::cvtps2pi(a, b) : Base::cvtps2pi(a, b);}
+		Encoding *cvtps2pi(const OperandMMREG &a, const OperandMEM64 &b) {return emulate() ? Layer::cvtps2pi(a, b) : Base::cvtps2pi(a, b);}
+		Encoding *cvtps2pi(const OperandMMREG &a, const OperandXMM64 &b) {return emulate() ? Layer::cvtps2pi(a, b) : Base::cvtps2pi(a, b);}
+
+		using Base::cvtsi2ss;
+		Encoding *cvtsi2ss(const OperandXMMREG &a, const OperandREG32 &b) {return emulate() ? Layer::cvtsi2ss(a, b) : Base::cvtsi2ss(a, b);}
+		Encoding *cvtsi2ss(const OperandXMMREG &a, const OperandMEM32 &b) {return emulate() ? Layer::cvtsi2ss(a, b) : Base::cvtsi2ss(a, b);}
+		Encoding *cvtsi2ss(const OperandXMMREG &a, const OperandR_M32 &b) {return emulate() ? Layer::cvtsi2ss(a, b) : Base::cvtsi2ss(a, b);}
+
+		using Base::cvtss2si;
+		Encoding *cvtss2si(const OperandREG32 &a, const OperandXMMREG &b) {return emulate() ? Layer::cvtss2si(a, b) : Base::cvtss2si(a, b);}
+		Encoding *cvtss2si(const OperandREG32 &a, const OperandMEM32 &b) {return emulate() ? Layer::cvtss2si(a, b) : Base::cvtss2si(a, b);}
+		Encoding *cvtss2si(const OperandREG32 &a, const OperandXMM32 &b) {return emulate() ? Layer::cvtss2si(a, b) : Base::cvtss2si(a, b);}
+
+		using Base::cvttps2pi;
+		Encoding *cvttps2pi(const OperandMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::cvttps2pi(a, b) : Base::cvttps2pi(a, b);}
+		Encoding *cvttps2pi(const OperandMMREG &a, const OperandMEM64 &b) {return emulate() ? Layer::cvttps2pi(a, b) : Base::cvttps2pi(a, b);}
+		Encoding *cvttps2pi(const OperandMMREG &a, const OperandXMM64 &b) {return emulate() ? Layer::cvttps2pi(a, b) : Base::cvttps2pi(a, b);}
+
+		using Base::cvttss2si;
+		Encoding *cvttss2si(const OperandREG32 &a, const OperandXMMREG &b) {return emulate() ? Layer::cvttss2si(a, b) : Base::cvttss2si(a, b);}
+		Encoding *cvttss2si(const OperandREG32 &a, const OperandMEM32 &b) {return emulate() ? Layer::cvttss2si(a, b) : Base::cvttss2si(a, b);}
+		Encoding *cvttss2si(const OperandREG32 &a, const OperandXMM32 &b) {return emulate() ? Layer::cvttss2si(a, b) : Base::cvttss2si(a, b);}
+
+		using Base::divps;
+		Encoding *divps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::divps(a, b) : Base::divps(a, b);}
+		Encoding *divps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::divps(a, b) : Base::divps(a, b);}
+		Encoding *divps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::divps(a, b) : Base::divps(a, b);}
+
+		using Base::divss;
+		Encoding *divss(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::divss(a, b) : Base::divss(a, b);}
+		Encoding *divss(const OperandXMMREG &a, const OperandMEM32 &b) {return emulate() ? Layer::divss(a, b) : Base::divss(a, b);}
+		Encoding *divss(const OperandXMMREG &a, const OperandXMM32 &b) {return emulate() ? Layer::divss(a, b) : Base::divss(a, b);}
+
+		using Base::ldmxcsr;
+		Encoding *ldmxcsr(const OperandMEM32 &a) {return emulate() ? Layer::ldmxcsr(a) : Base::ldmxcsr(a);}
+
+		using Base::maskmovq;
+		Encoding *maskmovq(const OperandMMREG &a, const OperandMMREG &b) {return emulate() ? Layer::maskmovq(a, b) : Base::maskmovq(a, b);}
+
+		using Base::maxps;
+		Encoding *maxps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::maxps(a, b) : Base::maxps(a, b);}
+		Encoding *maxps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::maxps(a, b) : Base::maxps(a, b);}
+		Encoding *maxps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::maxps(a, b) : Base::maxps(a, b);}
+
+		using Base::maxss;
+		Encoding *maxss(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::maxss(a, b) : Base::maxss(a, b);}
+		Encoding *maxss(const OperandXMMREG &a, const OperandMEM32 &b) {return emulate() ? Layer::maxss(a, b) : Base::maxss(a, b);}
+		Encoding *maxss(const OperandXMMREG &a, const OperandXMM32 &b) {return emulate() ? Layer::maxss(a, b) : Base::maxss(a, b);}
+
+		using Base::minps;
+		Encoding *minps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::minps(a, b) : Base::minps(a, b);}
+		Encoding *minps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::minps(a, b) : Base::minps(a, b);}
+		Encoding *minps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::minps(a, b) : Base::minps(a, b);}
+
+		using Base::minss;
+		Encoding *minss(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::minss(a, b) : Base::minss(a, b);}
+		Encoding *minss(const OperandXMMREG &a, const OperandMEM32 &b) {return emulate() ? Layer::minss(a, b) : Base::minss(a, b);}
+		Encoding *minss(const OperandXMMREG &a, const OperandXMM32 &b) {return emulate() ? Layer::minss(a, b) : Base::minss(a, b);}
+
+		using Base::mov;
+		Encoding *mov(const OperandREG32 &a, const OperandREG32 &b) {return allocate() ? Layer::mov(a, b) : Base::mov(a, b);}
+		Encoding *mov(const OperandREG32 &a, const OperandMEM32 &b) {return allocate() ? Layer::mov(a, b) : Base::mov(a, b);}
+		Encoding *mov(const OperandREG32 &a, const OperandR_M32 &b) {return allocate() ? Layer::mov(a, b) : Base::mov(a, b);}
+
+		using Base::movaps;
+		Encoding *movaps(const OperandXMMREG &a, const OperandXMMREG &b) {return allocate() ? Layer::movaps(a, b) : Base::movaps(a, b);}
+		Encoding *movaps(const OperandXMMREG &a, const OperandMEM128 &b) {return allocate() ? Layer::movaps(a, b) : Base::movaps(a, b);}
+		Encoding *movaps(const OperandXMMREG &a, const OperandR_M128 &b) {return allocate() ? Layer::movaps(a, b) : Base::movaps(a, b);}
+		Encoding *movaps(const OperandMEM128 &a, const OperandXMMREG &b) {return emulate() ? Layer::movaps(a, b) : Base::movaps(a, b);}
+		Encoding *movaps(const OperandR_M128 &a, const OperandXMMREG &b) {return emulate() ? Layer::movaps(a, b) : Base::movaps(a, b);}
+
+		using Base::movhlps;
+		Encoding *movhlps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::movhlps(a, b) : Base::movhlps(a, b);}
+
+		using Base::movhps;
+		Encoding *movhps(const OperandXMMREG &a, const OperandMEM64 &b) {return emulate() ? Layer::movhps(a, b) : Base::movhps(a, b);}
+		Encoding *movhps(const OperandMEM64 &a, const OperandXMMREG &b) {return emulate() ? Layer::movhps(a, b) : Base::movhps(a, b);}
+		Encoding *movhps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::movhps(a, b) : Base::movhps(a, b);}
+
+		using Base::movlhps;
+		Encoding *movlhps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::movlhps(a, b) : Base::movlhps(a, b);}
+
+		using Base::movlps;
+		Encoding *movlps(const OperandXMMREG &a, const OperandMEM64 &b) {return emulate() ? Layer::movlps(a, b) : Base::movlps(a, b);}
+		Encoding *movlps(const OperandMEM64 &a, const OperandXMMREG &b) {return emulate() ? Layer::movlps(a, b) : Base::movlps(a, b);}
+
+		using Base::movmskps;
+		Encoding *movmskps(const OperandREG32 &a, const OperandXMMREG &b) {return emulate() ? Layer::movmskps(a, b) : Base::movmskps(a, b);}
+
+		using Base::movntps;
+		Encoding *movntps(const OperandMEM128 &a, const OperandXMMREG &b) {return emulate() ? Layer::movntps(a, b) : Base::movntps(a, b);}
+
+		using Base::movntq;
+		Encoding *movntq(const OperandMEM64 &a, const OperandMMREG &b) {return emulate() ? Layer::movntq(a, b) : Base::movntq(a, b);}
+
+		using Base::movq;
+		Encoding *movq(const OperandMMREG &a, const OperandMMREG &b) {return allocate() ? Layer::movq(a, b) : Base::movq(a, b);}
+		Encoding *movq(const OperandMMREG &a, const OperandMEM64 &b) {return allocate() ? Layer::movq(a, b) : Base::movq(a, b);}
+		Encoding *movq(const OperandMMREG &a, const OperandMM64 &b) {return allocate() ? Layer::movq(a, b) : Base::movq(a, b);}
+
+		using Base::movss;
+		Encoding *movss(const OperandXMMREG &a, const OperandXMMREG &b) {return allocate() ? Layer::movss(a, b) : Base::movss(a, b);}
+		Encoding *movss(const OperandXMMREG &a, const OperandMEM32 &b) {return allocate() ? Layer::movss(a, b) : Base::movss(a, b);}
+		Encoding *movss(const OperandXMMREG &a, const OperandXMM32 &b) {return allocate() ? Layer::movss(a, b) : Base::movss(a, b);}
+		Encoding *movss(const OperandMEM32 &a, const OperandXMMREG &b) {return emulate() ? Layer::movss(a, b) : Base::movss(a, b);}
+		Encoding *movss(const OperandXMM32 &a, const OperandXMMREG &b) {return emulate() ? Layer::movss(a, b) : Base::movss(a, b);}
+
+		using Base::movups;
+		Encoding *movups(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::movups(a, b) : Base::movups(a, b);}
+		Encoding *movups(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::movups(a, b) : Base::movups(a, b);}
+		Encoding *movups(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::movups(a, b) : Base::movups(a, b);}
+		Encoding *movups(const OperandMEM128 &a, const OperandXMMREG &b) {return emulate() ? Layer::movups(a, b) : Base::movups(a, b);}
+		Encoding *movups(const OperandR_M128 &a, const OperandXMMREG &b) {return emulate() ? Layer::movups(a, b) : Base::movups(a, b);}
+
+		using Base::mulps;
+		Encoding *mulps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::mulps(a, b) : Base::mulps(a, b);}
+		Encoding *mulps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::mulps(a, b) : Base::mulps(a, b);}
+		Encoding *mulps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::mulps(a, b) : Base::mulps(a, b);}
+
+		using Base::mulss;
+		Encoding *mulss(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::mulss(a, b) : Base::mulss(a, b);}
+		Encoding *mulss(const OperandXMMREG &a, const OperandMEM32 &b) {return emulate() ? Layer::mulss(a, b) : Base::mulss(a, b);}
+		Encoding *mulss(const OperandXMMREG &a, const OperandXMM32 &b) {return emulate() ? Layer::mulss(a, b) : Base::mulss(a, b);}
+
+		using Base::orps;
+		Encoding *orps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::orps(a, b) : Base::orps(a, b);}
+		Encoding *orps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::orps(a, b) : Base::orps(a, b);}
+		Encoding *orps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::orps(a, b) : Base::orps(a, b);}
+
+		using Base::pavgb;
+		Encoding *pavgb(const OperandMMREG &a, const OperandMMREG &b) {return emulate() ? Layer::pavgb(a, b) : Base::pavgb(a, b);}
+		Encoding *pavgb(const OperandMMREG &a, const OperandMEM64 &b) {return emulate() ? Layer::pavgb(a, b) : Base::pavgb(a, b);}
+		Encoding *pavgb(const OperandMMREG &a, const OperandMM64 &b) {return emulate() ? Layer::pavgb(a, b) : Base::pavgb(a, b);}
+
+		using Base::pavgw;
+		Encoding *pavgw(const OperandMMREG &a, const OperandMMREG &b) {return emulate() ? Layer::pavgw(a, b) : Base::pavgw(a, b);}
+		Encoding *pavgw(const OperandMMREG &a, const OperandMEM64 &b) {return emulate() ? Layer::pavgw(a, b) : Base::pavgw(a, b);}
+		Encoding *pavgw(const OperandMMREG &a, const OperandMM64 &b) {return emulate() ? Layer::pavgw(a, b) : Base::pavgw(a, b);}
+
+		using Base::pextrw;
+		Encoding *pextrw(const OperandREG32 &a, const OperandMMREG &b, unsigned char c) {return emulate() ? Layer::pextrw(a, b, c) : Base::pextrw(a, b, c);}
+
+		using Base::pinsrw;
+		Encoding *pinsrw(const OperandMMREG &a, const OperandREG16 &b, unsigned char c) {return emulate() ? Layer::pinsrw(a, b, c) : Base::pinsrw(a, b, c);}
+		Encoding *pinsrw(const OperandMMREG &a, const OperandMEM16 &b, unsigned char c) {return emulate() ? Layer::pinsrw(a, b, c) : Base::pinsrw(a, b, c);}
+		Encoding *pinsrw(const OperandMMREG &a, const OperandR_M16 &b, unsigned char c) {return emulate() ? Layer::pinsrw(a, b, c) : Base::pinsrw(a, b, c);}
+
+		using Base::pmaxsw;
+		Encoding *pmaxsw(const OperandMMREG &a, const OperandMMREG &b) {return emulate() ? Layer::pmaxsw(a, b) : Base::pmaxsw(a, b);}
+		Encoding *pmaxsw(const OperandMMREG &a, const OperandMEM64 &b) {return emulate() ? Layer::pmaxsw(a, b) : Base::pmaxsw(a, b);}
+		Encoding *pmaxsw(const OperandMMREG &a, const OperandMM64 &b) {return emulate() ? Layer::pmaxsw(a, b) : Base::pmaxsw(a, b);}
+
+		using Base::pmaxub;
+		Encoding *pmaxub(const OperandMMREG &a, const OperandMMREG &b) {return emulate() ? Layer::pmaxub(a, b) : Base::pmaxub(a, b);}
+		Encoding *pmaxub(const OperandMMREG &a, const OperandMEM64 &b) {return emulate() ? Layer::pmaxub(a, b) : Base::pmaxub(a, b);}
+		Encoding *pmaxub(const OperandMMREG &a, const OperandMM64 &b) {return emulate() ? Layer::pmaxub(a, b) : Base::pmaxub(a, b);}
+
+		using Base::pminsw;
+		Encoding *pminsw(const OperandMMREG &a, const OperandMMREG &b) {return emulate() ? Layer::pminsw(a, b) : Base::pminsw(a, b);}
+		Encoding *pminsw(const OperandMMREG &a, const OperandMEM64 &b) {return emulate() ? Layer::pminsw(a, b) : Base::pminsw(a, b);}
+		Encoding *pminsw(const OperandMMREG &a, const OperandMM64 &b) {return emulate() ? Layer::pminsw(a, b) : Base::pminsw(a, b);}
+
+		using Base::pminub;
+		Encoding *pminub(const OperandMMREG &a, const OperandMMREG &b) {return emulate() ? Layer::pminub(a, b) : Base::pminub(a, b);}
+		Encoding *pminub(const OperandMMREG &a, const OperandMEM64 &b) {return emulate() ? Layer::pminub(a, b) : Base::pminub(a, b);}
+		Encoding *pminub(const OperandMMREG &a, const OperandMM64 &b) {return emulate() ? Layer::pminub(a, b) : Base::pminub(a, b);}
+
+		using Base::pmulhuw;
+		Encoding *pmulhuw(const OperandMMREG &a, const OperandMMREG &b) {return emulate() ? Layer::pmulhuw(a, b) : Base::pmulhuw(a, b);}
+		Encoding *pmulhuw(const OperandMMREG &a, const OperandMEM64 &b) {return emulate() ? Layer::pmulhuw(a, b) : Base::pmulhuw(a, b);}
+		Encoding *pmulhuw(const OperandMMREG &a, const OperandMM64 &b) {return emulate() ? Layer::pmulhuw(a, b) : Base::pmulhuw(a, b);}
+
+		using Base::prefetchnta;
+		Encoding *prefetchnta(const OperandMEM8 &a) {return emulate() ? Layer::prefetchnta(a) : Base::prefetchnta(a);}
+		Encoding *prefetchnta(const OperandMEM16 &a) {return emulate() ? Layer::prefetchnta(a) : Base::prefetchnta(a);}
+		Encoding *prefetchnta(const OperandMEM32 &a) {return emulate() ? Layer::prefetchnta(a) : Base::prefetchnta(a);}
+		Encoding *prefetchnta(const OperandMEM64 &a) {return emulate() ? Layer::prefetchnta(a) : Base::prefetchnta(a);}
+		Encoding *prefetchnta(const OperandMEM128 &a) {return emulate() ? Layer::prefetchnta(a) : Base::prefetchnta(a);}
+
+		using Base::prefetcht0;
+		Encoding *prefetcht0(const OperandMEM8 &a) {return emulate() ? Layer::prefetcht0(a) : Base::prefetcht0(a);}
+		Encoding *prefetcht0(const OperandMEM16 &a) {return emulate() ? Layer::prefetcht0(a) : Base::prefetcht0(a);}
+		Encoding *prefetcht0(const OperandMEM32 &a) {return emulate() ? Layer::prefetcht0(a) : Base::prefetcht0(a);}
+		Encoding *prefetcht0(const OperandMEM64 &a) {return emulate() ? Layer::prefetcht0(a) : Base::prefetcht0(a);}
+		Encoding *prefetcht0(const OperandMEM128 &a) {return emulate() ? Layer::prefetcht0(a) : Base::prefetcht0(a);}
+
+		using Base::prefetcht1;
+		Encoding *prefetcht1(const OperandMEM8 &a) {return emulate() ? Layer::prefetcht1(a) : Base::prefetcht1(a);}
+		Encoding *prefetcht1(const OperandMEM16 &a) {return emulate() ? Layer::prefetcht1(a) : Base::prefetcht1(a);}
+		Encoding *prefetcht1(const OperandMEM32 &a) {return emulate() ? Layer::prefetcht1(a) : Base::prefetcht1(a);}
+		Encoding *prefetcht1(const OperandMEM64 &a) {return emulate() ? Layer::prefetcht1(a) : Base::prefetcht1(a);}
+		Encoding *prefetcht1(const OperandMEM128 &a) {return emulate() ? Layer::prefetcht1(a) : Base::prefetcht1(a);}
+
+		using Base::prefetcht2;
+		Encoding *prefetcht2(const OperandMEM8 &a) {return emulate() ? Layer::prefetcht2(a) : Base::prefetcht2(a);}
+		Encoding *prefetcht2(const OperandMEM16 &a) {return emulate() ? Layer::prefetcht2(a) : Base::prefetcht2(a);}
+		Encoding *prefetcht2(const OperandMEM32 &a) {return emulate() ? Layer::prefetcht2(a) : Base::prefetcht2(a);}
+		Encoding *prefetcht2(const OperandMEM64 &a) {return emulate() ? Layer::prefetcht2(a) : Base::prefetcht2(a);}
+		Encoding *prefetcht2(const OperandMEM128 &a) {return emulate() ? Layer::prefetcht2(a) : Base::prefetcht2(a);}
+
+		using Base::pshufw;
+		Encoding *pshufw(const OperandMMREG &a, const OperandMMREG &b, unsigned char c) {return emulate() ? Layer::pshufw(a, b, c) : Base::pshufw(a, b, c);}
+		Encoding *pshufw(const OperandMMREG &a, const OperandMEM64 &b, unsigned char c) {return emulate() ? Layer::pshufw(a, b, c) : Base::pshufw(a, b, c);}
+		Encoding *pshufw(const OperandMMREG &a, const OperandMM64 &b, unsigned char c) {return emulate() ? Layer::pshufw(a, b, c) : Base::pshufw(a, b, c);}
+
+		using Base::rcpps;
+		Encoding *rcpps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::rcpps(a, b) : Base::rcpps(a, b);}
+		Encoding *rcpps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::rcpps(a, b) : Base::rcpps(a, b);}
+		Encoding *rcpps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::rcpps(a, b) : Base::rcpps(a, b);}
+
+		using Base::rcpss;
+		Encoding *rcpss(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::rcpss(a, b) : Base::rcpss(a, b);}
+		Encoding *rcpss(const OperandXMMREG &a, const OperandMEM32 &b) {return emulate() ? Layer::rcpss(a, b) : Base::rcpss(a, b);}
+		Encoding *rcpss(const OperandXMMREG &a, const OperandXMM32 &b) {return emulate() ? Layer::rcpss(a, b) : Base::rcpss(a, b);}
+
+		using Base::rsqrtps;
+		Encoding *rsqrtps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::rsqrtps(a, b) : Base::rsqrtps(a, b);}
+		Encoding *rsqrtps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::rsqrtps(a, b) : Base::rsqrtps(a, b);}
+		Encoding *rsqrtps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::rsqrtps(a, b) : Base::rsqrtps(a, b);}
+
+		using Base::rsqrtss;
+		Encoding *rsqrtss(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::rsqrtss(a, b) : Base::rsqrtss(a, b);}
+		Encoding *rsqrtss(const OperandXMMREG &a, const OperandMEM32 &b) {return emulate() ? Layer::rsqrtss(a, b) : Base::rsqrtss(a, b);}
+		Encoding *rsqrtss(const OperandXMMREG &a, const OperandXMM32 &b) {return emulate() ? Layer::rsqrtss(a, b) : Base::rsqrtss(a, b);}
+
+		using Base::sfence;
+		Encoding *sfence() {return emulate() ? Layer::sfence() : Base::sfence();}
+
+		using Base::shufps;
+		Encoding *shufps(const OperandXMMREG &a, const OperandXMMREG &b, unsigned char c) {return emulate() ? Layer::shufps(a, b, c) : Base::shufps(a, b, c);}
+		Encoding *shufps(const OperandXMMREG &a, const OperandMEM128 &b, unsigned char c) {return emulate() ? Layer::shufps(a, b, c) : Base::shufps(a, b, c);}
+		Encoding *shufps(const OperandXMMREG &a, const OperandR_M128 &b, unsigned char c) {return emulate() ? Layer::shufps(a, b, c) : Base::shufps(a, b, c);}
+
+		using Base::sqrtps;
+		Encoding *sqrtps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::sqrtps(a, b) : Base::sqrtps(a, b);}
+		Encoding *sqrtps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::sqrtps(a, b) : Base::sqrtps(a, b);}
+		Encoding *sqrtps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::sqrtps(a, b) : Base::sqrtps(a, b);}
+
+		using Base::sqrtss;
+		Encoding *sqrtss(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::sqrtss(a, b) : Base::sqrtss(a, b);}
+		Encoding *sqrtss(const OperandXMMREG &a, const OperandMEM32 &b) {return emulate() ? Layer::sqrtss(a, b) : Base::sqrtss(a, b);}
+		Encoding *sqrtss(const OperandXMMREG &a, const OperandXMM32 &b) {return emulate() ? Layer::sqrtss(a, b) : Base::sqrtss(a, b);}
+
+		using Base::stmxcsr;
+		Encoding *stmxcsr(const OperandMEM32 &a) {return emulate() ? Layer::stmxcsr(a) : Base::stmxcsr(a);}
+
+		using Base::subps;
+		Encoding *subps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::subps(a, b) : Base::subps(a, b);}
+		Encoding *subps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::subps(a, b) : Base::subps(a, b);}
+		Encoding *subps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::subps(a, b) : Base::subps(a, b);}
+
+		using Base::subss;
+		Encoding *subss(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::subss(a, b) : Base::subss(a, b);}
+		Encoding *subss(const OperandXMMREG &a, const OperandMEM32 &b) {return emulate() ? Layer::subss(a, b) : Base::subss(a, b);}
+		Encoding *subss(const OperandXMMREG &a, const OperandXMM32 &b) {return emulate() ? Layer::subss(a, b) : Base::subss(a, b);}
+
+		using Base::ucomiss;
+		Encoding *ucomiss(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::ucomiss(a, b) : Base::ucomiss(a, b);}
+		Encoding *ucomiss(const OperandXMMREG &a, const OperandMEM32 &b) {return emulate() ? Layer::ucomiss(a, b) : Base::ucomiss(a, b);}
+		Encoding *ucomiss(const OperandXMMREG &a, const OperandXMM32 &b) {return emulate() ? Layer::ucomiss(a, b) : Base::ucomiss(a, b);}
+
+		using Base::unpckhps;
+		Encoding *unpckhps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::unpckhps(a, b) : Base::unpckhps(a, b);}
+		Encoding *unpckhps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::unpckhps(a, b) : Base::unpckhps(a, b);}
+		Encoding *unpckhps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::unpckhps(a, b) : Base::unpckhps(a, b);}
+
+		using Base::unpcklps;
+		Encoding *unpcklps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::unpcklps(a, b) : Base::unpcklps(a, b);}
+		Encoding *unpcklps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::unpcklps(a, b) : Base::unpcklps(a, b);}
+		Encoding *unpcklps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::unpcklps(a, b) : Base::unpcklps(a, b);}
+
+		using Base::xorps;
+		Encoding *xorps(const OperandXMMREG &a, const OperandXMMREG &b) {return emulate() ? Layer::xorps(a, b) : Base::xorps(a, b);}
+		Encoding *xorps(const OperandXMMREG &a, const OperandMEM128 &b) {return emulate() ? Layer::xorps(a, b) : Base::xorps(a, b);}
+		Encoding *xorps(const OperandXMMREG &a, const OperandR_M128 &b) {return emulate() ? Layer::xorps(a, b) : Base::xorps(a, b);}
+
+	private:
+		static bool allocate()
+		{
+			return Inherits<Layer, RegisterAllocator>::value;
+		}
+
+		static bool emulate()
+		{
+			return Inherits<Layer, Emulator>::value && Emulator::emulatingSSE();
+		}
+	};
+}
+
+#endif   // SoftWire_Static_hpp
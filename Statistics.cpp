@@ -0,0 +1,230 @@
+#include "Statistics.hpp"
+
+#ifdef WIN32
+	#include <windows.h>
+#else
+	#include <time.h>
+#endif
+
+#ifdef _MSC_VER
+	#define THREAD_LOCAL __declspec(thread)
+#else
+	#define THREAD_LOCAL __thread
+#endif
+
+namespace SoftWire
+{
+	static THREAD_LOCAL Statistics *activeStatistics = 0;   // Assemblers on other threads keep their own
+
+	Statistics::Scope::Scope(Statistics *statistics, Phase phase) : statistics(statistics)
+	{
+		active = activeStatistics;
+		interrupted = PHASE_NONE;
+
+		if(statistics)
+		{
+			interrupted = statistics->enter(phase);
+			activeStatistics = statistics;
+		}
+	}
+
+	Statistics::Scope::~Scope()
+	{
+		if(statistics)
+		{
+			statistics->leave(interrupted);
+			activeStatistics = active;
+		}
+	}
+
+	Statistics::Statistics()
+	{
+		reset();
+	}
+
+	Statistics::~Statistics()
+	{
+		if(activeStatistics == this)
+		{
+			activeStatistics = 0;
+		}
+	}
+
+	void Statistics::reset()
+	{
+		current = PHASE_NONE;
+		start = 0;
+
+		for(int i = 0; i < PHASE_COUNT; i++)
+		{
+			time[i] = 0;
+			calls[i] = 0;
+			allocations[i] = 0;
+			allocatedBytes[i] = 0;
+		}
+
+		spills = 0;
+		reloads = 0;
+		instructions = 0;
+		eliminated = 0;
+		bytes = 0;
+	}
+
+	Statistics::Phase Statistics::enter(Phase phase)
+	{
+		if(phase == current)
+		{
+			return current;
+		}
+
+		double t = now();
+
+		if(current != PHASE_NONE)
+		{
+			time[current] += t - start;
+		}
+
+		Phase interrupted = current;
+
+		current = phase;
+		start = t;
+		calls[phase]++;
+
+		return interrupted;
+	}
+
+	void Statistics::leave(Phase interrupted)
+	{
+		if(interrupted == current)
+		{
+			return;
+		}
+
+		double t = now();
+
+		time[current] += t - start;
+
+		current = interrupted;
+		start = t;
+	}
+
+	void Statistics::countSpill()
+	{
+		spills++;
+	}
+
+	void Statistics::countReload()
+	{
+		reloads++;
+	}
+
+	void Statistics::countCode(int instructions, int eliminated, int bytes)
+	{
+		this->instructions += instructions;
+		this->eliminated += eliminated;
+		this->bytes += bytes;
+	}
+
+	double Statistics::getTime(Phase phase) const
+	{
+		return time[phase];
+	}
+
+	int Statistics::getCalls(Phase phase) const
+	{
+		return calls[phase];
+	}
+
+	int Statistics::getAllocations(Phase phase) const
+	{
+		return allocations[phase];
+	}
+
+	int Statistics::getAllocatedBytes(Phase phase) const
+	{
+		return allocatedBytes[phase];
+	}
+
+	int Statistics::getSpills() const
+	{
+		return spills;
+	}
+
+	int Statistics::getReloads() const
+	{
+		return reloads;
+	}
+
+	int Statistics::getInstructions() const
+	{
+		return instructions;
+	}
+
+	int Statistics::getEliminated() const
+	{
+		return eliminated;
+	}
+
+	int Statistics::getBytes() const
+	{
+		return bytes;
+	}
+
+	void Statistics::writeJSON(FILE *file) const
+	{
+		fprintf(file, "{\n\t\"phases\": {\n");
+
+		for(int i = 0; i < PHASE_COUNT; i++)
+		{
+			fprintf(file, "\t\t\"%s\": {\"seconds\": %.9f, \"calls\": %d, \"allocations\": %d, \"allocatedBytes\": %d}%s\n",
+			        phaseName((Phase)i), time[i], calls[i], allocations[i], allocatedBytes[i], i < PHASE_COUNT - 1 ? "," : "");
+		}
+
+		fprintf(file, "\t},\n");
+		fprintf(file, "\t\"instructions\": %d,\n", instructions);
+		fprintf(file, "\t\"eliminated\": %d,\n", eliminated);
+		fprintf(file, "\t\"bytes\": %d,\n", bytes);
+		fprintf(file, "\t\"spills\": %d,\n", spills);
+		fprintf(file, "\t\"reloads\": %d\n", reloads);
+		fprintf(file, "}\n");
+	}
+
+	const char *Statistics::phaseName(Phase phase)
+	{
+		switch(phase)
+		{
+		case PHASE_INTRINSICS:	return "intrinsics";
+		case PHASE_ALLOCATION:	return "allocation";
+		case PHASE_EMULATION:	return "emulation";
+		case PHASE_LOADING:		return "loading";
+		case PHASE_LISTING:		return "listing";
+		default:				return "none";
+		}
+	}
+
+	void Statistics::allocation(int size)
+	{
+		if(activeStatistics && activeStatistics->current != PHASE_NONE)
+		{
+			activeStatistics->allocations[activeStatistics->current]++;
+			activeStatistics->allocatedBytes[activeStatistics->current] += size;
+		}
+	}
+
+	double Statistics::now()
+	{
+		#ifdef WIN32
+			LARGE_INTEGER counter;
+			LARGE_INTEGER frequency;
+			QueryPerformanceCounter(&counter);
+			QueryPerformanceFrequency(&frequency);
+
+			return (double)counter.QuadPart / (double)frequency.QuadPart;
+		#else
+			timespec t;
+			clock_gettime(CLOCK_MONOTONIC, &t);
+
+			return t.tv_sec + t.tv_nsec * 1e-9;
+		#endif
+	}
+}
@@ -0,0 +1,89 @@
+#ifndef SoftWire_Statistics_hpp
+#define SoftWire_Statistics_hpp
+
+#include <stdio.h>
+
+namespace SoftWire
+{
+	// Compilation time and work per phase, time of nested phases is excluded from the enclosing phase
+	class Statistics
+	{
+	public:
+		enum Phase
+		{
+			PHASE_NONE = -1,
+
+			PHASE_INTRINSICS,   // Assembler::x86 and labels
+			PHASE_ALLOCATION,   // Register allocation, spilling and state restore
+			PHASE_EMULATION,    // Lowering of emulated instructions
+			PHASE_LOADING,      // Layout, linking and writing machine code
+			PHASE_LISTING,
+
+			PHASE_COUNT
+		};
+
+		// Enters a phase for the lifetime of the scope, no effect for null statistics
+		class Scope
+		{
+		public:
+			Scope(Statistics *statistics, Phase phase);
+
+			~Scope();
+
+		private:
+			Statistics *statistics;
+			Statistics *active;   // Previously active statistics
+			Phase interrupted;
+		};
+
+		Statistics();
+
+		virtual ~Statistics();
+
+		void reset();
+
+		void countSpill();
+		void countReload();
+		void countCode(int instructions, int eliminated, int bytes);   // Per load
+
+		double getTime(Phase phase) const;   // Seconds
+		int getCalls(Phase phase) const;   // Entries, not counting re-entry of the current phase
+		int getAllocations(Phase phase) const;   // SoftWire heap allocations
+		int getAllocatedBytes(Phase phase) const;
+
+		int getSpills() const;
+		int getReloads() const;
+		int getInstructions() const;
+		int getEliminated() const;   // Reserved by the optimizer or loader, not emitted
+		int getBytes() const;
+
+		void writeJSON(FILE *file) const;
+
+		static const char *phaseName(Phase phase);
+
+		// Counted in the phase of the statistics active on this thread, if any
+		static void allocation(int size);
+
+	private:
+		Phase enter(Phase phase);   // Returns interrupted phase
+		void leave(Phase interrupted);
+
+		static double now();
+
+		Phase current;
+		double start;   // Of current phase, or since it was resumed
+
+		double time[PHASE_COUNT];
+		int calls[PHASE_COUNT];
+		int allocations[PHASE_COUNT];
+		int allocatedBytes[PHASE_COUNT];
+
+		int spills;
+		int reloads;
+		int instructions;
+		int eliminated;
+		int bytes;
+	};
+}
+
+#endif   // SoftWire_Statistics_hpp
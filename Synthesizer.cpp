@@ -78,7 +78,7 @@ namespace SoftWire
 		}
 		else if(Operand::isImm(firstType))
 		{
-			encodeImmediate(firstOperand.value);
+			encodeImmediate(firstType == Operand::OPERAND_REF ? firstOperand.displacement : firstOperand.value);   // Pointer held as displacement
 			referenceLabel(firstOperand.reference);
 		}
 		else if(!Operand::isVoid(firstType))
@@ -112,7 +112,9 @@ namespace SoftWire
 		}
 		else if(Operand::isImm(secondType))
 		{
-			encodeImmediate(secondOperand.value);
+			if(secondType == Operand::OPERAND_IMM64) encodeImmediate(secondOperand.quad);
+			else if(secondType == Operand::OPERAND_REF) encodeImmediate(secondOperand.displacement);
+			else encodeImmediate(secondOperand.value);
 			referenceLabel(secondOperand.reference);
 		}
 		else if(!Operand::isVoid(secondType))
@@ -128,6 +130,10 @@ namespace SoftWire
 			encodeImmediate(thirdOperand.value);
 			referenceLabel(thirdOperand.reference);
 		}
+		else if(Operand::isReg(thirdOperand))
+		{
+			// Implicit CL shift count, nothing to encode
+		}
 		else if(!Operand::isVoid(thirdOperand))
 		{
 			throw INTERNAL_ERROR;
@@ -172,9 +178,9 @@ namespace SoftWire
 		this->scale = scale;
 	}
 
-	void Synthesizer::encodeImmediate(int immediate)
+	void Synthesizer::encodeImmediate(__int64 immediate)
 	{
-		if(encoding.immediate != 0xCCCCCCCC)
+		if((unsigned int)encoding.immediate != 0xCCCCCCCC)
 		{
 			throw Error("Instruction can't have multiple immediate operands");
 		}
@@ -182,7 +188,7 @@ namespace SoftWire
 		encoding.immediate = immediate;
 	}
 
-	void Synthesizer::setDisplacement(int displacement)
+	void Synthesizer::setDisplacement(__int64 displacement)
 	{
 		encoding.setDisplacement(displacement);
 	}
@@ -239,7 +245,8 @@ namespace SoftWire
 				encodeRexByte(instruction);
 				if(encoding.format.O1)
 				{
-					if(Operand::isReg(firstType) && firstType != Operand::OPERAND_ST0)
+					// Register not implied by the syntax, like ECX in XCHG EAX,ECX
+					if(Operand::isReg(firstType) && !(Operand::isImplicit(instruction->getFirstOperand()) && Operand::isReg(secondType)))
 					{
 						encoding.O1 += firstReg & 0x7;
 						encoding.REX.B = (firstReg & 0x8) >> 3;
@@ -249,11 +256,6 @@ namespace SoftWire
 						encoding.O1 += secondReg & 0x7;
 						encoding.REX.B = (secondReg & 0x8) >> 3;
 					}
-					else if(Operand::isReg(firstType) && firstType == Operand::OPERAND_ST0)
-					{
-						encoding.O1 += firstReg & 0x7;
-						encoding.REX.B = (firstReg & 0x8) >> 3;
-					}
 					else
 					{
 						throw INTERNAL_ERROR;   // '+r' not compatible with operands
@@ -286,7 +288,14 @@ namespace SoftWire
 				encodeSibByte(instruction);
 				break;
 			case QWORD_IMM:
-				throw INTERNAL_ERROR;   // FIXME: Unimplemented
+				encoding.format.I1 = true;
+				encoding.format.I2 = true;
+				encoding.format.I3 = true;
+				encoding.format.I4 = true;
+				encoding.format.I5 = true;
+				encoding.format.I6 = true;
+				encoding.format.I7 = true;
+				encoding.format.I8 = true;
 				break;
 			case DWORD_IMM:
 				encoding.format.I1 = true;
@@ -378,6 +387,11 @@ namespace SoftWire
 			}
 		}
 
+		if(instruction->is64Bit() && !encoding.format.REX)   // No register or memory operand encoding, like ADD RAX,imm32
+		{
+			encodeRexByte(instruction);
+		}
+
 		return encoding;
 	}
 
@@ -23,7 +23,7 @@ namespace SoftWire
 		void encodeSecondOperand(const Operand &secondOperand);
 		void encodeThirdOperand(const Operand &thirdOperand);
 
-		void encodeImmediate(int i);
+		void encodeImmediate(__int64 i);
 		void encodeLiteral(const char *string);
 
 		const Encoding &encodeInstruction(const Instruction *instruction);
@@ -47,7 +47,7 @@ namespace SoftWire
 		void encodeIndex(const Operand &index);
 
 		void setScale(int scale);
-		void setDisplacement(int displacement);
+		void setDisplacement(__int64 displacement);
 
 		void referenceLabel(const char *label);
 
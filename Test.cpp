@@ -1,7 +1,16 @@
 #include "CodeGenerator.hpp"
+#include "InstructionSet.hpp"
+#include "Synthesizer.hpp"
+#include "Disassembler.hpp"
+#include "Static.hpp"
+#include "CodeCache.hpp"
+#include "Linker.hpp"
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
 
 #ifdef WIN32
 	#include <conio.h>
@@ -9,6 +18,11 @@
 	inline int getch() {return fgetc(stdin);}
 #endif
 
+#ifdef __linux__
+	#include <unistd.h>
+	#include <sys/wait.h>
+#endif
+
 #if defined(__cplusplus) && !defined(for) && defined(_MSC_VER) && (_MSC_VER <= 1200)
 	#define for if(0);else for
 #endif
@@ -382,6 +396,92 @@ void testOptimizations()
 	}
 }
 
+class ScalarCoalescing : public SoftWire::CodeGenerator
+{
+public:
+	ScalarCoalescing(bool copyProp) : CodeGenerator(sizeof(void*) == 8)   // void f(float *v), v[3] = ((v[0] * v[0] + v[1]) - v[2]) * v[0] + ...
+	{
+		if(copyProp) enableCopyPropagation(); else disableCopyPropagation();
+
+		prologue(1);
+
+		Pointer v;
+		argument(v);
+
+		Float x;
+		Float y;
+		Float z;
+		movss(x, dword_ptr [v + 0]);
+		movss(y, dword_ptr [v + 4]);
+		movss(z, dword_ptr [v + 8]);
+
+		Float s = x;
+
+		for(int i = 0; i < 8; i++)
+		{
+			Float t = s;
+			t *= x;
+			t += y;
+			s = t;   // Copy from a dying temporary
+			free(t);
+
+			Float u = s;
+			u -= z;
+			s = u;
+			free(u);
+		}
+
+		movss(dword_ptr [v + 12], s);
+
+		epilogue();
+	}
+
+	int movssCount()
+	{
+		int count = 0;
+
+		for(const char *line = strstr(getListing(), "movss"); line; line = strstr(line + 1, "movss"))
+		{
+			count++;
+		}
+
+		return count;
+	}
+};
+
+void testScalarCoalescing()
+{
+	printf("Scalar SSE copy coalescing test.\n\n");
+
+	ScalarCoalescing a(false);
+	ScalarCoalescing b(true);
+
+	float v[4] = {1.5f, 2.0f, 0.25f, 0.0f};
+	float w[4] = {1.5f, 2.0f, 0.25f, 0.0f};
+
+	((void(*)(float*))a.callable())(v);
+	((void(*)(float*))b.callable())(w);
+
+	float s = v[0];
+
+	for(int i = 0; i < 8; i++)
+	{
+		s = s * v[0] + v[1];
+		s = s - v[2];
+	}
+
+	printf("movss instructions: %d without copy coalescing, %d with.\n", a.movssCount(), b.movssCount());
+
+	if(v[3] == w[3] && v[3] - s < 0.001f && s - v[3] < 0.001f)
+	{
+		printf("Scalar coalescing test succesful.\n\n");
+	}
+	else
+	{
+		printf("Scalar coalescing test failed.\n\n");
+	}
+}
+
 class BackEnd : public SoftWire::CodeGenerator
 {
 public:
@@ -438,6 +538,205 @@ void testBackEnd()
 	}
 }
 
+void (*paddedLoop(SoftWire::Assembler &x86, int offset))()
+{
+	x86.mov(x86.edx, 10000000);
+
+	x86.label("outer");
+
+	for(int i = 0; i < offset; i++)
+	{
+		x86.inc(x86.eax);   // Shift the inner loop header
+	}
+
+	x86.mov(x86.ecx, 4);
+
+	x86.label("inner");   // Entered by falling through its padding
+	x86.add(x86.eax, x86.ecx);
+	x86.dec(x86.ecx);
+	x86.jnz("inner");
+
+	x86.dec(x86.edx);
+	x86.jnz("outer");
+	x86.ret();
+
+	return x86.callable();
+}
+
+void testPadding()
+{
+	printf("Padded loop entry benchmark.\n\n");
+
+	bool x64 = sizeof(void*) == 8;
+
+	for(int offset = 1; offset < 16; offset += 2)
+	{
+		SoftWire::Assembler unaligned(x64);
+		SoftWire::Assembler aligned(x64);
+		aligned.alignLoops(16);
+
+		void (*funca)() = paddedLoop(unaligned, offset);
+		void (*funcb)() = paddedLoop(aligned, offset);
+
+		clock_t start = clock();
+		funca();
+		clock_t middle = clock();
+		funcb();
+		clock_t end = clock();
+
+		printf("Offset %2d: %d ms unaligned, %d ms aligned with %d bytes of padding.\n", offset,
+		       (int)((middle - start) * 1000 / CLOCKS_PER_SEC), (int)((end - middle) * 1000 / CLOCKS_PER_SEC), aligned.paddingBytes());
+	}
+
+	printf("\n");
+}
+
+void (*branchyLoop(SoftWire::Assembler &x86))()
+{
+	x86.mov(x86.ecx, 1000);
+
+	x86.label("loop");
+	x86.cmp(x86.ecx, 2000);
+	x86.jge("rare");
+
+	x86.label("common");
+	x86.dec(x86.ecx);
+	x86.jnz("loop");
+	x86.ret();
+
+	x86.label("rare");
+	x86.inc(x86.eax);
+	x86.jmp("common");
+
+	return x86.callable();
+}
+
+int (*flagsAcrossBranches(SoftWire::Assembler &x86))()   // Returns 0
+{
+	x86.xor(x86.ecx, x86.ecx);
+	x86.cmp(x86.ecx, 0);
+	x86.jne("nonzero");
+	x86.je("zero");   // Flags of the compare, after the not taken counter
+	x86.mov(x86.eax, 99);
+	x86.ret();
+
+	x86.label("zero");
+	x86.mov(x86.eax, 0);
+	x86.ret();
+
+	x86.label("nonzero");
+	x86.mov(x86.eax, 1);
+	x86.ret();
+
+	return (int(*)())x86.callable();
+}
+
+void testProfile()
+{
+	printf("Profile-guided recompilation test.\n\n");
+
+	bool x64 = sizeof(void*) == 8;
+
+	SoftWire::Assembler plain(x64);
+	SoftWire::Assembler counted(x64);
+	counted.instrument();
+
+	int x = flagsAcrossBranches(plain)();
+	int y = flagsAcrossBranches(counted)();
+
+	printf("f() = %d without and %d with instrumentation, expected 0.\n", x, y);
+
+	SoftWire::Assembler profiled(x64);
+	profiled.instrument();
+	branchyLoop(profiled)();
+
+	printf("Block 'loop' entered %d times, 'rare' %d times, branch taken %d times.\n\n",
+	       profiled.blockCount("loop"), profiled.blockCount("rare"), profiled.branchCount(0, true));
+
+	SoftWire::Assembler optimized(x64);
+	optimized.useProfile(&profiled);
+	branchyLoop(optimized)();
+
+	printf("%s\n\n", optimized.getListing());
+}
+
+int (*labelBeforeCold(SoftWire::Assembler &x86, bool x64))(int)   // Returns 2 for 0, else 1
+{
+	if(!x64)
+	{
+		x86.mov(x86.ecx, x86.dword_ptr [x86.esp+4]);
+	}
+	#ifndef WIN32
+		else
+		{
+			x86.mov(x86.ecx, x86.edi);   // Already in ecx on Win64
+		}
+	#endif
+
+	x86.mov(x86.eax, 1);
+	x86.cmp(x86.ecx, 0);
+	x86.je("zero");
+	x86.ret();
+
+	x86.label("zero");   // Falls into the cold block through its jump
+	x86.cold();
+	x86.mov(x86.eax, 2);
+	x86.ret();
+	x86.hot();
+
+	x86.label("after");
+	x86.mov(x86.eax, 3);
+	x86.ret();
+
+	return (int(*)(int))x86.callable();
+}
+
+void testColdCode()
+{
+	printf("Cold code test.\n\n");
+
+	bool x64 = sizeof(void*) == 8;
+
+	SoftWire::Assembler x86(x64);
+
+	int (*function)(int) = labelBeforeCold(x86, x64);
+
+	printf("%s\n", x86.getListing());
+	printf("f(0) = %d, f(1) = %d, expected 2 and 1.\n\n", function(0), function(1));
+}
+
+void testModule()
+{
+	printf("Module test.\n\n");
+
+	SoftWire::Assembler x86(sizeof(void*) == 8);
+
+	x86.routine("twice");
+	x86.call("seven");   // Forward
+	x86.add(x86.eax, x86.eax);
+	x86.ret();
+
+	x86.routine("seven");
+	x86.mov(x86.eax, 7);
+	x86.ret();
+
+	x86.routine("fifteen");
+	x86.call("twice");   // Backward
+	x86.inc(x86.eax);
+	x86.ret();
+
+	x86.finalize();
+
+	int (*twice)() = (int(*)())x86.entryPoint("twice");
+	int (*seven)() = (int(*)())x86.entryPoint("seven");
+	int (*fifteen)() = (int(*)())x86.entryPoint(2);
+
+	bool aligned = ((size_t)seven & 15) == 0 && ((size_t)fifteen & 15) == 0;
+
+	printf("%d routines, twice() = %d, seven() = %d, fifteen() = %d, expected 14, 7 and 15, entry points %s.\n\n",
+	       x86.routineCount(), twice(), seven(), fifteen(), aligned ? "aligned" : "not aligned");
+}
+
 class X64 : public SoftWire::CodeGenerator
 {
 public:
@@ -454,15 +753,17 @@ public:
 		mov(r0b, r1b);
 		xor(rax, rax);
 		xor(rbx, rbx);
-		mov(qword_ptr [&x+rax+4*rbx], 1);
-		mov(qword_ptr [&x], 2);   // RIP-relative addressing
+		mov(rdx, IMM64((__int64)&x));   // Full 64-bit address
+		mov(qword_ptr [rdx+4*rbx], 1);
+		mov(rdx, qword_ptr [literal((__int64)&x)]);   // RIP-relative literal pool
+		mov(qword_ptr [rdx], 2);
 		push(r14);
 		pop(r14);
 
 		const char *string = "Good luck with your 64-bit processor!";
 
-		mov(rcx, (unsigned int)string);
-		call((unsigned int)printf);
+		mov(rcx, IMM64((__int64)string));
+		call((void*)printf);   // Through a veneer when out of rel32 range
 
 		epilogue();
 	}
@@ -496,6 +797,852 @@ void testX64()
 	}
 }
 
+class CallingConvention : public SoftWire::CodeGenerator
+{
+public:
+	CallingConvention() : CodeGenerator(sizeof(void*) == 8)   // int f(int a, const int *p, int b) returns a + p[1] * b
+	{
+		prologue(3);
+
+		Int a;
+		Pointer p;
+		Int b;
+		argument(a);
+		argument(p);
+		argument(b);
+
+		Int t;
+		mov(t, dword_ptr [p + 4]);
+		t *= b;
+		a += t;
+
+		result(a);
+		epilogue();
+	}
+};
+
+void testCallingConvention()
+{
+	printf("Calling convention test.\n\n");
+
+	CallingConvention x86;
+
+	int (*function)(int, const int*, int) = (int(*)(int, const int*, int))x86.callable();
+
+	int data[2] = {10, 20};
+
+	const char *listing = x86.getListing();
+	int instructions = *listing ? 1 : 0;
+
+	for(const char *line = listing; *line; line++)
+	{
+		if(*line == '\n' && line[1]) instructions++;
+	}
+
+	printf("%s\n", listing);
+	printf("f(3, {10, 20}, 2) = %d, expected 43.\n", function(3, data, 2));
+
+	if(sizeof(void*) == 8)
+	{
+		printf("Leaf routine of %d instructions, expected 5 without saves or frame.\n", instructions);
+	}
+
+	printf("\n");
+}
+
+class StackAlignment : public SoftWire::CodeGenerator
+{
+public:
+	StackAlignment(void *helper, int saved) : CodeGenerator(sizeof(void*) == 8)   // int f() returns helper()
+	{
+		prologue(0);
+
+		// Callee-saved registers besides the frame pointer
+		if(saved > 0) xor(ebx, ebx);
+		if(saved > 1) xor(x64 ? r12d : esi, x64 ? r12d : esi);
+
+		call(helper);
+		epilogue();
+	}
+};
+
+void testStackAlignment()
+{
+	printf("Stack alignment test.\n\n");
+
+	bool x64 = sizeof(void*) == 8;
+
+	// Returns the stack pointer modulo 16 on entry, after the return address was pushed
+	SoftWire::Assembler probe(x64);
+
+	if(x64) probe.mov(probe.rax, probe.rsp);
+	else    probe.mov(probe.eax, probe.esp);
+	probe.and(probe.eax, 15);
+	probe.ret();
+
+	void *helper = (void*)probe.callable();
+
+	for(int saved = 0; saved < 3; saved++)
+	{
+		StackAlignment x86(helper, saved);
+
+		int (*function)() = (int(*)())x86.callable();
+
+		if(saved == 0) printf("%s\n", x86.getListing());
+		printf("%d callee-saved registers: stack at helper entry = %d mod 16, expected %d.\n", saved, function(), x64 ? 8 : 12);
+	}
+
+	printf("\n");
+}
+
+int encodeForm(SoftWire::Synthesizer &synthesizer, const SoftWire::Instruction *instruction, const SoftWire::Operand *operand, unsigned char *code)
+{
+	synthesizer.reset();
+	synthesizer.encodeFirstOperand(operand[0]);
+	synthesizer.encodeSecondOperand(operand[1]);
+	synthesizer.encodeThirdOperand(operand[2]);
+
+	return synthesizer.encodeInstruction(instruction).writeCode(code);
+}
+
+SoftWire::Operand sampleOperand(SoftWire::Operand::Type type, int i, bool memory, bool x64)
+{
+	using SoftWire::Operand;
+	using SoftWire::Encoding;
+
+	Operand operand(type);
+	operand.reference = 0;
+	operand.value = 0;
+	operand.indexReg = Encoding::REG_UNKNOWN;
+	operand.scale = 0;
+	operand.displacement = 0;
+
+	if(Operand::isImm(type))
+	{
+		if(type == Operand::OPERAND_ONE)								operand.value = 1;
+		else if(type == Operand::OPERAND_IMM64)							operand.quad = (__int64)0x12345678 << 32 | 0x9ABCDEF0;
+		else if(Operand::isSubtypeOf(type, Operand::OPERAND_IMM8))		operand.value = 0x12;
+		else if(Operand::isSubtypeOf(type, Operand::OPERAND_IMM16))		operand.value = 0x1234;
+		else															operand.value = 0x12345678;
+	}
+	else if((type & Operand::OPERAND_MEM) && (memory || !(type & Operand::OPERAND_REG)))
+	{
+		operand.type = (Operand::Type)(type & Operand::OPERAND_MEM);
+		operand.baseReg = x64 ? Encoding::R11 : Encoding::EBX;
+		operand.indexReg = Encoding::ESI;
+		operand.scale = 4;
+		operand.displacement = 0x12;
+	}
+	else if(type & Operand::OPERAND_REG)
+	{
+		operand.type = (Operand::Type)(type & Operand::OPERAND_REG);
+
+		switch(operand.type)
+		{
+		case Operand::OPERAND_AL:
+		case Operand::OPERAND_AX:
+		case Operand::OPERAND_EAX:
+		case Operand::OPERAND_RAX:
+		case Operand::OPERAND_ST0:
+			operand.reg = Encoding::R0;
+			break;
+		case Operand::OPERAND_CL:
+		case Operand::OPERAND_CX:
+		case Operand::OPERAND_ECX:
+			operand.reg = Encoding::R1;
+			break;
+		case Operand::OPERAND_DX:
+			operand.reg = Encoding::R2;
+			break;
+		default:
+			if(x64 && !(operand.type & (Operand::OPERAND_MMREG | Operand::OPERAND_FPUREG)))
+			{
+				operand.reg = Encoding::R9 + i;   // Needs REX
+			}
+			else
+			{
+				operand.reg = Encoding::R1 + i;
+			}
+		}
+	}
+
+	return operand;
+}
+
+int operandSize(SoftWire::Operand::Type type)
+{
+	using SoftWire::Operand;
+
+	if(Operand::isSubtypeOf(type, Operand::OPERAND_R_M8))	return 1;
+	if(Operand::isSubtypeOf(type, Operand::OPERAND_R_M16))	return 2;
+	if(Operand::isSubtypeOf(type, Operand::OPERAND_R_M32))	return 4;
+	if(Operand::isSubtypeOf(type, Operand::OPERAND_R_M64))	return 8;
+	if(Operand::isSubtypeOf(type, Operand::OPERAND_MM64))	return 8;
+	if(Operand::isSubtypeOf(type, Operand::OPERAND_R_M128))	return 16;
+
+	return 0;   // Immediate, FPU register or untyped memory
+}
+
+void testDisassembler()
+{
+	printf("Disassembler round-trip test.\n\n");
+
+	SoftWire::InstructionSet instructionSet;
+
+	for(int mode = 0; mode < 2; mode++)
+	{
+		bool x64 = mode == 1;
+		SoftWire::Synthesizer synthesizer(x64);
+		SoftWire::Disassembler disassembler(x64);
+
+		int tested = 0;
+		int failed = 0;
+
+		for(int i = 0; i < instructionSet.instructionCount(); i++)
+		{
+			const SoftWire::Instruction *instruction = instructionSet.instruction(i);
+			const char *encoding = instruction->getEncoding();
+
+			if(strncmp(encoding, "p1", 2) == 0) continue;   // Pseudo-instructions
+			if(instruction->isCyrix()) continue;   // Opcodes taken by SSE
+			if(x64 ? instruction->isInvalid64() : instruction->is64Bit()) continue;
+
+			SoftWire::Operand::Type type[3] = {instruction->getFirstOperand(), instruction->getSecondOperand(), instruction->getThirdOperand()};
+			bool r_m = false;   // Register and memory variants
+
+			for(int j = 0; j < 3; j++)
+			{
+				r_m |= (type[j] & SoftWire::Operand::OPERAND_REG) && (type[j] & SoftWire::Operand::OPERAND_MEM);
+			}
+
+			for(int memory = 0; memory < (r_m ? 2 : 1); memory++)
+			{
+				SoftWire::Operand operand[3];
+				unsigned char code[16];
+				unsigned char again[16];
+				char text[128];
+
+				for(int j = 0; j < 3; j++)
+				{
+					operand[j] = sampleOperand(type[j], j, memory == 1, x64);
+				}
+
+				try
+				{
+					int length = encodeForm(synthesizer, instruction, operand, code);
+					bool pass = disassembler.disassemble(code, length, text, 128) == length;
+
+					if(pass)
+					{
+						SoftWire::Operand decoded[3] = {disassembler.getOperand(0), disassembler.getOperand(1), disassembler.getOperand(2)};
+						pass = encodeForm(synthesizer, disassembler.getInstruction(), decoded, again) == length && memcmp(code, again, length) == 0;
+
+						for(int j = 0; j < 3; j++)   // Same operand sizes unless untyped, aliases may omit implicit operands
+						{
+							if(!SoftWire::Operand::isVoid(operand[j]) && !SoftWire::Operand::isVoid(decoded[j]) && operand[j].type != SoftWire::Operand::OPERAND_MEM)
+							{
+								pass = pass && operandSize(operand[j].type) == operandSize(decoded[j].type);
+							}
+						}
+					}
+
+					if(!pass)
+					{
+						printf("%s %s: '%s'\n", instruction->getMnemonic(), instruction->getOperandSyntax(), text);
+						failed++;
+					}
+
+					tested++;
+				}
+				catch(const SoftWire::Error &error)
+				{
+					printf("%s %s: %s\n", instruction->getMnemonic(), instruction->getOperandSyntax(), error.getString());
+					failed++;
+				}
+			}
+		}
+
+		printf("%s: %d forms, %d failed.\n\n", x64 ? "x86-64" : "x86", tested, failed);
+	}
+}
+
+struct CodeBuffer
+{
+	unsigned char byte[256];
+	int length;
+};
+
+void appendCode(const unsigned char *address, int length, const char *text, void *data)
+{
+	CodeBuffer &code = *(CodeBuffer*)data;
+
+	memcpy(code.byte + code.length, address, length);
+	code.length += length;
+}
+
+struct FixedCheck
+{
+	SoftWire::InstructionSet instructionSet;
+	int templates;
+	int mismatches;
+};
+
+void checkFixed(FixedCheck &check, const SoftWire::Encoding *expected, const SoftWire::Fixed::Code &code)
+{
+	unsigned char bytes[16];
+	int length = expected->writeCode(bytes);
+
+	const SoftWire::Instruction *selected = expected->getInstruction();
+	const SoftWire::Instruction *indexed = check.instructionSet.instruction(code.instruction);
+
+	bool sameCode = length == code.length && memcmp(bytes, code.byte, length) == 0;
+	bool sameInstruction = strcmp(selected->getMnemonic(), indexed->getMnemonic()) == 0 &&
+	                       strcmp(selected->getOperandSyntax(), indexed->getOperandSyntax()) == 0;
+
+	check.templates++;
+
+	if(!sameCode || !sameInstruction)
+	{
+		check.mismatches++;
+
+		printf("%s %s: index %d is %s %s, %s code.\n", selected->getMnemonic(), selected->getOperandSyntax(),
+		       code.instruction, indexed->getMnemonic(), indexed->getOperandSyntax(), sameCode ? "same" : "different");
+	}
+}
+
+// Every template against the run-time assembler, for the given registers
+template<int a, int b>
+void checkFixed32(FixedCheck &check, SoftWire::Assembler &x86, SoftWire::Fixed::REG32<a> fa, SoftWire::Fixed::REG32<b> fb)
+{
+	using namespace SoftWire::Fixed;
+
+	SoftWire::OperandREG32 ra(a);
+	SoftWire::OperandREG32 rb(b);
+
+	checkFixed(check, x86.adc(ra, rb), adc(fa, fb));
+	checkFixed(check, x86.add(ra, rb), add(fa, fb));
+	checkFixed(check, x86.and(ra, rb), and(fa, fb));
+	checkFixed(check, x86.cmp(ra, rb), cmp(fa, fb));
+	checkFixed(check, x86.imul(ra, rb), imul(fa, fb));
+	checkFixed(check, x86.mov(ra, rb), mov(fa, fb));
+	checkFixed(check, x86.or(ra, rb), or(fa, fb));
+	checkFixed(check, x86.sbb(ra, rb), sbb(fa, fb));
+	checkFixed(check, x86.sub(ra, rb), sub(fa, fb));
+	checkFixed(check, x86.test(ra, rb), test(fa, fb));
+	checkFixed(check, x86.xor(ra, rb), xor(fa, fb));
+
+	checkFixed(check, x86.adc(ra, 0x12345), adc(fa, 0x12345));
+	checkFixed(check, x86.add(ra, 0x12345), add(fa, 0x12345));
+	checkFixed(check, x86.and(ra, 0x12345), and(fa, 0x12345));
+	checkFixed(check, x86.cmp(ra, 0x12345), cmp(fa, 0x12345));
+	checkFixed(check, x86.mov(ra, 0x12345), mov(fa, 0x12345));
+	checkFixed(check, x86.or(ra, 0x12345), or(fa, 0x12345));
+	checkFixed(check, x86.sar(ra, 5), sar(fa, 5));
+	checkFixed(check, x86.sbb(ra, 0x12345), sbb(fa, 0x12345));
+	checkFixed(check, x86.shl(ra, 5), shl(fa, 5));
+	checkFixed(check, x86.shr(ra, 5), shr(fa, 5));
+	checkFixed(check, x86.sub(ra, 0x12345), sub(fa, 0x12345));
+	checkFixed(check, x86.xor(ra, 0x12345), xor(fa, 0x12345));
+
+	checkFixed(check, x86.neg(ra), neg(fa));
+	checkFixed(check, x86.not(ra), not(fa));
+}
+
+template<int a, int b>
+void checkFixed64(FixedCheck &check, SoftWire::Assembler &x86, SoftWire::Fixed::REG64<a> fa, SoftWire::Fixed::REG64<b> fb)
+{
+	using namespace SoftWire::Fixed;
+
+	SoftWire::OperandREG64 ra(a);
+	SoftWire::OperandREG64 rb(b);
+
+	checkFixed(check, x86.adc(ra, rb), adc(fa, fb));
+	checkFixed(check, x86.add(ra, rb), add(fa, fb));
+	checkFixed(check, x86.and(ra, rb), and(fa, fb));
+	checkFixed(check, x86.cmp(ra, rb), cmp(fa, fb));
+	checkFixed(check, x86.imul(ra, rb), imul(fa, fb));
+	checkFixed(check, x86.mov(ra, rb), mov(fa, fb));
+	checkFixed(check, x86.or(ra, rb), or(fa, fb));
+	checkFixed(check, x86.sbb(ra, rb), sbb(fa, fb));
+	checkFixed(check, x86.sub(ra, rb), sub(fa, fb));
+	checkFixed(check, x86.test(ra, rb), test(fa, fb));
+	checkFixed(check, x86.xor(ra, rb), xor(fa, fb));
+
+	checkFixed(check, x86.adc(ra, 0x12345), adc(fa, 0x12345));
+	checkFixed(check, x86.add(ra, 0x12345), add(fa, 0x12345));
+	checkFixed(check, x86.and(ra, 0x12345), and(fa, 0x12345));
+	checkFixed(check, x86.cmp(ra, 0x12345), cmp(fa, 0x12345));
+	checkFixed(check, x86.mov(ra, 0x12345), mov(fa, 0x12345));
+	checkFixed(check, x86.or(ra, 0x12345), or(fa, 0x12345));
+	checkFixed(check, x86.sar(ra, 5), sar(fa, 5));
+	checkFixed(check, x86.sbb(ra, 0x12345), sbb(fa, 0x12345));
+	checkFixed(check, x86.shl(ra, 5), shl(fa, 5));
+	checkFixed(check, x86.shr(ra, 5), shr(fa, 5));
+	checkFixed(check, x86.sub(ra, 0x12345), sub(fa, 0x12345));
+	checkFixed(check, x86.xor(ra, 0x12345), xor(fa, 0x12345));
+
+	checkFixed(check, x86.neg(ra), neg(fa));
+	checkFixed(check, x86.not(ra), not(fa));
+	checkFixed(check, x86.pop(ra), pop(fa));
+	checkFixed(check, x86.push(ra), push(fa));
+}
+
+template<int a, int b>
+void checkFixedSSE(FixedCheck &check, SoftWire::Assembler &x86, SoftWire::Fixed::XMMREG<a> fa, SoftWire::Fixed::XMMREG<b> fb)
+{
+	using namespace SoftWire::Fixed;
+
+	SoftWire::OperandXMMREG ra(a);
+	SoftWire::OperandXMMREG rb(b);
+
+	checkFixed(check, x86.addps(ra, rb), addps(fa, fb));
+	checkFixed(check, x86.addss(ra, rb), addss(fa, fb));
+	checkFixed(check, x86.andps(ra, rb), andps(fa, fb));
+	checkFixed(check, x86.divps(ra, rb), divps(fa, fb));
+	checkFixed(check, x86.maxps(ra, rb), maxps(fa, fb));
+	checkFixed(check, x86.minps(ra, rb), minps(fa, fb));
+	checkFixed(check, x86.movaps(ra, rb), movaps(fa, fb));
+	checkFixed(check, x86.movups(ra, rb), movups(fa, fb));
+	checkFixed(check, x86.mulps(ra, rb), mulps(fa, fb));
+	checkFixed(check, x86.mulss(ra, rb), mulss(fa, fb));
+	checkFixed(check, x86.orps(ra, rb), orps(fa, fb));
+	checkFixed(check, x86.sqrtps(ra, rb), sqrtps(fa, fb));
+	checkFixed(check, x86.subps(ra, rb), subps(fa, fb));
+	checkFixed(check, x86.xorps(ra, rb), xorps(fa, fb));
+}
+
+void testFixed()
+{
+	printf("Compile-time encoding test.\n\n");
+
+	using namespace SoftWire::Fixed;
+	bool x64 = sizeof(void*) == 8;
+
+	SoftWire::Assembler runTime(x64);
+	SoftWire::Assembler compileTime(x64);
+
+	runTime.mov(runTime.eax, runTime.edi);			compileTime.emit(mov(eax, edi));
+	runTime.imul(runTime.esi, runTime.ecx);			compileTime.emit(imul(esi, ecx));
+	runTime.mov(runTime.edx, 0x12345678);			compileTime.emit(mov(edx, 0x12345678));
+	runTime.sub(runTime.ebx, -8);					compileTime.emit(sub(ebx, -8));
+	runTime.sar(runTime.eax, 5);					compileTime.emit(sar(eax, 5));
+	runTime.push(runTime.ebp);						compileTime.emit(push(ebp));
+	runTime.addss(runTime.xmm7, runTime.xmm1);		compileTime.emit(addss(xmm7, xmm1));
+	runTime.xorps(runTime.xmm2, runTime.xmm3);		compileTime.emit(xorps(xmm2, xmm3));
+
+	if(x64)
+	{
+		runTime.add(runTime.r9, runTime.rax);		compileTime.emit(add(r9, rax));
+		runTime.cmp(runTime.r12, 100);				compileTime.emit(cmp(r12, 100));
+		runTime.pop(runTime.r15);					compileTime.emit(pop(r15));
+	}
+
+	runTime.ret();									compileTime.emit(ret());
+
+	runTime.callable();
+	compileTime.callable();
+
+	CodeBuffer expected = {{0}, 0};
+	CodeBuffer actual = {{0}, 0};
+	runTime.streamListing(appendCode, &expected);
+	compileTime.streamListing(appendCode, &actual);
+
+	bool pass = expected.length == actual.length && memcmp(expected.byte, actual.byte, expected.length) == 0;
+
+	printf("%d bytes, %s.\n", actual.length, pass ? "identical" : "different");
+
+	// Hard-coded instruction set indices and opcodes of all templates
+	FixedCheck check;
+	check.templates = 0;
+	check.mismatches = 0;
+
+	SoftWire::Assembler x86(x64);
+
+	checkFixed32(check, x86, edx, ebx);
+	checkFixed(check, x86.pop(x86.esi), pop(esi));
+	checkFixed(check, x86.push(x86.esi), push(esi));
+	checkFixed(check, x86.nop(), nop());
+	checkFixed(check, x86.ret(), ret());
+	checkFixedSSE(check, x86, xmm1, xmm6);
+
+	if(x64)
+	{
+		checkFixed32(check, x86, r10d, ecx);
+		checkFixed32(check, x86, edi, r15d);
+		checkFixed64(check, x86, rax, r9);
+		checkFixed64(check, x86, r12, rsi);
+		checkFixedSSE(check, x86, xmm9, xmm2);
+		checkFixedSSE(check, x86, xmm4, xmm14);
+	}
+
+	printf("%d templates checked against the instruction set, %d mismatches.\n\n", check.templates, check.mismatches);
+}
+
+template<class Generator>
+class StaticLayers : public Generator   // int f() returns 122, through allocated moves and emulated SSE when enabled
+{
+public:
+	StaticLayers(bool x64) : Generator(x64)
+	{
+		this->prologue(0);
+
+		typename Generator::Int a;
+		typename Generator::Int b;
+		typename Generator::Int c;
+		typename Generator::Float4 u(1.0f, 2.0f, 3.0f, 4.0f);
+		typename Generator::Float4 v(0.5f, 0.5f, 0.5f, 0.5f);
+
+		this->mov(a, 20);
+		this->mov(b, a);   // Copy propagation
+		this->add(b, 2);
+		this->addps(u, v);
+		this->mulps(u, v);
+		this->cvttss2si(c, u);
+		this->add(c, b);
+		this->add(c, 100);
+
+		this->result(c);
+		this->epilogue();
+	}
+};
+
+// Compares the instruction text of listings, ignoring code bytes and numbers which depend on addresses
+bool sameInstructions(const char *a, const char *b)
+{
+	while(*a && *b)
+	{
+		const char *endA = strchr(a, '\n');
+		const char *endB = strchr(b, '\n');
+		if(!endA) endA = a + strlen(a);
+		if(!endB) endB = b + strlen(b);
+
+		const char *textA = strchr(a, '\t');
+		const char *textB = strchr(b, '\t');
+		if(textA && textA < endA) a = textA;
+		if(textB && textB < endB) b = textB;
+
+		while(a < endA && b < endB)
+		{
+			if(a[0] == '0' && a[1] == 'x' && b[0] == '0' && b[1] == 'x')
+			{
+				for(a += 2; isxdigit(*a); a++);
+				for(b += 2; isxdigit(*b); b++);
+			}
+			else if(*a++ != *b++)
+			{
+				return false;
+			}
+		}
+
+		if(a != endA || b != endB)
+		{
+			return false;
+		}
+
+		if(*a) a++;
+		if(*b) b++;
+	}
+
+	return !*a && !*b;
+}
+
+void testStatic()
+{
+	printf("Static composition test.\n\n");
+
+	bool x64 = sizeof(void*) == 8;
+
+	SoftWire::Assembler dynamic(x64);
+	SoftWire::Static<SoftWire::Assembler> composed(x64);
+
+	dynamic.mov(dynamic.eax, dynamic.dword_ptr [dynamic.esi+dynamic.ecx*4+16]);
+	composed.mov(composed.eax, composed.dword_ptr [composed.esi+composed.ecx*4+16]);
+	dynamic.imul(dynamic.edx, dynamic.eax, 12);
+	composed.imul(composed.edx, composed.eax, 12);
+	dynamic.shufps(dynamic.xmm0, dynamic.xmm1, 0x1B);
+	composed.shufps(composed.xmm0, composed.xmm1, 0x1B);
+	dynamic.ret();
+	composed.ret();
+
+	dynamic.callable();
+	composed.callable();
+
+	bool pass = strcmp(dynamic.getListing(), composed.getListing()) == 0;
+
+	printf("%s\n", composed.getListing());
+	printf("Listings %s.\n\n", pass ? "identical" : "different");
+
+	// Forwarding to the register allocator and emulator
+	for(int emulate = 0; emulate < 2; emulate++)
+	{
+		if(emulate) SoftWire::Emulator::enableEmulateSSE();
+		else        SoftWire::Emulator::disableEmulateSSE();
+
+		StaticLayers<SoftWire::CodeGenerator> dynamicLayers(x64);
+		StaticLayers<SoftWire::Static<SoftWire::CodeGenerator> > composedLayers(x64);
+
+		int x = ((int(*)())dynamicLayers.callable())();
+		int y = ((int(*)())composedLayers.callable())();
+
+		bool same = sameInstructions(dynamicLayers.getListing(), composedLayers.getListing());
+
+		printf("Static<CodeGenerator>%s: f() = %d and %d, expected 122, listings %s.\n", emulate ? " with SSE emulation" : "", x, y, same ? "identical" : "different");
+	}
+
+	SoftWire::Emulator::disableEmulateSSE();
+	printf("\n");
+}
+
+int firstTarget()
+{
+	return 1;
+}
+
+int secondTarget()
+{
+	return 2;
+}
+
+int (*slotRoutine(SoftWire::Assembler &x86, bool x64))()
+{
+	if(x64)
+	{
+		x86.sub(x86.rsp, 8);
+		x86.call(x86.qword_ptr [x86.slot("target", (void*)firstTarget)]);
+		x86.add(x86.rsp, 8);
+	}
+	else
+	{
+		x86.call(x86.dword_ptr [x86.slot("target", (void*)firstTarget)]);
+	}
+
+	x86.ret();
+
+	return (int(*)())x86.finalize();
+}
+
+void testSlot()
+{
+	printf("Call slot test.\n\n");
+
+	bool x64 = sizeof(void*) == 8;
+
+	SoftWire::Assembler x86(x64);
+	int (*function)() = slotRoutine(x86, x64);
+
+	int before = function();
+	x86.redirect("target", (void*)secondTarget);
+	int after = function();
+	x86.redirect("target", (void*)firstTarget);
+	int back = function();
+
+	printf("f() = %d, %d after redirect and %d after redirecting back, expected 1, 2 and 1.\n\n", before, after, back);
+}
+
+void testHugePages()
+{
+	printf("Huge page arena test.\n\n");
+
+	bool x64 = sizeof(void*) == 8;
+
+	const int routines = 64;
+	int (*function[routines])();
+
+	int bytes = SoftWire::Assembler::codeBytes();
+	int pages = SoftWire::Assembler::codePages();
+
+	SoftWire::Assembler::enableHugePages();
+
+	for(int i = 0; i < routines; i++)
+	{
+		SoftWire::Assembler *x86 = new SoftWire::Assembler(x64);
+
+		if(i % 4 == 3) x86->coldRoutine();   // Every fourth rarely executed
+
+		x86->mov(x86->eax, i);
+
+		for(int j = 0; j < 16; j++)
+		{
+			x86->add(x86->eax, 0x10000);
+		}
+
+		x86->ret();
+
+		function[i] = (int(*)())x86->finalize();
+		x86->acquire();   // Arena memory is never freed
+
+		delete x86;
+	}
+
+	SoftWire::Assembler::disableHugePages();
+
+	bytes = SoftWire::Assembler::codeBytes() - bytes;
+	pages = SoftWire::Assembler::codePages() - pages;
+
+	int passed = 0;
+	unsigned char *hot[2] = {0, 0};   // Lowest and highest entry
+	unsigned char *cold[2] = {0, 0};
+
+	for(int i = 0; i < routines; i++)
+	{
+		if(function[i]() == i + 16 * 0x10000) passed++;
+
+		unsigned char *entry = (unsigned char*)function[i];
+		unsigned char **range = (i % 4 == 3) ? cold : hot;
+
+		if(!range[0] || entry < range[0]) range[0] = entry;
+		if(!range[1] || entry > range[1]) range[1] = entry;
+	}
+
+	bool grouped = hot[1] < cold[0] || cold[1] < hot[0];
+	bool dense = pages <= (bytes + 4095) / 4096 + 1;   // Hot and cold part each end in a partial page
+
+	printf("%d of %d routines passed, hot and cold routines %s.\n", passed, routines, grouped ? "apart" : "interleaved");
+	printf("%d bytes in %d pages of 4 KB, %s, %d huge pages.\n\n", bytes, pages, dense ? "densely packed" : "not densely packed", SoftWire::Assembler::hugePages());
+}
+
+#ifdef __linux__
+int cacheHelper()
+{
+	return 14;
+}
+
+void (*cachedRoutine(SoftWire::CodeCache &cache))()
+{
+	const char key[] = "cacheHelper() * 3";
+
+	void (*function)() = cache.lookup(key, sizeof(key));
+
+	if(!function)
+	{
+		bool x64 = sizeof(void*) == 8;
+
+		SoftWire::Assembler x86(x64);
+
+		if(x64) x86.sub(x86.rsp, 8);
+		x86.call("cacheHelper");
+		x86.mov(x86.ecx, x86.eax);
+		x86.add(x86.eax, x86.ecx);
+		x86.add(x86.eax, x86.ecx);
+		if(x64) x86.add(x86.rsp, 8);
+		x86.ret();
+
+		function = cache.publish(key, sizeof(key), x86);
+	}
+
+	return function;
+}
+
+void testCodeCache()
+{
+	printf("Shared code cache test.\n\n");
+
+	SoftWire::Linker::defineExternal((void*)cacheHelper, "cacheHelper");
+
+	SoftWire::CodeCache cache(1 << 16, 64);
+
+	const int workers = 4;
+	int passed = 0;
+
+	for(int i = 0; i < workers; i++)
+	{
+		if(fork() == 0)
+		{
+			int (*function)() = (int(*)())cachedRoutine(cache);
+
+			_exit(function && function() == 42 ? 0 : 1);
+		}
+	}
+
+	for(int i = 0; i < workers; i++)
+	{
+		int status;
+		wait(&status);
+
+		if(WIFEXITED(status) && WEXITSTATUS(status) == 0) passed++;
+	}
+
+	char key[] = "cacheHelper() * 3";
+	int (*shared)() = (int(*)())cache.lookup(key, sizeof(key));
+
+	printf("%d of %d workers passed, routine %s by the workers returns %d.\n", passed, workers, shared ? "published" : "not published", shared ? shared() : 0);
+
+	// Absolute targets are only valid in this process
+	SoftWire::Assembler absolute(sizeof(void*) == 8);
+	absolute.call((void*)cacheHelper);
+	absolute.ret();
+
+	const char absoluteKey[] = "absolute cacheHelper()";
+
+	try
+	{
+		cache.publish(absoluteKey, sizeof(absoluteKey), absolute);
+		printf("Absolute call published.\n\n");
+	}
+	catch(const SoftWire::Error &error)
+	{
+		printf("Absolute call rejected: %s\n\n", error.getString());
+	}
+}
+
+const char *mappingOf(const void *address, char *permissions)
+{
+	FILE *maps = fopen("/proc/self/maps", "r");
+	char line[512];
+
+	strcpy(permissions, "none");
+
+	while(maps && fgets(line, sizeof(line), maps))
+	{
+		unsigned long start;
+		unsigned long end;
+		char flags[8];
+
+		if(sscanf(line, "%lx-%lx %7s", &start, &end, flags) == 3 && (unsigned long)address >= start && (unsigned long)address < end)
+		{
+			strcpy(permissions, flags);
+			break;
+		}
+	}
+
+	if(maps) fclose(maps);
+
+	return permissions;
+}
+
+void testDualMapping()
+{
+	printf("Dual mapping test.\n\n");
+
+	SoftWire::Assembler::enableDualMapping();
+
+	try
+	{
+		bool x64 = sizeof(void*) == 8;
+
+		SoftWire::Assembler x86(x64);
+		int (*function)() = slotRoutine(x86, x64);
+
+		int before = function();
+		x86.redirect("target", (void*)secondTarget);   // Patched through the writable view
+		int after = function();
+
+		char permissions[8];
+		mappingOf((void*)function, permissions);
+
+		bool executableOnly = permissions[1] == '-' && permissions[2] == 'x';
+
+		printf("Code mapped %s, %s, f() = %d before and %d after redirect, expected 1 and 2.\n\n", permissions, executableOnly ? "not writable" : "writable", before, after);
+	}
+	catch(const SoftWire::Error &error)
+	{
+		printf("Dual mapping failed: %s\n\n", error.getString());
+	}
+
+	SoftWire::Assembler::disableDualMapping();
+}
+#endif
+
 int main()
 {
 #if 0
@@ -507,6 +1654,24 @@ int main()
 	testX64();
 #endif
 
+	testCallingConvention();
+	testStackAlignment();
+	testScalarCoalescing();
+	testPadding();
+	testColdCode();
+	testProfile();
+	testModule();
+	testDisassembler();
+	testFixed();
+	testStatic();
+	testSlot();
+	testHugePages();
+
+#ifdef __linux__
+	testCodeCache();
+	testDualMapping();
+#endif
+
 	printf("Press any key to continue\n");
 	_getch();
 	